@@ -7,6 +7,7 @@ from ._jsbsim import (
     FGAircraft,
     FGAtmosphere,
     FGAuxiliary,
+    FGCompressedFileReader,
     FGEngine,
     FGFDMExec,
     FGGroundReactions,
@@ -14,10 +15,12 @@ from ._jsbsim import (
     FGLGear,
     FGLinearization,
     FGMassBalance,
+    FGMonteCarlo,
     FGPropagate,
     FGPropertyManager,
     FGPropertyNode,
     FGPropulsion,
+    FGTable,
     GeographicError,
     TrimFailureError,
     ePressure,
@@ -64,6 +64,36 @@ cdef extern from "initialization/FGLinearization.h" namespace "JSBSim":
         vector[string]& GetInputUnits() const
         vector[string]& GetOutputUnits() const
 
+cdef extern from "initialization/FGMonteCarlo.h" namespace "JSBSim":
+    cdef cppclass c_FGMonteCarlo "JSBSim::FGMonteCarlo":
+        c_FGMonteCarlo(c_FGFDMExec* fdme)
+
+        bool Load(const c_SGPath& path) except +convertJSBSimToPyExc
+        bool Run() except +convertJSBSimToPyExc
+
+        unsigned int GetNumRuns() const
+        void SetNumRuns(unsigned int n)
+        void SetNumThreads(unsigned int n)
+        void SetSeed(unsigned int s)
+
+        vector[string] GetColumnNames() const
+        vector[vector[double]]& GetResults() const
+
+cdef extern from "input_output/FGCompressedFile.h" namespace "JSBSim::FGCompressedFile":
+    cdef cppclass c_BlockInfo "JSBSim::FGCompressedFile::BlockInfo":
+        double StartTime
+        double EndTime
+
+cdef extern from "input_output/FGCompressedFile.h" namespace "JSBSim":
+    cdef cppclass c_FGCompressedFileReader "JSBSim::FGCompressedFileReader":
+        c_FGCompressedFileReader(const string& filename) except +convertJSBSimToPyExc
+
+        const string& GetHeader() const
+        size_t GetNumBlocks() const
+        const c_BlockInfo& GetBlock(size_t i) const
+        string Read() except +convertJSBSimToPyExc
+        string Read(double start, double end) except +convertJSBSimToPyExc
+
 cdef extern from "simgear/structure/SGSharedPtr.hxx":
     cdef cppclass SGSharedPtr[T]:
         SGSharedPtr()
@@ -191,6 +221,30 @@ cdef extern from "simgear/misc/sg_path.hxx":
         void set(const string& p)
         string utf8Str()
 
+cdef extern from "input_output/FGXMLElement.h" namespace "JSBSim":
+    cdef cppclass c_Element "JSBSim::Element":
+        const string& GetName() const
+        string GetAttributeValue(const string& key)
+        unsigned int GetNumElements()
+        c_Element* GetElement(unsigned int el)
+        const string& GetDataLine(unsigned int i) const
+
+cdef extern from "input_output/FGXMLFileRead.h" namespace "JSBSim":
+    cdef cppclass c_FGXMLFileRead "JSBSim::FGXMLFileRead":
+        c_FGXMLFileRead()
+        c_Element* LoadXMLDocument(const c_SGPath& XML_filename, bool verbose) except +convertJSBSimToPyExc
+
+cdef extern from "math/FGTable.h" namespace "JSBSim":
+    cdef cppclass c_FGTable "JSBSim::FGTable":
+        c_FGTable(shared_ptr[c_FGPropertyManager] pm, c_Element* el) except +convertJSBSimToPyExc
+        unsigned int GetDimension() const
+        unsigned int GetNumRows() const
+        void GetValues(const double* keys, double* results, size_t n) const
+        void GetValues(const double* rowKeys, const double* colKeys,
+                       double* results, size_t n) const
+        void GetValues(const double* rowKeys, const double* colKeys,
+                       const double* tableKeys, double* results, size_t n) const
+
 cdef extern from "FGJSBBase.h" namespace "JSBSim":
     cdef cppclass c_FGJSBBase "JSBSim::FGJSBBase":
         c_FGJSBBase()
@@ -211,6 +265,8 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
                        const c_SGPath systems_path,
                        const string model,
                        bool add_model_to_path) except +convertJSBSimToPyExc
+        bool CompileModel(const string& model, const c_SGPath& filename,
+                          bool add_model_to_path) except +convertJSBSimToPyExc
         bool LoadScript(const c_SGPath& script, double delta_t,
                         const c_SGPath& initfile) except +convertJSBSimToPyExc
         bool LoadPlanet(const c_SGPath& planet_path,
@@ -259,6 +315,7 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         void Setdt(double delta_t)
         double IncrTime()
         int GetDebugLevel()
+        size_t GetSharedTableBytes()
         shared_ptr[c_FGPropulsion] GetPropulsion()
         shared_ptr[c_FGInitialCondition] GetIC()
         shared_ptr[c_FGPropagate] GetPropagate()
@@ -216,7 +216,7 @@ class GenerateStub(Interpreter):
         assert len(tree.children) == 2
         param_name = rule_name(tree.children[0])
         assert isinstance(tree.children[1], Tree)
-        param_type = self.visit(tree.children[1])
+        param_type = self.get_varname(tree.children[1])
         return param_name, param_type
 
     def python__number(self, tree: Tree) -> str:
@@ -43,6 +43,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iomanip>
+#include <optional>
 
 #include "FGFDMExec.h"
 #include "models/atmosphere/FGStandardAtmosphere.h"
@@ -63,8 +64,12 @@ INCLUDES
 #include "initialization/FGLinearization.h"
 #include "input_output/FGScript.h"
 #include "input_output/FGXMLFileRead.h"
+#include "input_output/FGCompiledModel.h"
+#include "input_output/FGModelLoader.h"
+#include "input_output/FGXMLPreloader.h"
 #include "initialization/FGInitialCondition.h"
 #include "input_output/FGLog.h"
+#include "math/FGSharedArray.h"
 
 using namespace std;
 
@@ -398,6 +403,7 @@ bool FGFDMExec::DeAllocate(void)
 {
 
   Models.clear();
+  RandomStreams.clear();
   modelLoaded = false;
   return modelLoaded;
 }
@@ -852,11 +858,49 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     Allocate();
   }
 
+  // Use the compiled model of the aircraft if there is an up to date one.
+  FGCompiledModel compiled(RootDir);
+  std::optional<FGCompiledModel::Scope> compiledScope;
+  if (!FGCompiledModel::GetActive()) {
+    SGPath compiledFileName = FullAircraftPath/(model + FGCompiledModel::Extension);
+    if (compiledFileName.exists()) {
+      if (!compiled.Open(compiledFileName)) {
+        FGLogging log(Log, LogLevel::WARN);
+        log << "Could not read the compiled model " << compiledFileName
+            << ". Loading the XML files instead." << endl;
+      }
+      else if (!compiled.IsUpToDate()) {
+        FGLogging log(Log, LogLevel::WARN);
+        log << "The compiled model " << compiledFileName << " is out of date."
+            << " Loading the XML files instead." << endl;
+      }
+      else {
+        compiledScope.emplace(compiled);
+        if (debug_lvl > 0) {
+          FGLogging log(Log, LogLevel::INFO);
+          log << "Loading the compiled model " << compiledFileName << endl;
+        }
+      }
+    }
+  }
+
   int saved_debug_lvl = debug_lvl;
+  size_t savedTableBytes = FGSharedArray::GetSavedBytes();
+  size_t totalTableBytes = FGSharedArray::GetTotalBytes();
   FGXMLFileRead XMLFileRead;
   Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
 
   if (document) {
+    // The files referenced by the aircraft are parsed concurrently before the
+    // models are built. The documents of a compiled model are not parsed.
+    FGXMLPreloader preloader;
+    FGCompiledModel* activeCompiled = FGCompiledModel::GetActive();
+    if (!activeCompiled || activeCompiled->IsRecording()) {
+      PreloadFiles(document, preloader);
+      preloader.Run();
+    }
+    FGXMLPreloader::Scope preloaderScope(preloader);
+
     if (IsChild) debug_lvl = 0;
 
     ReadPrologue(document);
@@ -1055,6 +1099,14 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
     if (IsChild) debug_lvl = saved_debug_lvl;
 
+    SharedTableBytes = FGSharedArray::GetSavedBytes() - savedTableBytes;
+    if (debug_lvl > 0) {
+      FGLogging log(Log, LogLevel::INFO);
+      log << "  Table data: " << FGSharedArray::GetTotalBytes() - totalTableBytes
+          << " bytes, " << SharedTableBytes
+          << " bytes shared with the tables already loaded" << endl;
+    }
+
   } else {
     FGLogging log(Log, LogLevel::ERROR);
     log << LogFormat::RED
@@ -1076,6 +1128,36 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFDMExec::CompileModel(const string& model, const SGPath& filename,
+                             bool addModelToPath)
+{
+  FGCompiledModel compiled(RootDir);
+
+  {
+    FGCompiledModel::Scope scope(compiled);
+    if (!LoadModel(model, addModelToPath)) return false;
+  }
+
+  SGPath compiledFileName = filename.isNull()
+    ? FullAircraftPath/(model + FGCompiledModel::Extension)
+    : GetFullPath(filename);
+
+  if (!compiled.Save(compiledFileName)) {
+    FGLogging log(Log, LogLevel::ERROR);
+    log << "Could not write the compiled model " << compiledFileName << endl;
+    return false;
+  }
+
+  if (debug_lvl > 0) {
+    FGLogging log(Log, LogLevel::INFO);
+    log << "Compiled model written to " << compiledFileName << endl;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFDMExec::GetPropulsionTankReport() const
 {
   return Propulsion->GetPropulsionTankReport();
@@ -1146,6 +1228,51 @@ void FGFDMExec::PrintSimulationConfiguration(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::PreloadFiles(Element* document, FGXMLPreloader& preloader)
+{
+  // The paths are resolved as FGModelLoader::Open() does for each model.
+  auto schedule = [&preloader](Element* el, auto findFullPathName) {
+    string fname = el->GetAttributeValue("file");
+    if (fname.empty()) return;
+
+    SGPath path(SGPath::fromUtf8(fname.c_str()));
+    preloader.Add(path.isRelative() ? findFullPathName(path) : path);
+  };
+  auto findEngine = [this](const SGPath& path) {
+    return Propulsion->FindEngineFullPathName(path);
+  };
+  auto findSystem = [this](const SGPath& path) {
+    return FCS->FindSystemFullPathName(path);
+  };
+  auto findInAircraft = [this](const SGPath& path) {
+    return CheckPathName(FullAircraftPath, path);
+  };
+
+  Element* propulsion = document->FindElement("propulsion");
+  if (propulsion) {
+    Element* engine = propulsion->FindElement("engine");
+    while (engine) {
+      schedule(engine, findEngine);
+      Element* thruster = engine->FindElement("thruster");
+      if (thruster) schedule(thruster, findEngine);
+      engine = propulsion->FindNextElement("engine");
+    }
+  }
+
+  Element* system = document->FindElement("system");
+  while (system) {
+    schedule(system, findSystem);
+    system = document->FindNextElement("system");
+  }
+
+  for (const char* name: {"autopilot", "flight_control"}) {
+    Element* element = document->FindElement(name);
+    if (element) schedule(element, findInAircraft);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGFDMExec::ReadFileHeader(Element* el)
 {
   FGLogging log(Log, LogLevel::DEBUG);
@@ -1360,6 +1487,25 @@ void FGFDMExec::SRand(int sr)
 {
   RandomSeed = sr;
   RandomGenerator->seed(RandomSeed);
+  for (auto& stream: RandomStreams)
+    stream.second->seed(RandomSeed);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+shared_ptr<RandomNumberGenerator> FGFDMExec::GetRandomGenerator(const string& name)
+{
+  // Consumers with the same name (two sensors named alike for instance) are
+  // told apart by the order in which they request their generator so that
+  // their numbers are not correlated.
+  string stream = name;
+  for (unsigned int n=2; RandomStreams.find(stream) != RandomStreams.end(); ++n)
+    stream = name + "/" + to_string(n);
+
+  auto generator = make_shared<RandomNumberGenerator>(RandomSeed,
+                                                      RandomNumberGenerator::StreamId(stream));
+  RandomStreams[stream] = generator;
+  return generator;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -70,6 +70,7 @@ class FGInput;
 class FGPropulsion;
 class FGMassBalance;
 class FGLogger;
+class FGXMLPreloader;
 
 class TrimFailureException : public BaseException {
   public:
@@ -291,6 +292,21 @@ public:
       @return true if successful*/
   bool LoadModel(const std::string& model, bool addModelToPath = true);
 
+  /** Loads an aircraft model from its XML files and saves it as a compiled
+      model. Once compiled, LoadModel() instantiates the aircraft from the
+      compiled model without parsing XML as long as none of its XML files has
+      been modified, renamed or removed.
+      @param model the name of the aircraft model (see LoadModel())
+      @param filename the compiled model file. Defaults to the model name with
+      the extension .jsbbin in the aircraft directory which is where
+      LoadModel() looks for it.
+      @param addModelToPath set to true to add the model name to the
+      AircraftPath, defaults to true
+      @return true if successful
+      @see FGCompiledModel */
+  bool CompileModel(const std::string& model, const SGPath& filename = SGPath(),
+                    bool addModelToPath = true);
+
   /** Load a script
       @param Script The full path name and file name for the script to be loaded.
       @param deltaT The simulation integration step size, if given.  If no value
@@ -604,6 +620,12 @@ public:
   /** Retrieves the current debug level setting. */
   int GetDebugLevel(void) const {return debug_lvl;};
 
+  /** Retrieves the number of bytes of table data that the last loaded model
+      shares with the tables that were already in memory: the tables of the
+      identical engines, propellers, gears, of the child FDMs and of the other
+      FDMs of the process (see FGSharedArray). */
+  size_t GetSharedTableBytes(void) const {return SharedTableBytes;}
+
   /** Initializes the simulation with initial conditions
       @param FGIC The initial conditions that will be passed to the simulation. */
   void Initialize(const FGInitialCondition* FGIC);
@@ -629,6 +651,16 @@ public:
 
   auto GetRandomGenerator(void) const { return RandomGenerator; }
 
+  /** Get the random number generator dedicated to a consumer of random
+      numbers. The generator shares the seed of the FDM (see SRand()) but draws
+      its numbers from a stream of its own so that the sequence of a consumer
+      does not depend on the other consumers. Each call returns a new
+      generator: consumers requesting the same name get distinct streams,
+      numbered in the order of their requests.
+      @param name stable name of the consumer
+      @return a pointer to the generator */
+  std::shared_ptr<RandomNumberGenerator> GetRandomGenerator(const std::string& name);
+
   int  SRand(void) const { return RandomSeed; }
 
 private:
@@ -649,6 +681,7 @@ private:
   bool Constructing;
   bool modelLoaded;
   bool IsChild;
+  size_t SharedTableBytes = 0;
   std::string modelName;
   SGPath AircraftPath;
   SGPath FullAircraftPath;
@@ -693,6 +726,7 @@ private:
 
   unsigned int RandomSeed;
   std::shared_ptr<RandomNumberGenerator> RandomGenerator;
+  std::map<std::string, std::shared_ptr<RandomNumberGenerator>> RandomStreams;
 
   // The FDM counter is used to give each child FDM an unique ID. The root FDM
   // has the ID 0
@@ -706,6 +740,7 @@ private:
   bool ReadFileHeader(Element*);
   bool ReadChild(Element*);
   bool ReadPrologue(Element*);
+  void PreloadFiles(Element* document, FGXMLPreloader& preloader);
   void SRand(int sr);
   void LoadInputs(unsigned int idx);
   void LoadPlanetConstants(void);
@@ -35,6 +35,8 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <chrono>
+
 #include "FGJSBBase.h"
 #include "models/FGAtmosphere.h"
 
@@ -90,5 +92,116 @@ string FGJSBBase::CreateIndexedPropertyName(const string& Property, int index)
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+RandomNumberGenerator::RandomNumberGenerator(void)
+  : stream_id(0)
+{
+  auto seed_value = std::chrono::system_clock::now().time_since_epoch().count();
+  key = static_cast<unsigned int>(seed_value);
+  seed_reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Philox4x32-10: the counter is made of the block index (2 low words) and the
+// stream identifier (2 high words). The seed is the low word of the key.
+
+void RandomNumberGenerator::Generate(void)
+{
+  const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+  const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+  uint32_t c0 = static_cast<uint32_t>(counter);
+  uint32_t c1 = static_cast<uint32_t>(counter >> 32);
+  uint32_t c2 = static_cast<uint32_t>(stream_id);
+  uint32_t c3 = static_cast<uint32_t>(stream_id >> 32);
+  uint32_t k0 = key, k1 = 0;
+
+  for (int round=0; round < 10; ++round) {
+    uint64_t p0 = uint64_t(M0) * c0;
+    uint64_t p1 = uint64_t(M1) * c2;
+    uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+    uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += W0;
+    k1 += W1;
+  }
+
+  block[0] = c0;
+  block[1] = c1;
+  block[2] = c2;
+  block[3] = c3;
+  ++counter;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Marsaglia polar method. Only sqrt() and log() are used: unlike sin() and
+// cos() in the Box-Muller method, sqrt() is exactly rounded on all IEEE 754
+// platforms.
+
+double RandomNumberGenerator::GetNormalRandomNumber(void)
+{
+  if (has_normal) {
+    has_normal = false;
+    return next_normal;
+  }
+
+  double u, v, s;
+  do {
+    u = GetUniformRandomNumber();
+    v = GetUniformRandomNumber();
+    s = u*u + v*v;
+  } while (s >= 1.0 || s == 0.0);
+
+  double f = sqrt(-2.0*log(s)/s);
+  next_normal = v*f;
+  has_normal = true;
+  return u*f;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void RandomNumberGenerator::FillUniform(double* values, size_t n)
+{
+  size_t i = 0;
+
+  // Consume the bits left over from the current block first.
+  for (; i < n && position <= 2; ++i)
+    values[i] = GetUniformRandomNumber();
+
+  // Then convert whole blocks without going through the position bookkeeping.
+  for (; i+1 < n; i += 2) {
+    Generate();
+    values[i]   = 2.0*ToUnit((uint64_t(block[0]) << 32) | block[1]) - 1.0;
+    values[i+1] = 2.0*ToUnit((uint64_t(block[2]) << 32) | block[3]) - 1.0;
+  }
+
+  for (; i < n; ++i)
+    values[i] = GetUniformRandomNumber();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void RandomNumberGenerator::FillNormal(double* values, size_t n)
+{
+  for (size_t i=0; i < n; ++i)
+    values[i] = GetNormalRandomNumber();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint64_t RandomNumberGenerator::StreamId(const string& name)
+{
+  uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+  for (unsigned char c: name) {
+    hash ^= c;
+    hash *= UINT64_C(0x100000001b3);
+  }
+
+  return hash;
+}
+
 } // namespace JSBSim
 
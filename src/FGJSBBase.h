@@ -42,9 +42,8 @@ INCLUDES
 #include <queue>
 #include <string>
 #include <cmath>
+#include <cstdint>
 #include <stdexcept>
-#include <random>
-#include <chrono>
 
 #include "JSBSim_API.h"
 
@@ -65,8 +64,22 @@ class JSBSIM_API BaseException : public std::runtime_error {
 
 /**
  * @brief Random number generator.
- * This class encapsulates the C++11 random number generation classes for
- * uniform and gaussian (aka normal) distributions as well as their seed.
+ * This class implements the counter based generator Philox4x32-10 (Salmon et
+ * al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC11) and derives
+ * uniform and gaussian (aka normal) distributions from it.
+ *
+ * The generator has no state other than its seed, its stream identifier and
+ * the index of the next block of random bits: the block number n of a stream
+ * is obtained by encrypting the counter (n, stream) with the seed as the key.
+ * As a consequence:
+ * - the sequences only depend on the seed and the stream identifier, and not
+ *   on the compiler nor on the standard library,
+ * - each consumer of random numbers can be given its own stream (see
+ *   StreamId()) so that adding or removing a consumer does not change the
+ *   sequences drawn by the others,
+ * - generators can be used concurrently in different threads as long as they
+ *   do not share a stream.
+ *
  * This class guarantees that whenever its seed is reset so are its uniform
  * and normal random number generators.
  */
@@ -74,30 +87,66 @@ class JSBSIM_API BaseException : public std::runtime_error {
 class JSBSIM_API RandomNumberGenerator {
   public:
     /// Default constructor using a seed based on the system clock.
-    RandomNumberGenerator(void) : uniform_random(-1.0, 1.0), normal_random(0.0, 1.0)
-    {
-      auto seed_value = std::chrono::system_clock::now().time_since_epoch().count();
-      generator.seed(static_cast<unsigned int>(seed_value));
-    }
-    /// Constructor allowing to specify a seed.
-    RandomNumberGenerator(unsigned int seed)
-      : generator(seed), uniform_random(-1.0, 1.0), normal_random(0.0, 1.0) {}
+    RandomNumberGenerator(void);
+    /** Constructor allowing to specify a seed and a stream.
+        @param seed seed of the generator
+        @param stream identifier of the stream (see StreamId()) */
+    RandomNumberGenerator(unsigned int seed, uint64_t stream=0)
+      : key(seed), stream_id(stream) { seed_reset(); }
     /// Specify a new seed and reinitialize the random generation process.
-    void seed(unsigned int value) {
-      generator.seed(value);
-      uniform_random.reset();
-      normal_random.reset();
-    }
+    void seed(unsigned int value) { key = value; seed_reset(); }
+    /// Get the seed of the generator.
+    unsigned int GetSeed(void) const { return key; }
+    /// Get the identifier of the stream.
+    uint64_t GetStream(void) const { return stream_id; }
+    /** Get a generator that shares the seed of this generator but draws its
+        numbers from another stream. The new generator starts at the beginning
+        of its stream.
+        @param stream identifier of the stream */
+    RandomNumberGenerator Split(uint64_t stream) const
+    { return RandomNumberGenerator(key, stream); }
     /** Get a random number which probability of occurrence is uniformly
      * distributed over the segment [-1;1( */
-    double GetUniformRandomNumber(void) { return uniform_random(generator); }
+    double GetUniformRandomNumber(void) { return 2.0*ToUnit(NextBits()) - 1.0; }
     /** Get a random number which probability of occurrence is following Gauss
      * normal distribution with a mean of 0.0 and a standard deviation of 1.0 */
-    double GetNormalRandomNumber(void) { return normal_random(generator); }
+    double GetNormalRandomNumber(void);
+    /** Fill an array with random numbers uniformly distributed over [-1;1(.
+        The result is the same as calling GetUniformRandomNumber() n times. */
+    void FillUniform(double* values, size_t n);
+    /** Fill an array with random numbers following the normal distribution.
+        The result is the same as calling GetNormalRandomNumber() n times. */
+    void FillNormal(double* values, size_t n);
+    /** Compute a stream identifier from a name. The identifier is computed
+        with the FNV-1a hash function so that it does not depend on the
+        platform. */
+    static uint64_t StreamId(const std::string& name);
   private:
-    std::default_random_engine generator;
-    std::uniform_real_distribution<double> uniform_random;
-    std::normal_distribution<double> normal_random;
+    unsigned int key;
+    uint64_t stream_id;
+    uint64_t counter;
+    uint32_t block[4];
+    unsigned int position;
+    bool has_normal;
+    double next_normal;
+
+    void seed_reset(void) {
+      counter = 0;
+      position = 4;
+      has_normal = false;
+    }
+    void Generate(void);
+    uint64_t NextBits(void) {
+      if (position > 2) {
+        Generate();
+        position = 0;
+      }
+      uint64_t bits = (uint64_t(block[position]) << 32) | block[position+1];
+      position += 2;
+      return bits;
+    }
+    /// Convert 64 random bits into a double uniformly distributed over [0;1(
+    static double ToUnit(uint64_t bits) { return (bits >> 11) * 0x1.0p-53; }
 };
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
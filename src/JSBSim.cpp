@@ -41,6 +41,7 @@ INCLUDES
 
 #include "initialization/FGTrim.h"
 #include "initialization/FGInitialCondition.h"
+#include "initialization/FGMonteCarlo.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/string_utilities.h"
@@ -87,6 +88,8 @@ GLOBAL DATA
 
 SGPath RootDir;
 SGPath ScriptName;
+SGPath MonteCarloName;
+SGPath CompiledModelName;
 string AircraftName;
 SGPath ResetName;
 SGPath PlanetName;
@@ -101,6 +104,7 @@ bool realtime;
 bool play_nice;
 bool suspend;
 bool catalog;
+bool compile;
 bool nohighlight;
 
 double end_time = 1e99;
@@ -361,6 +365,8 @@ int real_main(int argc, char* argv[])
   // *** INITIALIZATIONS *** //
 
   ScriptName = "";
+  MonteCarloName = "";
+  CompiledModelName = "";
   AircraftName = "";
   ResetName = "";
   PlanetName = "";
@@ -379,6 +385,7 @@ int real_main(int argc, char* argv[])
   play_nice = false;
   suspend = false;
   catalog = false;
+  compile = false;
   nohighlight = false;
 
   // *** PARSE OPTIONS PASSED INTO THIS SPECIFIC APPLICATION: JSBSim *** //
@@ -443,6 +450,32 @@ int real_main(int argc, char* argv[])
     }
   }
 
+  // *** RUN A BATCH OF DISPERSED SCRIPTS AND EXIT *** //
+  if (!MonteCarloName.isNull()) {
+    JSBSim::FGMonteCarlo MonteCarlo(FDMExec);
+
+    result = MonteCarlo.Load(MonteCarloName) && MonteCarlo.Run();
+
+    if (!result)
+      cerr << "Dispersion file " << MonteCarloName << " was not successfully run" << endl;
+    delete FDMExec;
+    exit(result ? 0 : -1);
+  }
+
+  // *** COMPILE AN AIRCRAFT AND EXIT *** //
+  if (compile) {
+    FDMExec->SetAircraftPath(SGPath("aircraft"));
+    FDMExec->SetEnginePath(SGPath("engine"));
+    FDMExec->SetSystemsPath(SGPath("systems"));
+
+    result = FDMExec->CompileModel(AircraftName, CompiledModelName);
+
+    if (!result)
+      cerr << "Aircraft " << AircraftName << " was not successfully compiled" << endl;
+    delete FDMExec;
+    exit(result ? 0 : -1);
+  }
+
   // *** OPTION A: LOAD A SCRIPT, WHICH LOADS EVERYTHING ELSE *** //
   if (!ScriptName.isNull()) {
 
@@ -726,6 +759,13 @@ bool options(int count, char **arg)
         gripe;
         exit(1);
       }
+    } else if (keyword == "--montecarlo") {
+      if (n != string::npos) {
+        MonteCarloName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--initfile") {
       if (n != string::npos) {
         ResetName = SGPath::fromLocal8Bit(value.c_str());
@@ -788,6 +828,9 @@ bool options(int count, char **arg)
     } else if (keyword == "--catalog") {
         catalog = true;
         if (!value.empty()) AircraftName=value;
+    } else if (keyword == "--compile") {
+        compile = true;
+        if (!value.empty()) CompiledModelName = SGPath::fromLocal8Bit(value.c_str());
     } else if (keyword.substr(0,2) != "--" && value.empty() ) {
       // See what kind of files we are specifying on the command line
 
@@ -820,7 +863,11 @@ bool options(int count, char **arg)
     cerr << "Cannot specify catalog with script option" << endl << endl;
     result = false;
   }
-  if (!AircraftName.empty() && ResetName.isNull() && !catalog) {
+  if (compile && (AircraftName.empty() || !ScriptName.isNull())) {
+    cerr << "The aircraft to compile must be specified with --aircraft." << endl << endl;
+    result = false;
+  }
+  if (!AircraftName.empty() && ResetName.isNull() && !catalog && !compile) {
     cerr << "You must specify an initialization file with the aircraft name." << endl << endl;
     result = false;
   }
@@ -828,6 +875,10 @@ bool options(int count, char **arg)
     cerr << "You cannot specify an aircraft file with a script." << endl;
     result = false;
   }
+  if (!MonteCarloName.isNull() && (!ScriptName.isNull() || !AircraftName.empty())) {
+    cerr << "The dispersion file specifies the script to run." << endl;
+    result = false;
+  }
 
   return result;
 
@@ -848,12 +899,15 @@ void PrintHelp(void)
     cout << "    --root=<path>  specifies the JSBSim root directory (where aircraft/, engine/, etc. reside)" << endl;
     cout << "    --aircraft=<filename>  specifies the name of the aircraft to be modeled" << endl;
     cout << "    --script=<filename>  specifies a script to run" << endl;
+    cout << "    --montecarlo=<filename>  specifies a dispersion file to run" << endl;
     cout << "    --realtime  specifies to run in actual real world time" << endl;
     cout << "    --nice  specifies to run at lower CPU usage" << endl;
     cout << "    --nohighlight  specifies that console output should be pure text only (no color)" << endl;
     cout << "    --suspend  specifies to suspend the simulation after initialization" << endl;
     cout << "    --initfile=<filename>  specifies an initialization file" << endl;
     cout << "    --planet=<filename>  specifies a planet definition file" << endl;
+    cout << "    --compile[=<filename>] saves the aircraft as a compiled model which is loaded" << endl;
+    cout << "                           without parsing XML (defaults to aircraft/<name>/<name>.jsbbin)" << endl;
     cout << "    --catalog specifies that all properties for this aircraft model should be printed" << endl;
     cout << "              (catalog=aircraftname is an optional format)" << endl;
     cout << "    --property=<name=value> e.g. --property=simulation/integrator/rate/rotational=1" << endl;
@@ -0,0 +1,491 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGMonteCarlo.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Run a batch of dispersed simulations of a script
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class reads a dispersion file, executes the dispersed runs of a script
+over a pool of threads and writes a summary of each run to a results file.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <thread>
+
+#include "FGMonteCarlo.h"
+#include "FGFDMExec.h"
+#include "math/FGCondition.h"
+#include "input_output/FGXMLFileRead.h"
+#include "input_output/string_utilities.h"
+#include "input_output/FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Executive owned by a thread of the pool, with the nodes of the dispersed
+// properties and of the metrics resolved in its property tree.
+struct FGMonteCarlo::Worker {
+  unique_ptr<FGFDMExec> fdmex;
+  vector<SGPropertyNode*> dispersions;
+  vector<double> nominal;
+  vector<SGPropertyNode*> metrics;
+  vector<unique_ptr<FGCondition>> conditions;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGMonteCarlo::FGMonteCarlo(FGFDMExec* fdmex)
+  : FDMExec(fdmex), NumRuns(0), NumThreads(0), Seed(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGMonteCarlo::~FGMonteCarlo()
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::Load(const SGPath& path)
+{
+  SGPath filename = path;
+  if (filename.isRelative())
+    filename = FDMExec->GetRootDir()/path.utf8Str();
+
+  FGXMLFileRead XMLFileRead;
+  Element* el = XMLFileRead.LoadXMLDocument(filename);
+
+  if (!el) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "File: " << filename << " could not be loaded.\n";
+    return false;
+  }
+
+  if (el->GetName() != "monte_carlo") {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "File: " << filename << " is not a dispersion file.\n";
+    return false;
+  }
+
+  document = el;
+  Dispersions.clear();
+  Metrics.clear();
+  Results.clear();
+
+  Name = el->GetAttributeValue("name");
+  NumRuns = 1;
+  if (el->HasAttribute("runs"))
+    NumRuns = static_cast<unsigned int>(el->GetAttributeValueAsNumber("runs"));
+  if (el->HasAttribute("seed"))
+    Seed = static_cast<unsigned int>(el->GetAttributeValueAsNumber("seed"));
+  if (el->HasAttribute("threads"))
+    NumThreads = static_cast<unsigned int>(el->GetAttributeValueAsNumber("threads"));
+
+  Element* script_el = el->FindElement("script");
+  if (!script_el || script_el->GetAttributeValue("file").empty()) {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "A dispersion file must specify a script file.\n";
+    return false;
+  }
+  ScriptFile = SGPath::fromLocal8Bit(script_el->GetAttributeValue("file").c_str());
+
+  ResultsFile = SGPath();
+  Element* output_el = el->FindElement("output");
+  if (output_el) {
+    ResultsFile = SGPath::fromLocal8Bit(output_el->GetAttributeValue("file").c_str());
+    if (ResultsFile.isRelative())
+      ResultsFile = FDMExec->GetOutputPath()/ResultsFile.utf8Str();
+  }
+
+  Element* dispersions_el = el->FindElement("dispersions");
+  if (dispersions_el) {
+    for (unsigned int i=0; i < dispersions_el->GetNumElements(); ++i) {
+      Dispersion dispersion;
+      if (!LoadDispersion(dispersions_el->GetElement(i), dispersion))
+        return false;
+      Dispersions.push_back(dispersion);
+    }
+  }
+
+  Element* metrics_el = el->FindElement("metrics");
+  Element* metric_el = metrics_el ? metrics_el->FindElement("metric") : nullptr;
+  while (metric_el) {
+    Metric metric;
+    metric.property = metric_el->GetDataLine();
+    trim(metric.property);
+    metric.name = metric_el->GetAttributeValue("name");
+    if (metric.name.empty()) metric.name = metric.property;
+    metric.condition = metric_el->FindElement("condition");
+
+    string type = metric_el->GetAttributeValue("type");
+    to_lower(type);
+    if (type.empty() || type == "final")
+      metric.type = eFinal;
+    else if (type == "min")
+      metric.type = eMin;
+    else if (type == "max")
+      metric.type = eMax;
+    else if (type == "mean")
+      metric.type = eMean;
+    else if (type == "first")
+      metric.type = eFirst;
+    else {
+      FGXMLLogging log(FDMExec->GetLogger(), metric_el, LogLevel::ERROR);
+      log << "Unknown metric type: " << type << "\n";
+      return false;
+    }
+
+    if (metric.property.empty() || (metric.type == eFirst && !metric.condition)) {
+      FGXMLLogging log(FDMExec->GetLogger(), metric_el, LogLevel::ERROR);
+      log << "A metric must specify a property and a metric of type \"first\""
+          << " a condition.\n";
+      return false;
+    }
+
+    Metrics.push_back(metric);
+    metric_el = metrics_el->FindNextElement("metric");
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::LoadDispersion(Element* el, Dispersion& dispersion)
+{
+  const string& type = el->GetName();
+  double mean_default = 0.0;
+
+  if (type == "property") {
+    dispersion.property = el->GetDataLine();
+    trim(dispersion.property);
+  } else if (type == "table") {
+    dispersion.property = el->GetAttributeValue("name");
+    if (!dispersion.property.empty())
+      dispersion.property += "/scale-factor";
+    mean_default = 1.0;
+  } else {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "Unknown dispersion: " << type << "\n";
+    return false;
+  }
+
+  if (dispersion.property.empty()) {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "A dispersion must specify a property or a table name.\n";
+    return false;
+  }
+
+  string apply = el->GetAttributeValue("apply");
+  to_lower(apply);
+  if (apply.empty() || apply == "value")
+    dispersion.apply = eValue;
+  else if (apply == "offset")
+    dispersion.apply = eOffset;
+  else if (apply == "scale")
+    dispersion.apply = eScale;
+  else {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "Unknown dispersion mode: " << apply << "\n";
+    return false;
+  }
+
+  string distribution = el->GetAttributeValue("distribution");
+  to_lower(distribution);
+  if (distribution.empty() || distribution == "normal"
+      || distribution == "gaussian") {
+    dispersion.distribution = eNormal;
+    dispersion.a = mean_default;
+    if (el->HasAttribute("mean"))
+      dispersion.a = el->GetAttributeValueAsNumber("mean");
+    dispersion.b = el->GetAttributeValueAsNumber("sigma");
+  } else if (distribution == "uniform") {
+    dispersion.distribution = eUniform;
+    dispersion.a = el->GetAttributeValueAsNumber("min");
+    dispersion.b = el->GetAttributeValueAsNumber("max");
+  } else {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "Unknown distribution: " << distribution << "\n";
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<string> FGMonteCarlo::GetColumnNames(void) const
+{
+  vector<string> names {"run", "seed"};
+
+  for (auto& dispersion: Dispersions)
+    names.push_back(dispersion.property);
+  for (auto& metric: Metrics)
+    names.push_back(metric.name);
+
+  return names;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unique_ptr<FGMonteCarlo::Worker> FGMonteCarlo::MakeWorker(void)
+{
+  auto worker = make_unique<Worker>();
+  worker->fdmex = make_unique<FGFDMExec>();
+  FGFDMExec* fdmex = worker->fdmex.get();
+
+  // The constructor of FGFDMExec resets the debug level.
+  fdmex->SetDebugLevel(0);
+  fdmex->SetRootDir(FDMExec->GetRootDir());
+  fdmex->SetAircraftPath(FDMExec->GetAircraftPath().realpath());
+  fdmex->SetEnginePath(FDMExec->GetEnginePath().realpath());
+  fdmex->SetSystemsPath(FDMExec->GetSystemsPath().realpath());
+  fdmex->SetOutputPath(FDMExec->GetOutputPath().realpath());
+
+  if (!fdmex->LoadScript(ScriptFile)) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Script file " << ScriptFile << " was not successfully loaded\n";
+    return nullptr;
+  }
+  fdmex->DisableOutput();
+
+  auto PropertyManager = fdmex->GetPropertyManager();
+
+  for (auto& dispersion: Dispersions) {
+    SGPropertyNode* node = PropertyManager->GetNode(dispersion.property);
+    if (!node) {
+      FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+      log << "The dispersed property " << dispersion.property
+          << " does not exist.\n";
+      return nullptr;
+    }
+    worker->dispersions.push_back(node);
+    worker->nominal.push_back(node->getDoubleValue());
+  }
+
+  for (auto& metric: Metrics) {
+    SGPropertyNode* node = PropertyManager->GetNode(metric.property);
+    if (!node) {
+      FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+      log << "The property " << metric.property << " of the metric "
+          << metric.name << " does not exist.\n";
+      return nullptr;
+    }
+    worker->metrics.push_back(node);
+    if (metric.condition)
+      worker->conditions.push_back(make_unique<FGCondition>(metric.condition,
+                                                            PropertyManager));
+    else
+      worker->conditions.push_back(nullptr);
+  }
+
+  return worker;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::Run(void)
+{
+  const size_t nDispersions = Dispersions.size();
+  const size_t nMetrics = Metrics.size();
+  const double NaN = numeric_limits<double>::quiet_NaN();
+
+  // Draw all the dispersions beforehand, each from its own stream, so that the
+  // results do not depend on the scheduling of the runs.
+  Results.assign(NumRuns, vector<double>(2 + nDispersions + nMetrics, NaN));
+
+  for (unsigned int run=0; run < NumRuns; ++run) {
+    Results[run][0] = run;
+    Results[run][1] = Seed + run;
+  }
+
+  for (size_t i=0; i < nDispersions; ++i) {
+    const Dispersion& dispersion = Dispersions[i];
+    RandomNumberGenerator generator(Seed,
+      RandomNumberGenerator::StreamId("montecarlo/" + Name + "/"
+                                      + dispersion.property));
+
+    for (unsigned int run=0; run < NumRuns; ++run) {
+      double value;
+      if (dispersion.distribution == eNormal)
+        value = dispersion.a + dispersion.b*generator.GetNormalRandomNumber();
+      else
+        value = dispersion.a + 0.5*(dispersion.b - dispersion.a)
+                               *(generator.GetUniformRandomNumber() + 1.0);
+      Results[run][2+i] = value;
+    }
+  }
+
+  unsigned int nThreads = NumThreads;
+  if (nThreads == 0) nThreads = max(thread::hardware_concurrency(), 1U);
+  nThreads = min(nThreads, max(NumRuns, 1U));
+
+  // The executives are built sequentially: loading the files is not thread
+  // safe.
+  int saved_debug_lvl = FDMExec->GetDebugLevel();
+  vector<unique_ptr<Worker>> workers;
+  for (unsigned int i=0; i < nThreads; ++i) {
+    auto worker = MakeWorker();
+    if (!worker) {
+      FDMExec->SetDebugLevel(saved_debug_lvl);
+      return false;
+    }
+    workers.push_back(std::move(worker));
+  }
+
+  atomic<unsigned int> next_run(0);
+  auto execute_runs = [&](Worker* worker) {
+    unsigned int run;
+    while ((run = next_run++) < NumRuns)
+      Execute(*worker, run, Results[run]);
+  };
+
+  vector<thread> pool;
+  for (unsigned int i=1; i < nThreads; ++i)
+    pool.emplace_back(execute_runs, workers[i].get());
+  if (nThreads > 0) execute_runs(workers[0].get());
+  for (auto& t: pool) t.join();
+
+  workers.clear();
+  FDMExec->SetDebugLevel(saved_debug_lvl);
+
+  return WriteResults();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMonteCarlo::Execute(Worker& worker, unsigned int run, vector<double>& row)
+{
+  FGFDMExec* fdmex = worker.fdmex.get();
+  const size_t nDispersions = Dispersions.size();
+  const size_t nMetrics = Metrics.size();
+  double* metrics = row.data() + 2 + nDispersions;
+  vector<bool> sampled(nMetrics, false);
+  unsigned int nFrames = 0;
+
+  try {
+    // The script properties are reset to their initial value before the
+    // dispersions are applied.
+    fdmex->ResetToInitialConditions(FGFDMExec::DONT_EXECUTE_RUN_IC);
+
+    for (size_t i=0; i < nDispersions; ++i) {
+      double value = row[2+i];
+      switch (Dispersions[i].apply) {
+      case eOffset:
+        value += worker.nominal[i];
+        break;
+      case eScale:
+        value *= worker.nominal[i];
+        break;
+      default:
+        break;
+      }
+      worker.dispersions[i]->setDoubleValue(value);
+    }
+
+    fdmex->SetPropertyValue("simulation/randomseed", Seed + run);
+    if (!fdmex->RunIC())
+      throw BaseException("The initial conditions could not be applied.");
+
+    while (fdmex->Run()) {
+      ++nFrames;
+      for (size_t i=0; i < nMetrics; ++i) {
+        double value = worker.metrics[i]->getDoubleValue();
+        switch (Metrics[i].type) {
+        case eFinal:
+          metrics[i] = value;
+          break;
+        case eMin:
+          metrics[i] = sampled[i] ? min(metrics[i], value) : value;
+          break;
+        case eMax:
+          metrics[i] = sampled[i] ? max(metrics[i], value) : value;
+          break;
+        case eMean:
+          metrics[i] = sampled[i] ? metrics[i] + value : value;
+          break;
+        case eFirst:
+          if (sampled[i] || !worker.conditions[i]->Evaluate()) continue;
+          metrics[i] = value;
+          break;
+        }
+        sampled[i] = true;
+      }
+    }
+
+    for (size_t i=0; i < nMetrics; ++i) {
+      if (Metrics[i].type == eMean && sampled[i])
+        metrics[i] /= nFrames;
+    }
+  } catch (const exception& e) {
+    FGLogging log(fdmex->GetLogger(), LogLevel::ERROR);
+    log << "Run " << run << " of " << Name << " failed: " << e.what() << "\n";
+    fill(metrics, metrics + nMetrics, numeric_limits<double>::quiet_NaN());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::WriteResults(void) const
+{
+  if (ResultsFile.isNull()) return true;
+
+  ofstream results(ResultsFile.utf8Str());
+  if (!results) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Could not open the results file " << ResultsFile << "\n";
+    return false;
+  }
+
+  vector<string> names = GetColumnNames();
+  for (size_t i=0; i < names.size(); ++i)
+    results << (i ? "," : "") << names[i];
+  results << "\n" << setprecision(12);
+
+  for (auto& row: Results) {
+    for (size_t i=0; i < row.size(); ++i)
+      results << (i ? "," : "") << row[i];
+    results << "\n";
+  }
+
+  return true;
+}
+}
@@ -0,0 +1,195 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGMonteCarlo.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGMONTECARLO_H
+#define FGMONTECARLO_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "JSBSim_API.h"
+#include "input_output/FGXMLElement.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Runs a batch of dispersed simulations of a script and collects a summary of
+    each run.
+
+    The batch is described by a dispersion file:
+
+    @code
+    <monte_carlo name="{string}" runs="{integer}" seed="{integer}"
+                 threads="{integer}">
+      <script file="{script file name}"/>
+      <output file="{results file name}"/>
+      <dispersions>
+        <property distribution="normal" mean="{number}" sigma="{number}"
+                  apply="value|offset|scale"> {property name} </property>
+        <property distribution="uniform" min="{number}" max="{number}"
+                  apply="value|offset|scale"> {property name} </property>
+        <table name="{table name}" distribution="..." .../>
+        ...
+      </dispersions>
+      <metrics>
+        <metric name="{string}" type="final|min|max|mean|first">
+          {property name}
+          [<condition> ... </condition>]
+        </metric>
+        ...
+      </metrics>
+    </monte_carlo>
+    @endcode
+
+    Each dispersion draws one value per run. With apply="value" (the default)
+    the property is set to the drawn value, with apply="offset" the value is
+    added to the nominal value of the property and with apply="scale" the
+    nominal value is multiplied by the drawn value. A \<table> dispersion
+    draws the scale factor of a named table: it is a shortcut for a dispersion
+    of the property {table name}/scale-factor whose mean defaults to 1.0.
+
+    A metric is sampled after each time step: "final" keeps the value at the
+    end of the run, "min", "max" and "mean" the extremum or the average over
+    the run and "first" the value at the first time step where its condition
+    is met (for instance the location of the touchdown point). A metric which
+    is never sampled is reported as NaN.
+
+    The runs are distributed over a pool of threads (one per hardware thread by
+    default). Each thread owns an executive that is configured with the paths
+    of the executive passed to the constructor and that loads the script. A run
+    resets the executive, applies its dispersions, seeds the random generators
+    of the executive with seed+{run index} and runs the initial conditions
+    before the script is executed until its end. The draws are made before the runs
+    are started so the results do not depend on the number of threads. The
+    outputs declared by the script and the aircraft are disabled.
+
+    The results are written to a CSV file with one line per run: the index of
+    the run, its seed, the value of the dispersions then the metrics. The paths
+    of the script and of the dispersion file are relative to the root
+    directory and the path of the results file is relative to the output
+    directory.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGMonteCarlo
+{
+public:
+  /** Constructor
+      @param fdmex executive which paths are used to load the script. */
+  explicit FGMonteCarlo(FGFDMExec* fdmex);
+  ~FGMonteCarlo();
+
+  /** Loads a dispersion file.
+      @param path path to the dispersion file
+      @return false if the file is not valid. */
+  bool Load(const SGPath& path);
+
+  /** Executes the runs and writes the results file (if any).
+      @return false if the script could not be loaded or a dispersed property
+              does not exist. */
+  bool Run(void);
+
+  /// Number of runs.
+  unsigned int GetNumRuns(void) const { return NumRuns; }
+  /// Sets the number of runs.
+  void SetNumRuns(unsigned int n) { NumRuns = n; }
+  /// Sets the number of threads. 0 selects one thread per hardware thread.
+  void SetNumThreads(unsigned int n) { NumThreads = n; }
+  /// Sets the seed from which the dispersions are drawn.
+  void SetSeed(unsigned int s) { Seed = s; }
+
+  /// Names of the columns of the results.
+  std::vector<std::string> GetColumnNames(void) const;
+  /// Results of the last call to Run(), one row per run.
+  const std::vector<std::vector<double>>& GetResults(void) const
+  { return Results; }
+
+private:
+  enum eApply {eValue, eOffset, eScale};
+  enum eDistribution {eNormal, eUniform};
+  enum eMetric {eFinal, eMin, eMax, eMean, eFirst};
+
+  struct Dispersion {
+    std::string property;
+    eDistribution distribution;
+    eApply apply;
+    double a, b;        // mean and sigma, or min and max
+  };
+
+  struct Metric {
+    std::string name;
+    std::string property;
+    eMetric type;
+    Element* condition;
+  };
+
+  struct Worker;
+
+  FGFDMExec* FDMExec;
+  std::string Name;
+  SGPath ScriptFile;
+  SGPath ResultsFile;
+  unsigned int NumRuns;
+  unsigned int NumThreads;
+  unsigned int Seed;
+  std::vector<Dispersion> Dispersions;
+  std::vector<Metric> Metrics;
+  std::vector<std::vector<double>> Results;
+  Element_ptr document;
+
+  bool LoadDispersion(Element* el, Dispersion& dispersion);
+  std::unique_ptr<Worker> MakeWorker(void);
+  void Execute(Worker& worker, unsigned int run, std::vector<double>& row);
+  bool WriteResults(void) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
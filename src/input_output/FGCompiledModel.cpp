@@ -0,0 +1,424 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGCompiledModel.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Binary storage of the XML documents of an aircraft
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "FGCompiledModel.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+namespace {
+  thread_local FGCompiledModel* ActiveModel = nullptr;
+
+  const char Magic[8] = {'J', 'S', 'B', 'B', 'I', 'N', '\0', '\0'};
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_strings;
+    uint32_t num_documents;
+    uint32_t padding;
+  };
+
+  size_t Align(size_t n) { return (n + 3) & ~size_t(3); }
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGCompiledModel::FGCompiledModel(const SGPath& root)
+  : Root(root)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompiledModel::~FGCompiledModel()
+{
+  Close();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompiledModel* FGCompiledModel::GetActive(void)
+{
+  return ActiveModel;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompiledModel::Scope::Scope(FGCompiledModel& model)
+  : previous(ActiveModel)
+{
+  ActiveModel = &model;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompiledModel::Scope::~Scope()
+{
+  ActiveModel = previous;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGCompiledModel::GetKey(const SGPath& path) const
+{
+  string name = path.utf8Str();
+  string root = Root.utf8Str();
+  while (!root.empty() && root.back() == '/') root.pop_back();
+
+  if (!root.empty() && name.size() > root.size() && name[root.size()] == '/'
+      && name.compare(0, root.size(), root) == 0)
+    return name.substr(root.size()+1);
+
+  return name;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+uint32_t FGCompiledModel::AddString(const string& s)
+{
+  auto it = string_index.find(s);
+  if (it != string_index.end()) return it->second;
+
+  uint32_t index = static_cast<uint32_t>(strings.size());
+  strings.push_back(s);
+  string_index[s] = index;
+  return index;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompiledModel::AddDocument(const SGPath& path, Element* document)
+{
+  if (!IsRecording() || !document) return;
+
+  string key = GetKey(path);
+  if (document_index.find(key) != document_index.end()) return;
+
+  Document doc;
+  doc.name = AddString(key);
+  doc.modification_time = path.modTime();
+  doc.offset = 0;
+  Serialize(document, doc.nodes);
+  document_index[key] = documents.size();
+  documents.push_back(std::move(doc));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompiledModel::Serialize(Element* el, vector<uint32_t>& nodes)
+{
+  nodes.push_back(AddString(el->GetName()));
+  nodes.push_back(AddString(el->GetFileName()));
+  nodes.push_back(static_cast<uint32_t>(el->GetLineNumber()));
+
+  const auto& attributes = el->GetAttributes();
+  nodes.push_back(static_cast<uint32_t>(attributes.size()));
+  for (const auto& [key, value]: attributes) {
+    nodes.push_back(AddString(*key));
+    nodes.push_back(AddString(value));
+  }
+
+  unsigned int num_lines = el->GetNumDataLines();
+  nodes.push_back(num_lines);
+  for (unsigned int i=0; i<num_lines; ++i)
+    nodes.push_back(AddString(el->GetDataLine(i)));
+
+  unsigned int num_children = el->GetNumElements();
+  nodes.push_back(num_children);
+  for (unsigned int i=0; i<num_children; ++i)
+    Serialize(el->GetElement(i), nodes);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompiledModel::Save(const SGPath& filename) const
+{
+  sg_ofstream file(filename, ios::out | ios::binary | ios::trunc);
+  if (!file.is_open()) return false;
+
+  Header header;
+  memcpy(header.magic, Magic, sizeof(Magic));
+  header.version = Version;
+  header.num_strings = static_cast<uint32_t>(strings.size());
+  header.num_documents = static_cast<uint32_t>(documents.size());
+  header.padding = 0;
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  const char padding[4] {0, 0, 0, 0};
+  for (const auto& s: strings) {
+    uint32_t length = static_cast<uint32_t>(s.size());
+    file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    file.write(s.data(), s.size());
+    file.write(padding, Align(s.size()) - s.size());
+  }
+
+  for (const auto& doc: documents) {
+    uint32_t word[4] {doc.name,
+                      static_cast<uint32_t>(doc.modification_time & 0xFFFFFFFF),
+                      static_cast<uint32_t>(uint64_t(doc.modification_time) >> 32),
+                      static_cast<uint32_t>(doc.nodes.size())};
+    file.write(reinterpret_cast<const char*>(word), sizeof(word));
+    file.write(reinterpret_cast<const char*>(doc.nodes.data()),
+               doc.nodes.size()*sizeof(uint32_t));
+  }
+
+  return file.good();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompiledModel::Open(const SGPath& filename)
+{
+  Close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(filename.wstr().c_str(), GENERIC_READ,
+                            FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) return false;
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+                                      nullptr);
+  if (!mapping) {
+    CloseHandle(file);
+    return false;
+  }
+  void* addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!addr) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+  file_handle = file;
+  mapping_handle = mapping;
+  size = static_cast<size_t>(file_size.QuadPart);
+#else
+  int fd = open(filename.utf8Str().c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  if (fstat(fd, &st) < 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) return false;
+  size = st.st_size;
+#endif
+
+  data = static_cast<const char*>(addr);
+
+  // Validate the layout while building the indices of the strings and of the
+  // documents.
+  const Header* header = reinterpret_cast<const Header*>(data);
+  if (size < sizeof(Header) || memcmp(header->magic, Magic, sizeof(Magic)) != 0
+      || header->version != Version) {
+    Close();
+    return false;
+  }
+
+  size_t pos = sizeof(Header);
+  string_views.reserve(header->num_strings);
+  for (uint32_t i=0; i<header->num_strings; ++i) {
+    uint32_t length;
+    if (pos + sizeof(length) > size) { Close(); return false; }
+    memcpy(&length, data + pos, sizeof(length));
+    pos += sizeof(length);
+    if (pos + length > size) { Close(); return false; }
+    string_views.emplace_back(data + pos, length);
+    pos += Align(length);
+  }
+
+  words = reinterpret_cast<const uint32_t*>(data);
+  num_words = size / sizeof(uint32_t);
+  pos /= sizeof(uint32_t);
+  for (uint32_t i=0; i<header->num_documents; ++i) {
+    if (pos + 4 > num_words || words[pos] >= string_views.size()) {
+      Close();
+      return false;
+    }
+    Document doc;
+    doc.name = words[pos];
+    doc.modification_time = static_cast<int64_t>(uint64_t(words[pos+1])
+                                                 | (uint64_t(words[pos+2]) << 32));
+    size_t count = words[pos+3];
+    doc.offset = pos + 4;
+    pos = doc.offset + count;
+    size_t node = doc.offset;
+    if (pos > num_words || !Validate(node, pos) || node != pos) {
+      Close();
+      return false;
+    }
+    document_index[string(string_views[doc.name])] = documents.size();
+    documents.push_back(std::move(doc));
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompiledModel::Validate(size_t& pos, size_t end) const
+{
+  const size_t num_strings = string_views.size();
+  auto valid_strings = [&](size_t count) {
+    if (pos + count > end) return false;
+    for (size_t i=0; i<count; ++i)
+      if (words[pos+i] >= num_strings) return false;
+    pos += count;
+    return true;
+  };
+
+  if (!valid_strings(2) || pos + 2 > end) return false;
+  size_t num_attributes = words[++pos];
+  ++pos;
+  if (!valid_strings(2*num_attributes) || pos >= end) return false;
+  size_t num_lines = words[pos++];
+  if (!valid_strings(num_lines) || pos >= end) return false;
+  size_t num_children = words[pos++];
+  for (size_t i=0; i<num_children; ++i)
+    if (!Validate(pos, end)) return false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompiledModel::Close(void)
+{
+  if (data) {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mapping_handle);
+    CloseHandle(file_handle);
+    mapping_handle = file_handle = nullptr;
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
+  }
+
+  data = nullptr;
+  words = nullptr;
+  size = num_words = 0;
+  string_views.clear();
+  documents.clear();
+  document_index.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompiledModel::IsUpToDate(void) const
+{
+  for (const auto& doc: documents) {
+    string name = IsRecording() ? strings[doc.name]
+                                : string(string_views[doc.name]);
+    SGPath path = SGPath::fromUtf8(name);
+    if (path.isRelative()) path = Root/name;
+    if (!path.exists() || path.modTime() != doc.modification_time)
+      return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompiledModel::Exists(const SGPath& path) const
+{
+  return document_index.find(GetKey(path)) != document_index.end();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGCompiledModel::LoadDocument(const SGPath& path) const
+{
+  if (IsRecording()) return nullptr;
+
+  auto it = document_index.find(GetKey(path));
+  if (it == document_index.end()) return nullptr;
+
+  size_t pos = documents[it->second].offset;
+  return Instantiate(pos);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGCompiledModel::Instantiate(size_t& pos) const
+{
+  auto str = [&](size_t i) { return string(string_views[words[i]]); };
+
+  Element_ptr el = new Element(str(pos));
+  el->SetFileName(str(pos+1));
+  el->SetLineNumber(static_cast<int>(words[pos+2]));
+  pos += 3;
+
+  uint32_t num_attributes = words[pos++];
+  for (uint32_t i=0; i<num_attributes; ++i, pos+=2)
+    el->AddAttribute(str(pos), str(pos+1));
+
+  uint32_t num_lines = words[pos++];
+  for (uint32_t i=0; i<num_lines; ++i)
+    el->AddData(str(pos++));
+
+  uint32_t num_children = words[pos++];
+  for (uint32_t i=0; i<num_children; ++i) {
+    Element_ptr child = Instantiate(pos);
+    child->SetParent(el);
+    el->AddChildElement(child);
+  }
+
+  return el;
+}
+
+} // namespace JSBSim
@@ -0,0 +1,182 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGCompiledModel.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGCOMPILEDMODEL_H
+#define FGCOMPILEDMODEL_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "JSBSim_API.h"
+#include "input_output/FGXMLElement.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Stores the XML documents read while loading an aircraft in a binary file so
+    that the aircraft can be loaded again without parsing XML.
+
+    A compiled model is recorded by loading the aircraft from its XML files
+    while the model is active (see FGFDMExec::CompileModel()). Each document
+    read by FGXMLFileRead is then serialized as soon as it is parsed: the
+    aircraft file as well as the systems, engines, thrusters, planet and output
+    directives referenced by a file="..." attribute, each under its path
+    relative to the root directory.
+
+    When a compiled model is opened, the file is mapped in memory and the
+    documents are instantiated from it: FGXMLFileRead returns them without
+    parsing XML and the file names are looked up in the compiled model before
+    the file system (see CheckPathName()). The aircraft is therefore built by
+    exactly the same code as from the XML files so the resulting property tree
+    is identical. The files that the compiled model does not contain are read
+    from the file system.
+
+    The file starts with the magic string "JSBBIN" followed by a version
+    number. All the strings (element names, attributes, data lines and file
+    names) are stored once in a string table and the elements are serialized
+    in depth first order as sequences of 32 bit words which refer to that
+    table. The modification time of each source file is stored so that
+    IsUpToDate() can detect that an XML file has been modified, renamed or
+    removed since the model has been compiled.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGCompiledModel
+{
+public:
+  static constexpr uint32_t Version = 1;
+  /// Extension of the compiled model files.
+  static constexpr const char* Extension = ".jsbbin";
+
+  /** Constructor. The model is created in recording mode.
+      @param root directory relative to which the paths are stored */
+  explicit FGCompiledModel(const SGPath& root);
+  ~FGCompiledModel();
+
+  FGCompiledModel(const FGCompiledModel&) = delete;
+  FGCompiledModel& operator=(const FGCompiledModel&) = delete;
+
+  /** Maps a compiled model file in memory.
+      @param filename path to the file
+      @return false if the file could not be read or if its format or version
+              does not match. */
+  bool Open(const SGPath& filename);
+
+  /** Writes the documents that have been recorded.
+      @param filename path to the file
+      @return false if the file could not be written. */
+  bool Save(const SGPath& filename) const;
+
+  /// Returns true until a file has been opened.
+  bool IsRecording(void) const { return data == nullptr; }
+
+  /** Checks that all the source files still exist and that none of them has
+      been modified since the model has been compiled. */
+  bool IsUpToDate(void) const;
+
+  /// Records a document that has just been parsed.
+  void AddDocument(const SGPath& path, Element* document);
+
+  /** Instantiates a document of an opened model.
+      @return nullptr if the model does not contain the document. */
+  Element_ptr LoadDocument(const SGPath& path) const;
+
+  /// Checks if an opened model contains a document.
+  bool Exists(const SGPath& path) const;
+
+  /// Returns the model that is active in the calling thread (if any).
+  static FGCompiledModel* GetActive(void);
+
+  /// Activates a compiled model in the calling thread during its lifetime.
+  class JSBSIM_API Scope {
+  public:
+    explicit Scope(FGCompiledModel& model);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  private:
+    FGCompiledModel* previous;
+  };
+
+private:
+  struct Document {
+    uint32_t name;
+    int64_t modification_time;
+    size_t offset;      // Offset (in words) of the first node
+    std::vector<uint32_t> nodes;
+  };
+
+  SGPath Root;
+  std::vector<std::string> strings;
+  std::unordered_map<std::string, uint32_t> string_index;
+  std::vector<std::string_view> string_views;
+  std::vector<Document> documents;
+  std::unordered_map<std::string, size_t> document_index;
+
+  const char* data = nullptr;
+  size_t size = 0;
+  const uint32_t* words = nullptr;
+  size_t num_words = 0;
+#ifdef _WIN32
+  void* file_handle = nullptr;
+  void* mapping_handle = nullptr;
+#endif
+
+  std::string GetKey(const SGPath& path) const;
+  uint32_t AddString(const std::string& s);
+  void Serialize(Element* el, std::vector<uint32_t>& nodes);
+  Element_ptr Instantiate(size_t& pos) const;
+  bool Validate(size_t& pos, size_t end) const;
+  void Close(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,704 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGCompressedFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Block compressed, seekable text files
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+
+#include "FGCompressedFile.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+const char Magic[] = "JSBLZCSV";
+const char EndMagic[] = "JSBLZEND";
+const size_t MagicSize = 8;
+const uint32_t Version = 1;
+const size_t BlockHeaderSize = 24;
+const size_t IndexEntrySize = 32;
+const size_t FooterSize = 20;
+// Maximum number of blocks waiting to be compressed before Write() blocks.
+const size_t MaxQueuedBlocks = 8;
+
+const unsigned int MinMatch = 4;
+const unsigned int HashLog = 14;
+const size_t MaxOffset = 65535;
+
+void PutU32(string& out, uint32_t v)
+{
+  for (int i=0; i<4; i++) out += static_cast<char>((v >> (8*i)) & 0xff);
+}
+
+void PutU64(string& out, uint64_t v)
+{
+  for (int i=0; i<8; i++) out += static_cast<char>((v >> (8*i)) & 0xff);
+}
+
+void PutDouble(string& out, double v)
+{
+  uint64_t bits;
+  memcpy(&bits, &v, sizeof(bits));
+  PutU64(out, bits);
+}
+
+uint32_t GetU32(const char* p)
+{
+  const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+  return u[0] | (u[1] << 8) | (u[2] << 16) | (static_cast<uint32_t>(u[3]) << 24);
+}
+
+uint64_t GetU64(const char* p)
+{
+  return GetU32(p) | (static_cast<uint64_t>(GetU32(p+4)) << 32);
+}
+
+double GetDouble(const char* p)
+{
+  uint64_t bits = GetU64(p);
+  double v;
+  memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+string BlockHeader(const FGCompressedFile::BlockInfo& block)
+{
+  string out;
+  PutU32(out, block.RawSize);
+  PutU32(out, block.CompressedSize);
+  PutDouble(out, block.StartTime);
+  PutDouble(out, block.EndTime);
+  return out;
+}
+
+inline uint32_t Read32(const char* p)
+{
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline unsigned int Hash(uint32_t v)
+{
+  return (v * 2654435761U) >> (32 - HashLog);
+}
+
+// Lengths that do not fit in the 4 bits of the token are continued with bytes
+// of value 255 terminated by a byte lower than 255.
+void PutLength(string& out, size_t length)
+{
+  for (; length >= 255; length -= 255) out += static_cast<char>(255);
+  out += static_cast<char>(length);
+}
+
+void PutLiterals(string& out, const char* literals, size_t length,
+                 unsigned int matchToken)
+{
+  unsigned int token = (length < 15 ? length : 15) << 4 | matchToken;
+  out += static_cast<char>(token);
+  if (length >= 15) PutLength(out, length - 15);
+  out.append(literals, length);
+}
+
+bool GetLength(const char*& p, const char* end, size_t& length)
+{
+  unsigned char c;
+  do {
+    if (p == end) return false;
+    c = static_cast<unsigned char>(*p++);
+    length += c;
+  } while (c == 255);
+  return true;
+}
+
+void Corrupted(void)
+{
+  throw BaseException("Corrupted compressed data");
+}
+
+void CompressLZ(const char* data, size_t size, string& out)
+{
+  // Positions of the last occurrences of the 4 bytes sequences (offset by 1
+  // so that 0 means none).
+  vector<uint32_t> table(1 << HashLog, 0);
+  size_t anchor = 0, ip = 0;
+
+  while (ip + MinMatch <= size) {
+    uint32_t sequence = Read32(data+ip);
+    unsigned int h = Hash(sequence);
+    size_t ref = table[h];
+    table[h] = static_cast<uint32_t>(ip+1);
+
+    if (ref == 0 || ip - (ref-1) > MaxOffset || Read32(data+ref-1) != sequence) {
+      ip++;
+      continue;
+    }
+
+    ref--;
+    size_t length = MinMatch;
+    while (ip + length < size && data[ref+length] == data[ip+length]) length++;
+
+    size_t matchLength = length - MinMatch;
+    PutLiterals(out, data+anchor, ip-anchor, matchLength < 15 ? matchLength : 15);
+    size_t offset = ip - ref;
+    out += static_cast<char>(offset & 0xff);
+    out += static_cast<char>(offset >> 8);
+    if (matchLength >= 15) PutLength(out, matchLength - 15);
+
+    ip += length;
+    anchor = ip;
+  }
+
+  // The last sequence only contains literals.
+  PutLiterals(out, data+anchor, size-anchor, 0);
+}
+
+void DecompressLZ(const char* data, size_t size, size_t rawSize, string& out)
+{
+  const char* p = data;
+  const char* end = data + size;
+  const size_t start = out.size();
+
+  out.resize(start + rawSize);
+  char* first = &out[start];
+  char* op = first;
+  char* oend = first + rawSize;
+
+  while (p < end) {
+    unsigned int token = static_cast<unsigned char>(*p++);
+    size_t length = token >> 4;
+    if (length == 15 && !GetLength(p, end, length)) Corrupted();
+    if (length > static_cast<size_t>(end - p) ||
+        length > static_cast<size_t>(oend - op)) Corrupted();
+    memcpy(op, p, length);
+    op += length;
+    p += length;
+
+    // The last sequence has no match.
+    if (p == end) break;
+
+    if (end - p < 2) Corrupted();
+    size_t offset = static_cast<unsigned char>(p[0])
+                  | static_cast<unsigned char>(p[1]) << 8;
+    p += 2;
+    length = token & 0x0f;
+    if (length == 15 && !GetLength(p, end, length)) Corrupted();
+    length += MinMatch;
+
+    if (offset == 0 || offset > static_cast<size_t>(op - first) ||
+        length > static_cast<size_t>(oend - op)) Corrupted();
+    const char* match = op - offset;
+    if (offset >= length) {
+      memcpy(op, match, length);
+      op += length;
+    } else {
+      // The match overlaps the bytes it produces.
+      for (size_t i=0; i<length; i++) *op++ = *match++;
+    }
+  }
+
+  if (op != oend) Corrupted();
+}
+
+// The output of the LZ77 stage is then entropy coded with a canonical Huffman
+// code which lengths are limited so that it can be decoded with a single table
+// lookup per byte.
+const unsigned int MaxCodeLength = 12;
+
+void HuffmanLengths(const vector<uint64_t>& frequencies, unsigned char* lengths)
+{
+  vector<uint64_t> f = frequencies;
+
+  while (true) {
+    vector<uint64_t> weights;
+    vector<int> parents, leaves(256, -1);
+    typedef pair<uint64_t, int> Node;
+    priority_queue<Node, vector<Node>, greater<Node>> queue;
+
+    for (unsigned int s=0; s<256; s++) {
+      lengths[s] = 0;
+      if (f[s] == 0) continue;
+      leaves[s] = weights.size();
+      queue.push(Node(f[s], weights.size()));
+      weights.push_back(f[s]);
+      parents.push_back(-1);
+    }
+
+    if (weights.size() == 1) {
+      for (unsigned int s=0; s<256; s++)
+        if (leaves[s] >= 0) lengths[s] = 1;
+      return;
+    }
+
+    while (queue.size() > 1) {
+      Node a = queue.top(); queue.pop();
+      Node b = queue.top(); queue.pop();
+      parents[a.second] = parents[b.second] = weights.size();
+      queue.push(Node(a.first + b.first, weights.size()));
+      weights.push_back(a.first + b.first);
+      parents.push_back(-1);
+    }
+
+    unsigned int maxLength = 0;
+    for (unsigned int s=0; s<256; s++) {
+      if (leaves[s] < 0) continue;
+      unsigned int length = 0;
+      for (int n=leaves[s]; parents[n] >= 0; n=parents[n]) length++;
+      lengths[s] = length;
+      if (length > maxLength) maxLength = length;
+    }
+
+    if (maxLength <= MaxCodeLength) return;
+
+    // Flatten the distribution until the codes are short enough.
+    for (auto& frequency: f)
+      if (frequency > 0) frequency = (frequency + 1) / 2;
+  }
+}
+
+void HuffmanCodes(const unsigned char* lengths, uint32_t* codes)
+{
+  uint32_t code = 0;
+
+  for (unsigned int length=1; length<=MaxCodeLength; length++) {
+    for (unsigned int s=0; s<256; s++)
+      if (lengths[s] == length) codes[s] = code++;
+    code <<= 1;
+  }
+}
+
+// Appends the Huffman coded data to out. Returns false if the data is too
+// small to be worth it.
+bool EncodeHuffman(const string& data, string& out)
+{
+  if (data.size() < 256) return false;
+
+  vector<uint64_t> frequencies(256, 0);
+  for (unsigned char c: data) frequencies[c]++;
+
+  unsigned char lengths[256];
+  uint32_t codes[256];
+  HuffmanLengths(frequencies, lengths);
+  HuffmanCodes(lengths, codes);
+
+  PutU32(out, static_cast<uint32_t>(data.size()));
+  for (unsigned int s=0; s<256; s+=2)
+    out += static_cast<char>(lengths[s] | lengths[s+1] << 4);
+
+  uint64_t bits = 0;
+  unsigned int count = 0;
+  for (unsigned char c: data) {
+    bits = (bits << lengths[c]) | codes[c];
+    count += lengths[c];
+    while (count >= 8) {
+      count -= 8;
+      out += static_cast<char>(bits >> count);
+    }
+  }
+  if (count > 0) out += static_cast<char>(bits << (8 - count));
+
+  return true;
+}
+
+void DecodeHuffman(const char* data, size_t size, string& out)
+{
+  if (size < 132) Corrupted();
+
+  size_t outSize = GetU32(data);
+  unsigned char lengths[256];
+  for (unsigned int s=0; s<256; s+=2) {
+    unsigned char c = static_cast<unsigned char>(data[4 + s/2]);
+    lengths[s] = c & 0x0f;
+    lengths[s+1] = c >> 4;
+  }
+  uint32_t codes[256];
+  HuffmanCodes(lengths, codes);
+
+  // Each entry of the table holds the symbol and the length of its code.
+  vector<uint16_t> table(1 << MaxCodeLength, 0);
+  for (unsigned int s=0; s<256; s++) {
+    unsigned int length = lengths[s];
+    if (length == 0) continue;
+    if (length > MaxCodeLength) Corrupted();
+    uint32_t first = codes[s] << (MaxCodeLength - length);
+    uint32_t last = (codes[s] + 1) << (MaxCodeLength - length);
+    if (last > table.size()) Corrupted();
+    for (uint32_t i=first; i<last; i++) table[i] = s | length << 8;
+  }
+
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(data) + 132;
+  const unsigned char* end = reinterpret_cast<const unsigned char*>(data) + size;
+  uint64_t bits = 0;
+  unsigned int count = 0;
+
+  out.resize(outSize);
+  for (size_t i=0; i<outSize; i++) {
+    while (count < MaxCodeLength) {
+      if (p == end && count == 0) Corrupted();
+      bits = (bits << 8) | (p < end ? *p++ : 0);
+      count += 8;
+    }
+    uint16_t entry = table[(bits >> (count - MaxCodeLength)) & ((1 << MaxCodeLength) - 1)];
+    unsigned int length = entry >> 8;
+    if (length == 0 || length > count) Corrupted();
+    count -= length;
+    out[i] = static_cast<char>(entry & 0xff);
+  }
+}
+
+enum Method {mLZ = 0, mLZHuffman = 1};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFile::Compress(const char* data, size_t size, string& out)
+{
+  string lz;
+  CompressLZ(data, size, lz);
+
+  size_t start = out.size();
+  out += static_cast<char>(mLZHuffman);
+  if (!EncodeHuffman(lz, out) || out.size() - start > lz.size() + 1) {
+    out.resize(start);
+    out += static_cast<char>(mLZ);
+    out += lz;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFile::Decompress(const char* data, size_t size, size_t rawSize,
+                                  string& out)
+{
+  if (size == 0) Corrupted();
+
+  switch (data[0]) {
+  case mLZ:
+    DecompressLZ(data+1, size-1, rawSize, out);
+    break;
+  case mLZHuffman:
+    {
+      string lz;
+      DecodeHuffman(data+1, size-1, lz);
+      DecompressLZ(lz.data(), lz.size(), rawSize, out);
+    }
+    break;
+  default:
+    Corrupted();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompressedFile::IsCompressed(const string& filename)
+{
+  ifstream file(filename, ios::binary);
+  char magic[MagicSize];
+
+  return file.read(magic, MagicSize) && memcmp(magic, Magic, MagicSize) == 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompressedFileWriter::FGCompressedFileWriter(ostream& stream,
+                                               const string& header,
+                                               size_t blockSize)
+  : Stream(stream), BlockSize(blockSize), Closing(false), Closed(false)
+{
+  string out(Magic, MagicSize);
+  PutU32(out, Version);
+  PutU32(out, static_cast<uint32_t>(header.size()));
+  out += header;
+  Stream.write(out.data(), out.size());
+  Offset = out.size();
+
+  Current.Data.reserve(BlockSize);
+  Worker = thread(&FGCompressedFileWriter::Run, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompressedFileWriter::~FGCompressedFileWriter()
+{
+  Close();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFileWriter::Write(const char* record, size_t size, double time)
+{
+  // The time span of a block covers all its records even if the time went
+  // backwards (reset of the simulation time).
+  if (Current.Data.empty())
+    Current.StartTime = Current.EndTime = time;
+  else {
+    Current.StartTime = min(Current.StartTime, time);
+    Current.EndTime = max(Current.EndTime, time);
+  }
+  Current.Data.append(record, size);
+
+  if (Current.Data.size() >= BlockSize) Submit();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFileWriter::Submit(void)
+{
+  {
+    unique_lock<mutex> lock(Mutex);
+    QueueChanged.wait(lock, [this]() { return Queue.size() < MaxQueuedBlocks; });
+    Queue.push_back(std::move(Current));
+  }
+  QueueChanged.notify_all();
+
+  Current = Block();
+  Current.Data.reserve(BlockSize);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFileWriter::Run(void)
+{
+  string compressed;
+
+  while (true) {
+    Block block;
+    {
+      unique_lock<mutex> lock(Mutex);
+      QueueChanged.wait(lock, [this]() { return !Queue.empty() || Closing; });
+      if (Queue.empty()) break;
+      block = std::move(Queue.front());
+      Queue.pop_front();
+    }
+    QueueChanged.notify_all();
+
+    compressed.clear();
+    FGCompressedFile::Compress(block.Data.data(), block.Data.size(), compressed);
+
+    FGCompressedFile::BlockInfo info;
+    info.Offset = Offset;
+    info.RawSize = static_cast<uint32_t>(block.Data.size());
+    info.CompressedSize = static_cast<uint32_t>(compressed.size());
+    info.StartTime = block.StartTime;
+    info.EndTime = block.EndTime;
+
+    string header = BlockHeader(info);
+    Stream.write(header.data(), header.size());
+    Stream.write(compressed.data(), compressed.size());
+    // Complete blocks can be recovered if the file is not closed properly.
+    Stream.flush();
+
+    Offset += header.size() + compressed.size();
+    Index.push_back(info);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFileWriter::Close(void)
+{
+  if (Closed) return;
+  Closed = true;
+
+  if (!Current.Data.empty()) Submit();
+
+  {
+    lock_guard<mutex> lock(Mutex);
+    Closing = true;
+  }
+  QueueChanged.notify_all();
+  Worker.join();
+
+  string out;
+  for (auto& block: Index) {
+    PutU64(out, block.Offset);
+    PutU32(out, block.RawSize);
+    PutU32(out, block.CompressedSize);
+    PutDouble(out, block.StartTime);
+    PutDouble(out, block.EndTime);
+  }
+  PutU64(out, Offset);
+  PutU32(out, static_cast<uint32_t>(Index.size()));
+  out.append(EndMagic, MagicSize);
+
+  Stream.write(out.data(), out.size());
+  Stream.flush();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGCompressedFileReader::FGCompressedFileReader(const string& filename)
+  : File(filename, ios::binary)
+{
+  if (!File)
+    throw BaseException("Unable to open the file " + filename);
+
+  char header[MagicSize+8];
+  if (!File.read(header, sizeof(header)) || memcmp(header, Magic, MagicSize) != 0)
+    throw BaseException(filename + " is not a compressed file");
+  uint32_t version = GetU32(header+MagicSize);
+  if (version != Version)
+    throw BaseException(filename + " uses version " + to_string(version)
+                        + " of the compressed format but only version "
+                        + to_string(Version) + " is supported");
+
+  Header.resize(GetU32(header+MagicSize+4));
+  if (!File.read(&Header[0], Header.size()))
+    throw BaseException(filename + " is truncated");
+
+  uint64_t start = File.tellg();
+  File.seekg(0, ios::end);
+  uint64_t fileSize = File.tellg();
+
+  if (!ReadIndex(fileSize)) ScanBlocks(start, fileSize);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGCompressedFileReader::ReadIndex(uint64_t fileSize)
+{
+  if (fileSize < FooterSize) return false;
+
+  char footer[FooterSize];
+  File.seekg(fileSize - FooterSize);
+  if (!File.read(footer, FooterSize) || memcmp(footer+12, EndMagic, MagicSize) != 0)
+    return false;
+
+  uint64_t indexOffset = GetU64(footer);
+  uint32_t numBlocks = GetU32(footer+8);
+  if (indexOffset + uint64_t(numBlocks)*IndexEntrySize + FooterSize != fileSize)
+    return false;
+
+  string index(numBlocks*IndexEntrySize, '\0');
+  File.seekg(indexOffset);
+  if (numBlocks > 0 && !File.read(&index[0], index.size())) return false;
+
+  Index.resize(numBlocks);
+  for (unsigned int i=0; i<numBlocks; i++) {
+    const char* p = index.data() + i*IndexEntrySize;
+    Index[i].Offset = GetU64(p);
+    Index[i].RawSize = GetU32(p+8);
+    Index[i].CompressedSize = GetU32(p+12);
+    Index[i].StartTime = GetDouble(p+16);
+    Index[i].EndTime = GetDouble(p+24);
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGCompressedFileReader::ScanBlocks(uint64_t start, uint64_t fileSize)
+{
+  // The file was not closed: the index is rebuilt from the block headers and
+  // an incomplete block at the end of the file is ignored.
+  uint64_t offset = start;
+  char header[BlockHeaderSize];
+
+  File.clear();
+  while (offset + BlockHeaderSize <= fileSize) {
+    File.seekg(offset);
+    if (!File.read(header, BlockHeaderSize)) break;
+
+    FGCompressedFile::BlockInfo block;
+    block.Offset = offset;
+    block.RawSize = GetU32(header);
+    block.CompressedSize = GetU32(header+4);
+    block.StartTime = GetDouble(header+8);
+    block.EndTime = GetDouble(header+16);
+
+    offset += BlockHeaderSize + block.CompressedSize;
+    if (offset > fileSize) break;
+    Index.push_back(block);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGCompressedFileReader::ReadBlock(size_t i)
+{
+  const FGCompressedFile::BlockInfo& block = Index.at(i);
+  string compressed(block.CompressedSize, '\0');
+  string raw;
+
+  File.clear();
+  File.seekg(block.Offset + BlockHeaderSize);
+  if (!File.read(&compressed[0], compressed.size())) Corrupted();
+
+  FGCompressedFile::Decompress(compressed.data(), compressed.size(),
+                               block.RawSize, raw);
+  return raw;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGCompressedFileReader::Read(void)
+{
+  string text = Header;
+
+  for (size_t i=0; i<Index.size(); i++)
+    text += ReadBlock(i);
+
+  return text;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGCompressedFileReader::Read(double start, double end)
+{
+  string text = Header;
+
+  for (size_t i=0; i<Index.size(); i++) {
+    if (Index[i].EndTime < start || Index[i].StartTime > end) continue;
+
+    string block = ReadBlock(i);
+    size_t pos = 0;
+    while (pos < block.size()) {
+      size_t eol = block.find('\n', pos);
+      eol = eol == string::npos ? block.size() : eol + 1;
+      double time = strtod(block.c_str() + pos, nullptr);
+      if (time >= start && time <= end) text.append(block, pos, eol - pos);
+      pos = eol;
+    }
+  }
+
+  return text;
+}
+}
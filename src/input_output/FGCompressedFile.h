@@ -0,0 +1,216 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGCompressedFile.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGCOMPRESSEDFILE_H
+#define FGCOMPRESSEDFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FGJSBBase.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Compressed text files made of independent blocks.
+
+    The records written to a compressed file are gathered in blocks of about
+    BlockSize bytes which never split a record. Each block is compressed on
+    its own so that it can be decompressed without reading the rest of the
+    file: a byte oriented LZ77 stage (the sequence format is the same as the
+    LZ4 block format) followed by a canonical Huffman coding of its output,
+    which is skipped when it does not make the block smaller.
+
+    The file starts with the magic string "JSBLZCSV", a version number and
+    the header line of the text file. Each block is preceded by its raw and
+    compressed sizes and by the smallest and largest times of its records,
+    which are the times of its first and last records unless the simulation
+    time has been reset while the block was written. When the file is closed,
+    an index of the blocks is appended followed by a footer that gives the
+    position of the index. The index allows a reader to decompress only the
+    blocks that overlap a time window. If a file was not closed properly, the
+    index is rebuilt by walking through the blocks.
+
+    All the numbers are stored in little endian order.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace FGCompressedFile {
+
+/// Location and time span of a block.
+struct BlockInfo {
+  uint64_t Offset;
+  uint32_t RawSize;
+  uint32_t CompressedSize;
+  double StartTime;
+  double EndTime;
+};
+
+/** Compresses a block.
+    @param data the data to compress
+    @param size the number of bytes to compress
+    @param out the string to which the compressed data is appended */
+JSBSIM_API void Compress(const char* data, size_t size, std::string& out);
+
+/** Decompresses a block.
+    @param data the compressed data
+    @param size the number of bytes of compressed data
+    @param rawSize the number of bytes of the data once decompressed
+    @param out the string to which the decompressed data is appended
+    @throws BaseException if the data is corrupted */
+JSBSIM_API void Decompress(const char* data, size_t size, size_t rawSize,
+                           std::string& out);
+
+/** Checks whether a file is a compressed file.
+    @param filename the name of the file
+    @return true if the file starts with the magic string of the format */
+JSBSIM_API bool IsCompressed(const std::string& filename);
+}
+
+/** Writes the records of a text file to a compressed file.
+    The compression and the writing to the stream are performed by a
+    background thread: Write() only copies the record in the current block.
+    The stream must not be used by the caller until Close() has returned.
+ */
+class JSBSIM_API FGCompressedFileWriter
+{
+public:
+  static constexpr size_t DefaultBlockSize = 256*1024;
+
+  /** Constructor.
+      @param stream the binary stream to which the file is written
+      @param header the first line(s) of the text file
+      @param blockSize the size of the blocks of raw data */
+  FGCompressedFileWriter(std::ostream& stream, const std::string& header,
+                         size_t blockSize = DefaultBlockSize);
+  /// Destructor: closes the file.
+  ~FGCompressedFileWriter();
+
+  /** Appends a record.
+      @param record the characters of the record, end of line included
+      @param size the number of characters
+      @param time the time of the record */
+  void Write(const char* record, size_t size, double time);
+
+  /** Compresses the last block, waits for the background thread to complete
+      and writes the index of the blocks. */
+  void Close(void);
+
+private:
+  struct Block {
+    std::string Data;
+    double StartTime = 0.0;
+    double EndTime = 0.0;
+  };
+
+  std::ostream& Stream;
+  size_t BlockSize;
+  Block Current;
+  std::deque<Block> Queue;
+  std::vector<FGCompressedFile::BlockInfo> Index;
+  uint64_t Offset;
+  bool Closing;
+  bool Closed;
+  std::mutex Mutex;
+  std::condition_variable QueueChanged;
+  std::thread Worker;
+
+  void Submit(void);
+  void Run(void);
+};
+
+/** Reads a compressed file.
+    The whole file can be decompressed with Read() or only the records within
+    a time window with Read(double, double). The text is returned with its
+    header line so that it can be parsed as the original text file.
+ */
+class JSBSIM_API FGCompressedFileReader
+{
+public:
+  /** Constructor. Reads the header and the index of the blocks.
+      @param filename the name of the compressed file
+      @throws BaseException if the file cannot be read or is not a compressed
+              file */
+  explicit FGCompressedFileReader(const std::string& filename);
+
+  /// Returns the header line(s) of the text file.
+  const std::string& GetHeader(void) const { return Header; }
+  /// Returns the number of blocks.
+  size_t GetNumBlocks(void) const { return Index.size(); }
+  /// Returns the location and time span of a block.
+  const FGCompressedFile::BlockInfo& GetBlock(size_t i) const { return Index[i]; }
+
+  /** Decompresses a block.
+      @param i the index of the block
+      @return the records of the block, without the header */
+  std::string ReadBlock(size_t i);
+  /// Decompresses the whole file, header included.
+  std::string Read(void);
+  /** Decompresses the records whose time (first column) lies in [start, end].
+      Only the blocks overlapping the time window are decompressed. The time
+      does not need to increase: the records of all the runs that went through
+      the window are returned, in the order of the file.
+      @return the records within the window, preceded by the header */
+  std::string Read(double start, double end);
+
+private:
+  std::ifstream File;
+  std::string Header;
+  std::vector<FGCompressedFile::BlockInfo> Index;
+
+  bool ReadIndex(uint64_t fileSize);
+  void ScanBlocks(uint64_t start, uint64_t fileSize);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
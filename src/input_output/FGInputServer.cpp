@@ -0,0 +1,651 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGInputServer.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Serve several telnet clients simultaneously
+ Called by:    FGInput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class listens to a TCP port and serves the telnet commands of several
+clients without blocking the simulation.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if defined(_MSC_VER) || defined(__MINGW32__)
+#include <ws2tcpip.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "FGInputServer.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "string_utilities.h"
+#include "FGLog.h"
+
+using namespace std;
+
+// Defines that make BSD/Unix sockets and Windows sockets syntax look alike.
+#ifndef _WIN32
+#define closesocket close
+#define INVALID_SOCKET -1
+#define SOCKET_ERROR -1
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace JSBSim {
+
+// Clients which do not read their replies are disconnected once this amount of
+// data is waiting to be sent to them.
+static const size_t MaxPendingOutput = 1 << 20;
+// Clients sending lines longer than this are disconnected.
+static const size_t MaxPendingInput = 1 << 16;
+
+static bool WouldBlock(void)
+{
+#ifdef _WIN32
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EWOULDBLOCK || errno == EAGAIN || errno == EINTR;
+#endif
+}
+
+static string SocketError(void)
+{
+#ifdef _WIN32
+  return "error code " + to_string(WSAGetLastError());
+#else
+  return strerror(errno);
+#endif
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGInputServer::FGInputServer(FGFDMExec* fdmex) :
+  FGInputSocket(fdmex), MaxClients(16), Budget(1E-3), Precision(7),
+  ListenSocket(INVALID_SOCKET), PollHandle(-1), NextClient(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGInputServer::~FGInputServer()
+{
+  Close();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::SetNonBlocking(socket_t sckt)
+{
+#ifdef _WIN32
+  u_long NoBlock = 1;
+  ioctlsocket(sckt, FIONBIO, &NoBlock);
+#else
+  int flags = fcntl(sckt, F_GETFL, 0);
+  fcntl(sckt, F_SETFL, flags | O_NONBLOCK);
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputServer::Load(Element* el)
+{
+  if (!FGInputSocket::Load(el))
+    return false;
+
+  if (el->HasAttribute("clients")) {
+    int clients = atoi(el->GetAttributeValue("clients").c_str());
+    if (clients <= 0) {
+      FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+      log << "The number of clients must be a positive integer\n";
+      return false;
+    }
+    MaxClients = clients;
+  }
+
+  if (el->HasAttribute("budget")) {
+    double budget = el->GetAttributeValueAsNumber("budget");
+    if (budget < 0.0) {
+      FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+      log << "The time budget cannot be negative\n";
+      return false;
+    }
+    Budget = budget * 1E-3;
+  }
+
+  if (el->HasAttribute("precision")) {
+    int precision = atoi(el->GetAttributeValue("precision").c_str());
+    if (precision > 0) Precision = precision;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputServer::InitModel(void)
+{
+  // FGInputSocket::InitModel() is bypassed as it would open a single client
+  // socket.
+  if (!FGInputType::InitModel()) return false;
+
+  // The clients remain connected when the simulation is reset.
+  if (ListenSocket != INVALID_SOCKET) return true;
+
+#ifdef _WIN32
+  WSADATA wsaData;
+  if (WSAStartup(MAKEWORD(1, 1), &wsaData)) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Winsock DLL not initialized ...\n";
+    return false;
+  }
+#endif
+
+  ListenSocket = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (ListenSocket == INVALID_SOCKET) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Could not create TCP server socket: " << SocketError() << "\n";
+    return false;
+  }
+
+  int reuse = 1;
+  setsockopt(ListenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse,
+             sizeof(reuse));
+
+  struct sockaddr_in scktName;
+  memset(&scktName, 0, sizeof(struct sockaddr_in));
+  scktName.sin_family = AF_INET;
+  scktName.sin_port = htons(SockPort);
+  scktName.sin_addr.s_addr = htonl(INADDR_ANY);
+
+  if (bind(ListenSocket, (struct sockaddr*)&scktName, sizeof(scktName)) == SOCKET_ERROR
+      || listen(ListenSocket, MaxClients) == SOCKET_ERROR) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Could not listen to TCP port " << SockPort << ": " << SocketError()
+        << "\n";
+    Close();
+    return false;
+  }
+
+  SetNonBlocking(ListenSocket);
+
+#ifdef __linux__
+  PollHandle = epoll_create1(EPOLL_CLOEXEC);
+  struct epoll_event event;
+  event.events = EPOLLIN;
+  event.data.fd = ListenSocket;
+  if (PollHandle < 0
+      || epoll_ctl(PollHandle, EPOLL_CTL_ADD, ListenSocket, &event) < 0) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << "Could not initialize epoll: " << SocketError() << "\n";
+    Close();
+    return false;
+  }
+#endif
+
+  if (debug_lvl > 0) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::INFO);
+    log << "Listening to TCP port " << SockPort << " for up to " << MaxClients
+        << " clients\n";
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Close(void)
+{
+  for (auto& client: Clients)
+    closesocket(client.sckt);
+  Clients.clear();
+
+#ifdef __linux__
+  if (PollHandle >= 0) close(PollHandle);
+#endif
+  PollHandle = -1;
+
+  if (ListenSocket != INVALID_SOCKET) closesocket(ListenSocket);
+  ListenSocket = INVALID_SOCKET;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Read(bool Holding)
+{
+  if (ListenSocket == INVALID_SOCKET) return;
+
+  Poll(Holding);
+
+  // Execute the commands one at a time for each client in turn so that a busy
+  // client cannot starve the others when the time budget is exhausted.
+  auto start = chrono::steady_clock::now();
+  bool executed = true;
+
+  while (executed && !Clients.empty()) {
+    executed = false;
+    size_t n = Clients.size();
+
+    for (size_t i=0; i < n; ++i) {
+      Client& client = Clients[(NextClient + i) % n];
+      string line;
+
+      if (!client.connected || client.closing) continue;
+      if (!NextCommand(client, line)) continue;
+
+      ExecuteClientCommand(client, line, Holding);
+      executed = true;
+
+      chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+      if (Budget > 0.0 && elapsed.count() >= Budget) {
+        NextClient = (NextClient + i + 1) % n;
+        executed = false;
+        break;
+      }
+    }
+  }
+
+  double simTime = FDMExec->GetSimTime();
+
+  for (auto& client: Clients) {
+    if (client.connected && !client.closing) Publish(client, simTime);
+    Flush(client);
+  }
+
+  RemoveDisconnected();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Poll(bool Holding)
+{
+  // Block only if requested and if there is no command left over from the
+  // previous time step.
+  bool block = BlockingInput && !Clients.empty() && !HasPendingCommands();
+
+#ifdef __linux__
+  const int MaxEvents = 64;
+  struct epoll_event events[MaxEvents];
+  bool accept = false;
+
+  int nfds = epoll_wait(PollHandle, events, MaxEvents, block ? -1 : 0);
+
+  for (int i=0; i < nfds; ++i) {
+    int fd = events[i].data.fd;
+
+    if (fd == ListenSocket) {
+      accept = true;
+      continue;
+    }
+
+    for (auto& client: Clients) {
+      if (client.sckt == fd) {
+        Receive(client);
+        break;
+      }
+    }
+  }
+
+  if (accept) Accept();
+#else
+  fd_set fds;
+  socket_t maxfd = ListenSocket;
+  struct timeval timeout = {0, 0};
+
+  FD_ZERO(&fds);
+  FD_SET(ListenSocket, &fds);
+  for (auto& client: Clients) {
+    FD_SET(client.sckt, &fds);
+    maxfd = max(maxfd, client.sckt);
+  }
+
+  int result = select(maxfd+1, &fds, nullptr, nullptr,
+                      block ? nullptr : &timeout);
+  if (result == SOCKET_ERROR || result == 0) return;
+
+  for (auto& client: Clients) {
+    if (FD_ISSET(client.sckt, &fds))
+      Receive(client);
+  }
+
+  if (FD_ISSET(ListenSocket, &fds)) Accept();
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Accept(void)
+{
+  while (true) {
+    socket_t sckt = accept(ListenSocket, nullptr, nullptr);
+    if (sckt == INVALID_SOCKET) break;
+
+    if (Clients.size() >= MaxClients) {
+      const char msg[] = "Too many clients connected to JSBSim server\r\n";
+      send(sckt, msg, sizeof(msg)-1, MSG_NOSIGNAL);
+      closesocket(sckt);
+      continue;
+    }
+
+    SetNonBlocking(sckt);
+
+#ifdef __linux__
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.fd = sckt;
+    if (epoll_ctl(PollHandle, EPOLL_CTL_ADD, sckt, &event) < 0) {
+      FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+      log << "Could not register client socket: " << SocketError() << "\n";
+      closesocket(sckt);
+      continue;
+    }
+#endif
+
+    Client client;
+    client.sckt = sckt;
+    client.output = "Connected to JSBSim server\r\nJSBSim> ";
+    Clients.push_back(client);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Receive(Client& client)
+{
+  char buf[1024];
+
+  while (true) {
+    int num_chars = recv(client.sckt, buf, sizeof buf, 0);
+
+    if (num_chars > 0) {
+      client.input.append(buf, num_chars);
+      continue;
+    }
+
+    // The client has closed the connection or an error occurred.
+    if (num_chars == 0 || !WouldBlock())
+      client.connected = false;
+
+    break;
+  }
+
+  if (client.input.size() > MaxPendingInput) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::WARN);
+    log << "Disconnecting a client that sent an excessively long command\n";
+    client.connected = false;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Flush(Client& client)
+{
+  size_t sent = 0;
+
+  while (client.connected && sent < client.output.size()) {
+    int num_chars = send(client.sckt, client.output.data() + sent,
+                         client.output.size() - sent, MSG_NOSIGNAL);
+
+    if (num_chars == SOCKET_ERROR) {
+      if (!WouldBlock()) client.connected = false;
+      break;
+    }
+
+    sent += num_chars;
+  }
+
+  client.output.erase(0, sent);
+
+  if (client.output.size() > MaxPendingOutput) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::WARN);
+    log << "Disconnecting a client that does not read its replies\n";
+    client.connected = false;
+  }
+
+  if (client.closing && client.output.empty())
+    client.connected = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::RemoveDisconnected(void)
+{
+  auto it = remove_if(Clients.begin(), Clients.end(),
+                      [](const Client& client) {
+                        if (!client.connected) closesocket(client.sckt);
+                        return !client.connected;
+                      });
+
+  if (it != Clients.end()) {
+    Clients.erase(it, Clients.end());
+    NextClient = 0;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputServer::HasPendingCommands(void) const
+{
+  for (auto& client: Clients) {
+    if (client.input.find_first_of("\r\n") != string::npos)
+      return true;
+  }
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputServer::NextCommand(Client& client, string& line)
+{
+  while (true) {
+    size_t string_start = client.input.find_first_not_of("\r\n");
+    if (string_start == string::npos) {
+      client.input.clear();
+      return false;
+    }
+    size_t string_end = client.input.find_first_of("\r\n", string_start);
+    if (string_end == string::npos) {
+      client.input.erase(0, string_start);
+      return false;
+    }
+
+    line = client.input.substr(string_start, string_end-string_start);
+    client.input.erase(0, string_end);
+    trim(line);
+
+    if (!line.empty()) return true;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::ExecuteClientCommand(Client& client, const string& line,
+                                         bool Holding)
+{
+  vector<string> tokens = split(line, ' ');
+  string command = to_lower(tokens[0]);
+  char buf[64];
+
+  if (command == "get" && tokens.size() > 2) {  // GET MANY PROPERTIES
+    for (size_t i=1; i < tokens.size(); ++i) {
+      SGPropertyNode* node = nullptr;
+
+      try {
+        node = PropertyManager->GetNode(tokens[i]);
+      } catch(...) {}
+
+      client.output += tokens[i];
+      if (!node || !node->hasValue())
+        client.output += ": Unknown property\r\n";
+      else {
+        snprintf(buf, sizeof(buf), " = %12.6g\r\n", node->getDoubleValue());
+        client.output += buf;
+      }
+    }
+
+  } else if (command == "subscribe") {          // SUBSCRIBE
+    Subscription subscription;
+    double rate = 0.0;
+
+    if (tokens.size() < 3) {
+      client.output += "Expecting a rate and at least one property.\r\n";
+      client.output += "JSBSim> ";
+      return;
+    }
+
+    try {
+      rate = atof_locale_c(tokens[1]);
+    } catch(InvalidNumber& e) {
+      client.output += string(e.what()) + "\r\nJSBSim> ";
+      return;
+    }
+
+    if (rate <= 0.0) {
+      client.output += "The rate must be a positive number.\r\nJSBSim> ";
+      return;
+    }
+
+    for (size_t i=2; i < tokens.size(); ++i) {
+      SGPropertyNode* node = nullptr;
+
+      try {
+        node = PropertyManager->GetNode(tokens[i]);
+      } catch(...) {}
+
+      if (!node || !node->hasValue()) {
+        client.output += "Unknown property " + tokens[i] + "\r\nJSBSim> ";
+        return;
+      }
+
+      subscription.nodes.push_back(node);
+    }
+
+    subscription.id = client.nextId++;
+    subscription.period = 1.0 / rate;
+    subscription.next = FDMExec->GetSimTime();
+    client.subscriptions.push_back(subscription);
+
+    client.output += "Subscription " + to_string(subscription.id) + "\r\n";
+
+  } else if (command == "unsubscribe") {        // UNSUBSCRIBE
+    auto& subs = client.subscriptions;
+
+    if (tokens.size() == 1) {
+      subs.clear();
+      client.output += "Unsubscribed\r\n";
+    } else {
+      unsigned int id = atoi(tokens[1].c_str());
+      auto it = remove_if(subs.begin(), subs.end(),
+                          [id](const Subscription& s) { return s.id == id; });
+      if (it == subs.end())
+        client.output += "Unknown subscription\r\n";
+      else {
+        subs.erase(it, subs.end());
+        client.output += "Unsubscribed\r\n";
+      }
+    }
+
+  } else {
+    string reply;
+
+    if (ExecuteCommand(line, reply, Holding) == CommandStatus::Quit) {
+      client.output += reply;
+      client.closing = true;
+      return;
+    }
+
+    client.output += reply;
+  }
+
+  client.output += "JSBSim> ";
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputServer::Publish(Client& client, double simTime)
+{
+  char buf[64];
+
+  for (auto& sub: client.subscriptions) {
+    // The simulation time went backward: the simulation has been reset.
+    if (simTime < sub.next - sub.period) sub.next = simTime;
+    if (simTime < sub.next) continue;
+
+    snprintf(buf, sizeof(buf), "%u,%.*g", sub.id, Precision, simTime);
+    client.output += buf;
+
+    for (auto& node: sub.nodes) {
+      snprintf(buf, sizeof(buf), ",%.*g", Precision, node->getDoubleValue());
+      client.output += buf;
+    }
+    client.output += "\r\n";
+
+    // Do not try to catch up with the updates that have been missed.
+    sub.next += sub.period;
+    if (sub.next <= simTime) sub.next = simTime + sub.period;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGInputServer::GetHelp(void) const
+{
+  return
+    " JSBSim Server commands:\r\n\r\n"
+    "   get {property name} [{property name} ...]\r\n"
+    "   set {property name} {value}\r\n"
+    "   subscribe {rate} {property name} [{property name} ...]\r\n"
+    "   unsubscribe [{subscription id}]\r\n"
+    "   hold\r\n"
+    "   resume\r\n"
+    "   iterate {value}\r\n"
+    "   help\r\n"
+    "   quit\r\n"
+    "   info\r\n\r\n";
+}
+
+}
@@ -0,0 +1,164 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGInputServer.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGINPUTSERVER_H
+#define FGINPUTSERVER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#include "FGInputSocket.h"
+#include "simgear/props/props.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements a multi-client telnet server. Unlike FGInputSocket which serves a
+    single client, this class accepts several simultaneous TCP connections and
+    multiplexes them without ever blocking the simulation: sockets are polled
+    with epoll on Linux (select elsewhere) and all reads and writes are
+    non-blocking.
+
+    The commands received during a time step are executed in a round robin
+    fashion among the clients until the time budget allotted to the server is
+    exhausted. Unprocessed commands are kept for the next time step.
+
+    In addition to the commands of FGInputSocket, the server understands:
+    - <tt>get {property 1} {property 2} ...</tt> which replies the value of
+      several properties in a single message.
+    - <tt>subscribe {rate} {property 1} {property 2} ...</tt> which streams the
+      values of the properties at the requested rate (in Hz of simulation
+      time). Each update is sent as a line
+      <tt>{subscription id},{sim time},{value 1},{value 2},...</tt>
+    - <tt>unsubscribe [{subscription id}]</tt> which stops one or all the
+      subscriptions of the client.
+
+    The server is configured with the following XML directives:
+@code
+<input type="SERVER" port="1137" clients="16" budget="1.0" precision="7"/>
+@endcode
+    - <tt>clients</tt> is the maximum number of simultaneous connections
+      (default 16).
+    - <tt>budget</tt> is the maximum time in milliseconds spent executing
+      commands at each time step (default 1 ms, 0 means no limit).
+    - <tt>precision</tt> is the number of significant digits of the
+      subscription updates (default 7).
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGInputServer : public FGInputSocket
+{
+public:
+  /** Constructor. */
+  FGInputServer(FGFDMExec* fdmex);
+
+  /** Destructor. */
+  ~FGInputServer() override;
+
+  /** Init the input directives from an XML file.
+      @param element XML Element that is pointing to the input directives
+  */
+  bool Load(Element* el) override;
+
+  /** Initializes the instance. This method opens the listening socket.
+      @result true if the execution succeeded.
+   */
+  bool InitModel(void) override;
+
+  /// Serves the connected clients.
+  void Read(bool Holding) override;
+
+protected:
+  std::string GetHelp(void) const override;
+
+private:
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  typedef SOCKET socket_t;
+#else
+  typedef int socket_t;
+#endif
+
+  struct Subscription {
+    unsigned int id;
+    double period;
+    double next;
+    std::vector<SGPropertyNode_ptr> nodes;
+  };
+
+  struct Client {
+    socket_t sckt;
+    std::string input;
+    std::string output;
+    std::vector<Subscription> subscriptions;
+    unsigned int nextId = 1;
+    bool connected = true;
+    bool closing = false;
+  };
+
+  unsigned int MaxClients;
+  double Budget;
+  int Precision;
+  socket_t ListenSocket;
+  int PollHandle;
+  size_t NextClient;
+  std::vector<Client> Clients;
+
+  static void SetNonBlocking(socket_t sckt);
+  void Close(void);
+  void Poll(bool Holding);
+  void Accept(void);
+  void Receive(Client& client);
+  void Flush(Client& client);
+  void RemoveDisconnected(void);
+  bool HasPendingCommands(void) const;
+  bool NextCommand(Client& client, std::string& line);
+  void ExecuteClientCommand(Client& client, const std::string& line,
+                            bool Holding);
+  void Publish(Client& client, double simTime);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,132 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGInputSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Manage input of properties from a shared memory segment
+ Called by:    FGInput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class reads the values published in a shared memory segment by another
+process and copies them to the properties of the same name.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGInputSharedMemory.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGInputSharedMemory::FGInputSharedMemory(FGFDMExec* fdmex) :
+  FGInputType(fdmex)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::Load(Element* el)
+{
+  if (!FGInputType::Load(el))
+    return false;
+
+  string name = el->GetAttributeValue("name");
+  if (name.empty()) {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "The name of the shared memory segment is missing\n";
+    return false;
+  }
+
+  SetInputName(name);
+
+  if (el->HasAttribute("rate")) {
+    double rate = el->GetAttributeValueAsNumber("rate");
+    if (rate > 0.0)
+      SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*rate));
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::InitModel(void)
+{
+  if (!FGInputType::InitModel())
+    return false;
+
+  Segment.Close();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGInputSharedMemory::Bind(void)
+{
+  if (!Segment.Open(Name)) return false;
+
+  unsigned int count = Segment.GetNumValues();
+  Values.resize(count);
+  Nodes.resize(count);
+
+  for (unsigned int i=0; i < count; ++i) {
+    string name = Segment.GetName(i);
+    Nodes[i] = PropertyManager->GetNode(name);
+    if (!Nodes[i]) {
+      FGLogging log(FDMExec->GetLogger(), LogLevel::WARN);
+      log << "The value " << name << " of the shared memory segment " << Name
+          << " does not match any property. It will be ignored.\n";
+    }
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSharedMemory::Read(bool Holding)
+{
+  if (!Segment.IsValid() && !Bind()) return;
+
+  double time;
+  if (!Segment.Read(time, Values.data())) return;
+
+  for (unsigned int i=0; i < Values.size(); ++i) {
+    if (Nodes[i]) Nodes[i]->setDoubleValue(Values[i]);
+  }
+}
+}
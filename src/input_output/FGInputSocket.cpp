@@ -131,140 +131,16 @@ void FGInputSocket::Read(bool Holding)
       string line = data.substr(string_start, string_end-string_start);
       if (line.empty()) break;
 
-      // now parse individual line
-      vector <string> tokens = split(line,' ');
-
-      string command, argument, str_value;
-      if (!tokens.empty()) {
-        command = to_lower(tokens[0]);
-        if (tokens.size() > 1) {
-          argument = trim(tokens[1]);
-          if (tokens.size() > 2) {
-            str_value = trim(tokens[2]);
-          }
-        }
-      }
-
-      if (command == "set") {                       // SET PROPERTY
-        SGPropertyNode* node = nullptr;
-
-        if (argument.empty()) {
-          socket->Reply("No property argument supplied.\r\n");
-          break;
-        }
-        try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\r\n");
-          break;
-        }
-
-        if (!node) {
-          socket->Reply("Unknown property\r\n");
-          break;
-        } else if (!node->hasValue()) {
-          socket->Reply("Not a leaf property\r\n");
-          break;
-        } else {
-          try {
-            double value = atof_locale_c(str_value);
-            node->setDoubleValue(value);
-          } catch(InvalidNumber& e) {
-            string msg(e.what());
-            msg += "\r\n";
-            socket->Reply(msg);
-            break;
-          }
-        }
-        socket->Reply("set successful\r\n");
-
-      } else if (command == "get") {             // GET PROPERTY
-        SGPropertyNode* node = nullptr;
-
-        if (argument.empty()) {
-          socket->Reply("No property argument supplied.\r\n");
-          break;
-        }
-        try {
-          node = PropertyManager->GetNode(argument);
-        } catch(...) {
-          socket->Reply("Badly formed property query\r\n");
-          break;
-        }
-
-        if (!node) {
-          socket->Reply("Unknown property\r\n");
-          break;
-        } else if (!node->hasValue()) {
-          if (Holding) { // if holding can query property list
-            string query = FDMExec->QueryPropertyCatalog(argument, "\r\n");
-            socket->Reply(query);
-          } else {
-            socket->Reply("Must be in HOLD to search properties\r\n");
-          }
-        } else {
-          ostringstream buf;
-          buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << '\r' << endl;
-          socket->Reply(buf.str());
-        }
-
-      } else if (command == "hold") {               // PAUSE
-
-        FDMExec->Hold();
-        socket->Reply("Holding\r\n");
-
-      } else if (command == "resume") {             // RESUME
-
-        FDMExec->Resume();
-        socket->Reply("Resuming\r\n");
-
-      } else if (command == "iterate") {            // ITERATE
-
-        int argumentInt;
-        istringstream (argument) >> argumentInt;
-        if (argument.empty()) {
-          socket->Reply("No argument supplied for number of iterations.\r\n");
-          break;
-        }
-        if ( !(argumentInt > 0) ){
-          socket->Reply("Required argument must be a positive Integer.\r\n");
-          break;
-        }
-        FDMExec->EnableIncrementThenHold( argumentInt );
-        FDMExec->Resume();
-        socket->Reply("Iterations performed\r\n");
-
-      } else if (command == "quit") {               // QUIT
+      string reply;
+      CommandStatus status = ExecuteCommand(line, reply, Holding);
 
+      if (status == CommandStatus::Quit) {
         // close the socket connection
-        socket->Send("Closing connection\r\n");
+        socket->Send(reply);
         socket->Close();
-
-      } else if (command == "info") {               // INFO
-
-        // get info about the sim run and/or aircraft, etc.
-        ostringstream info;
-        info << "JSBSim version: " << JSBSim_version << "\r\n";
-        info << "Config File version: " << needed_cfg_version << "\r\n";
-        info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << "\r\n";
-        info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << '\r' << endl;
-        socket->Reply(info.str());
-
-      } else if (command == "help") {               // HELP
-
-        socket->Reply(
-        " JSBSim Server commands:\r\n\r\n"
-        "   get {property name}\r\n"
-        "   set {property name} {value}\r\n"
-        "   hold\r\n"
-        "   resume\r\n"
-        "   iterate {value}\r\n"
-        "   help\r\n"
-        "   quit\r\n"
-        "   info\r\n\r\n");
-
       } else {
-        socket->Reply(string("Unknown command: ") + command + "\r\n");
+        socket->Reply(reply);
+        if (status == CommandStatus::Error) break;
       }
 
       start = string_end;
@@ -282,4 +158,150 @@ void FGInputSocket::Read(bool Holding)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGInputSocket::CommandStatus
+FGInputSocket::ExecuteCommand(const string& line, string& reply, bool Holding)
+{
+  vector <string> tokens = split(line,' ');
+
+  string command, argument, str_value;
+  if (!tokens.empty()) {
+    command = to_lower(tokens[0]);
+    if (tokens.size() > 1) {
+      argument = trim(tokens[1]);
+      if (tokens.size() > 2) {
+        str_value = trim(tokens[2]);
+      }
+    }
+  }
+
+  if (command == "set") {                       // SET PROPERTY
+    SGPropertyNode* node = nullptr;
+
+    if (argument.empty()) {
+      reply = "No property argument supplied.\r\n";
+      return CommandStatus::Error;
+    }
+    try {
+      node = PropertyManager->GetNode(argument);
+    } catch(...) {
+      reply = "Badly formed property query\r\n";
+      return CommandStatus::Error;
+    }
+
+    if (!node) {
+      reply = "Unknown property\r\n";
+      return CommandStatus::Error;
+    } else if (!node->hasValue()) {
+      reply = "Not a leaf property\r\n";
+      return CommandStatus::Error;
+    } else {
+      try {
+        double value = atof_locale_c(str_value);
+        node->setDoubleValue(value);
+      } catch(InvalidNumber& e) {
+        reply = string(e.what()) + "\r\n";
+        return CommandStatus::Error;
+      }
+    }
+    reply = "set successful\r\n";
+
+  } else if (command == "get") {             // GET PROPERTY
+    SGPropertyNode* node = nullptr;
+
+    if (argument.empty()) {
+      reply = "No property argument supplied.\r\n";
+      return CommandStatus::Error;
+    }
+    try {
+      node = PropertyManager->GetNode(argument);
+    } catch(...) {
+      reply = "Badly formed property query\r\n";
+      return CommandStatus::Error;
+    }
+
+    if (!node) {
+      reply = "Unknown property\r\n";
+      return CommandStatus::Error;
+    } else if (!node->hasValue()) {
+      if (Holding) { // if holding can query property list
+        reply = FDMExec->QueryPropertyCatalog(argument, "\r\n");
+      } else {
+        reply = "Must be in HOLD to search properties\r\n";
+      }
+    } else {
+      ostringstream buf;
+      buf << argument << " = " << setw(12) << setprecision(6) << node->getDoubleValue() << '\r' << endl;
+      reply = buf.str();
+    }
+
+  } else if (command == "hold") {               // PAUSE
+
+    FDMExec->Hold();
+    reply = "Holding\r\n";
+
+  } else if (command == "resume") {             // RESUME
+
+    FDMExec->Resume();
+    reply = "Resuming\r\n";
+
+  } else if (command == "iterate") {            // ITERATE
+
+    int argumentInt;
+    istringstream (argument) >> argumentInt;
+    if (argument.empty()) {
+      reply = "No argument supplied for number of iterations.\r\n";
+      return CommandStatus::Error;
+    }
+    if ( !(argumentInt > 0) ){
+      reply = "Required argument must be a positive Integer.\r\n";
+      return CommandStatus::Error;
+    }
+    FDMExec->EnableIncrementThenHold( argumentInt );
+    FDMExec->Resume();
+    reply = "Iterations performed\r\n";
+
+  } else if (command == "quit") {               // QUIT
+
+    reply = "Closing connection\r\n";
+    return CommandStatus::Quit;
+
+  } else if (command == "info") {               // INFO
+
+    // get info about the sim run and/or aircraft, etc.
+    ostringstream info;
+    info << "JSBSim version: " << JSBSim_version << "\r\n";
+    info << "Config File version: " << needed_cfg_version << "\r\n";
+    info << "Aircraft simulated: " << FDMExec->GetAircraft()->GetAircraftName() << "\r\n";
+    info << "Simulation time: " << setw(8) << setprecision(3) << FDMExec->GetSimTime() << '\r' << endl;
+    reply = info.str();
+
+  } else if (command == "help") {               // HELP
+
+    reply = GetHelp();
+
+  } else {
+    reply = string("Unknown command: ") + command + "\r\n";
+  }
+
+  return CommandStatus::Ok;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGInputSocket::GetHelp(void) const
+{
+  return
+    " JSBSim Server commands:\r\n\r\n"
+    "   get {property name}\r\n"
+    "   set {property name} {value}\r\n"
+    "   hold\r\n"
+    "   resume\r\n"
+    "   iterate {value}\r\n"
+    "   help\r\n"
+    "   quit\r\n"
+    "   info\r\n\r\n";
+}
+
 }
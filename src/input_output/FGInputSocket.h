@@ -83,6 +83,19 @@ public:
   void Read(bool Holding) override;
 
 protected:
+  /// Outcome of the execution of a command line.
+  enum class CommandStatus {Ok, Error, Quit};
+
+  /** Executes a single command line received from a client.
+      @param line the command line stripped from its line terminator.
+      @param reply receives the text that must be sent back to the client.
+      @param Holding true if the executive is holding the simulation.
+      @result the status of the command execution. */
+  CommandStatus ExecuteCommand(const std::string& line, std::string& reply,
+                               bool Holding);
+
+  /// Returns the text replied to the "help" command.
+  virtual std::string GetHelp(void) const;
 
   unsigned int SockPort;
   FGfdmSocket* socket;
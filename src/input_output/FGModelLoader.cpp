@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGModelLoader.h"
 #include "FGXMLFileRead.h"
+#include "FGCompiledModel.h"
 #include "models/FGModel.h"
 #include "input_output/FGLog.h"
 
@@ -92,6 +93,12 @@ SGPath CheckPathName(const SGPath& path, const SGPath& filename) {
   if (fullName.extension() != "xml")
     fullName.concat(".xml");
 
+  // The documents of a compiled model are looked up first. The files that it
+  // does not contain are searched in the file system.
+  FGCompiledModel* compiled = FGCompiledModel::GetActive();
+  if (compiled && !compiled->IsRecording() && compiled->Exists(fullName))
+    return fullName;
+
   return fullName.exists() ? fullName : SGPath();
 }
 }
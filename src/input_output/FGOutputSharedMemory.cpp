@@ -0,0 +1,133 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Manage output of properties to a shared memory segment
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class publishes the values of a list of properties in a shared memory
+segment.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputSharedMemory.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "math/FGPropertyValue.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGOutputSharedMemory::FGOutputSharedMemory(FGFDMExec* fdmex) :
+  FGOutputType(fdmex)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputSharedMemory::Load(Element* el)
+{
+  if (!FGOutputType::Load(el))
+    return false;
+
+  string name = el->GetAttributeValue("name");
+  if (name.empty()) {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "The name of the shared memory segment is missing\n";
+    return false;
+  }
+
+  SetOutputName(name);
+
+  // Unless specified otherwise, the values are published at each time step.
+  if (!el->HasAttribute("rate"))
+    SetRate(1);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputSharedMemory::InitModel(void)
+{
+  if (!FGOutputType::InitModel())
+    return false;
+
+  // The segment is kept across resets so that the readers are not disturbed.
+  if (Segment.IsOpen() && Segment.GetSegmentName() == Name)
+    return true;
+
+  // The names are relative to the root of the FDM so that they can be fed
+  // directly to FGPropertyManager::GetNode() by the readers.
+  string root = GetFullyQualifiedName(PropertyManager->GetNode());
+  if (root.back() != '/') root += "/";
+
+  vector<string> names;
+  for (unsigned int i=0; i < OutputParameters.size(); ++i) {
+    if (i < OutputCaptions.size() && !OutputCaptions[i].empty())
+      names.push_back(OutputCaptions[i]);
+    else {
+      string name = OutputParameters[i]->GetFullyQualifiedName();
+      if (name.compare(0, root.size(), root) == 0) name.erase(0, root.size());
+      names.push_back(name);
+    }
+  }
+
+  string error = Segment.Create(Name, names);
+  if (!error.empty()) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
+    log << error << "\n";
+    return false;
+  }
+
+  Values.resize(OutputParameters.size());
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputSharedMemory::Print(void)
+{
+  if (!Segment.IsOpen()) return;
+
+  for (unsigned int i=0; i < OutputParameters.size(); ++i)
+    Values[i] = OutputParameters[i]->GetValue();
+
+  Segment.Write(FDMExec->GetSimTime(), Values.data());
+}
+}
@@ -38,6 +38,7 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 
@@ -142,6 +143,8 @@ bool FGOutputSocket::InitModel(void)
     if (socket == 0) return false;
     if (!socket->GetConnectStatus()) return false;
 
+    BuildRecordPlan();
+    Delta.Reset();
     PrintHeaders();
 
     return true;
@@ -277,116 +280,159 @@ void FGOutputSocket::PrintHeaders(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGOutputSocket::Print(void)
+void FGOutputSocket::BuildRecordPlan(void)
 {
-  string asciiData, scratch;
+  RecordValues.clear();
 
-  if (socket == 0) return;
-  if (!socket->GetConnectStatus()) return;
+  // 17 significant digits represent any double exactly: a larger precision
+  // would only add digits.
+  precision = min(precision, 17);
 
-  socket->Clear();
-  socket->Append(FDMExec->GetSimTime());
+  // The values are formatted as FGfdmSocket::Append(double) does.
+  auto AddValue = [this](function<double(void)> value) {
+    RecordValues.push_back({value, precision, 12, Deadband});
+  };
 
   if (SubSystems & ssAerosurfaces) {
-    socket->Append(FCS->GetDaCmd());
-    socket->Append(FCS->GetDeCmd());
-    socket->Append(FCS->GetDrCmd());
-    socket->Append(FCS->GetDfCmd());
-    socket->Append(FCS->GetDaLPos());
-    socket->Append(FCS->GetDaRPos());
-    socket->Append(FCS->GetDePos());
-    socket->Append(FCS->GetDrPos());
-    socket->Append(FCS->GetDfPos());
+    auto FCS = this->FCS.get();
+    AddValue([FCS]() { return FCS->GetDaCmd(); });
+    AddValue([FCS]() { return FCS->GetDeCmd(); });
+    AddValue([FCS]() { return FCS->GetDrCmd(); });
+    AddValue([FCS]() { return FCS->GetDfCmd(); });
+    AddValue([FCS]() { return FCS->GetDaLPos(); });
+    AddValue([FCS]() { return FCS->GetDaRPos(); });
+    AddValue([FCS]() { return FCS->GetDePos(); });
+    AddValue([FCS]() { return FCS->GetDrPos(); });
+    AddValue([FCS]() { return FCS->GetDfPos(); });
   }
   if (SubSystems & ssRates) {
-    socket->Append(radtodeg*Propagate->GetPQR(eP));
-    socket->Append(radtodeg*Propagate->GetPQR(eQ));
-    socket->Append(radtodeg*Propagate->GetPQR(eR));
-    socket->Append(radtodeg*Accelerations->GetPQRdot(eP));
-    socket->Append(radtodeg*Accelerations->GetPQRdot(eQ));
-    socket->Append(radtodeg*Accelerations->GetPQRdot(eR));
+    auto Propagate = this->Propagate.get();
+    auto Accelerations = this->Accelerations.get();
+    AddValue([Propagate]() { return radtodeg*Propagate->GetPQR(eP); });
+    AddValue([Propagate]() { return radtodeg*Propagate->GetPQR(eQ); });
+    AddValue([Propagate]() { return radtodeg*Propagate->GetPQR(eR); });
+    AddValue([Accelerations]() { return radtodeg*Accelerations->GetPQRdot(eP); });
+    AddValue([Accelerations]() { return radtodeg*Accelerations->GetPQRdot(eQ); });
+    AddValue([Accelerations]() { return radtodeg*Accelerations->GetPQRdot(eR); });
   }
   if (SubSystems & ssVelocities) {
-    socket->Append(Auxiliary->Getqbar());
-    socket->Append(Auxiliary->GetVt());
-    socket->Append(Propagate->GetUVW(eU));
-    socket->Append(Propagate->GetUVW(eV));
-    socket->Append(Propagate->GetUVW(eW));
-    socket->Append(Auxiliary->GetAeroUVW(eU));
-    socket->Append(Auxiliary->GetAeroUVW(eV));
-    socket->Append(Auxiliary->GetAeroUVW(eW));
-    socket->Append(Propagate->GetVel(eNorth));
-    socket->Append(Propagate->GetVel(eEast));
-    socket->Append(Propagate->GetVel(eDown));
+    auto Auxiliary = this->Auxiliary.get();
+    auto Propagate = this->Propagate.get();
+    AddValue([Auxiliary]() { return Auxiliary->Getqbar(); });
+    AddValue([Auxiliary]() { return Auxiliary->GetVt(); });
+    AddValue([Propagate]() { return Propagate->GetUVW(eU); });
+    AddValue([Propagate]() { return Propagate->GetUVW(eV); });
+    AddValue([Propagate]() { return Propagate->GetUVW(eW); });
+    AddValue([Auxiliary]() { return Auxiliary->GetAeroUVW(eU); });
+    AddValue([Auxiliary]() { return Auxiliary->GetAeroUVW(eV); });
+    AddValue([Auxiliary]() { return Auxiliary->GetAeroUVW(eW); });
+    AddValue([Propagate]() { return Propagate->GetVel(eNorth); });
+    AddValue([Propagate]() { return Propagate->GetVel(eEast); });
+    AddValue([Propagate]() { return Propagate->GetVel(eDown); });
   }
   if (SubSystems & ssForces) {
-    socket->Append(Aerodynamics->GetvFw()(eDrag));
-    socket->Append(Aerodynamics->GetvFw()(eSide));
-    socket->Append(Aerodynamics->GetvFw()(eLift));
-    socket->Append(Aerodynamics->GetLoD());
-    socket->Append(Aircraft->GetForces(eX));
-    socket->Append(Aircraft->GetForces(eY));
-    socket->Append(Aircraft->GetForces(eZ));
+    auto Aerodynamics = this->Aerodynamics.get();
+    auto Aircraft = this->Aircraft.get();
+    AddValue([Aerodynamics]() { return Aerodynamics->GetvFw()(eDrag); });
+    AddValue([Aerodynamics]() { return Aerodynamics->GetvFw()(eSide); });
+    AddValue([Aerodynamics]() { return Aerodynamics->GetvFw()(eLift); });
+    AddValue([Aerodynamics]() { return Aerodynamics->GetLoD(); });
+    AddValue([Aircraft]() { return Aircraft->GetForces(eX); });
+    AddValue([Aircraft]() { return Aircraft->GetForces(eY); });
+    AddValue([Aircraft]() { return Aircraft->GetForces(eZ); });
   }
   if (SubSystems & ssMoments) {
-    socket->Append(Aircraft->GetMoments(eL));
-    socket->Append(Aircraft->GetMoments(eM));
-    socket->Append(Aircraft->GetMoments(eN));
+    auto Aircraft = this->Aircraft.get();
+    AddValue([Aircraft]() { return Aircraft->GetMoments(eL); });
+    AddValue([Aircraft]() { return Aircraft->GetMoments(eM); });
+    AddValue([Aircraft]() { return Aircraft->GetMoments(eN); });
   }
   if (SubSystems & ssAtmosphere) {
-    const auto Atmosphere = FDMExec->GetAtmosphere();
-    socket->Append(Atmosphere->GetDensity());
-    socket->Append(Atmosphere->GetPressureSL());
-    socket->Append(Atmosphere->GetPressure());
-    socket->Append(Winds->GetTurbMagnitude());
-    socket->Append(Winds->GetTurbDirection());
-    socket->Append(Winds->GetTotalWindNED().Dump(","));
+    // The atmosphere is not held by the output and is replaced when a planet
+    // is loaded, so it is fetched from the executive at each record.
+    auto FDMExec = this->FDMExec;
+    auto Winds = this->Winds.get();
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetDensity(); });
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetPressureSL(); });
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetPressure(); });
+    AddValue([Winds]() { return Winds->GetTurbMagnitude(); });
+    AddValue([Winds]() { return Winds->GetTurbDirection(); });
+    // The wind used to be sent with FGColumnVector3::Dump()
+    for (unsigned int i=1; i<=3; i++)
+      RecordValues.push_back({[Winds, i]() { return Winds->GetTotalWindNED(i); },
+                              16, 0, Deadband});
   }
   if (SubSystems & ssMassProps) {
-    socket->Append(MassBalance->GetJ()(1,1));
-    socket->Append(MassBalance->GetJ()(1,2));
-    socket->Append(MassBalance->GetJ()(1,3));
-    socket->Append(MassBalance->GetJ()(2,1));
-    socket->Append(MassBalance->GetJ()(2,2));
-    socket->Append(MassBalance->GetJ()(2,3));
-    socket->Append(MassBalance->GetJ()(3,1));
-    socket->Append(MassBalance->GetJ()(3,2));
-    socket->Append(MassBalance->GetJ()(3,3));
-    socket->Append(MassBalance->GetMass());
-    socket->Append(MassBalance->GetXYZcg()(eX));
-    socket->Append(MassBalance->GetXYZcg()(eY));
-    socket->Append(MassBalance->GetXYZcg()(eZ));
+    auto MassBalance = this->MassBalance.get();
+    for (unsigned int r=1; r<=3; r++) {
+      for (unsigned int c=1; c<=3; c++)
+        AddValue([MassBalance, r, c]() { return MassBalance->GetJ()(r,c); });
+    }
+    AddValue([MassBalance]() { return MassBalance->GetMass(); });
+    AddValue([MassBalance]() { return MassBalance->GetXYZcg()(eX); });
+    AddValue([MassBalance]() { return MassBalance->GetXYZcg()(eY); });
+    AddValue([MassBalance]() { return MassBalance->GetXYZcg()(eZ); });
   }
   if (SubSystems & ssPropagate) {
-    socket->Append(Propagate->GetAltitudeASL());
-    socket->Append(radtodeg*Propagate->GetEuler(ePhi));
-    socket->Append(radtodeg*Propagate->GetEuler(eTht));
-    socket->Append(radtodeg*Propagate->GetEuler(ePsi));
-    socket->Append(Auxiliary->Getalpha(inDegrees));
-    socket->Append(Auxiliary->Getbeta(inDegrees));
-    socket->Append(Propagate->GetLocation().GetLatitudeDeg());
-    socket->Append(Propagate->GetLocation().GetLongitudeDeg());
+    auto Auxiliary = this->Auxiliary.get();
+    auto Propagate = this->Propagate.get();
+    AddValue([Propagate]() { return Propagate->GetAltitudeASL(); });
+    AddValue([Propagate]() { return radtodeg*Propagate->GetEuler(ePhi); });
+    AddValue([Propagate]() { return radtodeg*Propagate->GetEuler(eTht); });
+    AddValue([Propagate]() { return radtodeg*Propagate->GetEuler(ePsi); });
+    AddValue([Auxiliary]() { return Auxiliary->Getalpha(inDegrees); });
+    AddValue([Auxiliary]() { return Auxiliary->Getbeta(inDegrees); });
+    AddValue([Propagate]() { return Propagate->GetLocation().GetLatitudeDeg(); });
+    AddValue([Propagate]() { return Propagate->GetLocation().GetLongitudeDeg(); });
   }
-  if (SubSystems & ssAeroFunctions) {
-    scratch = Aerodynamics->GetAeroFunctionValues(",");
-    if (scratch.length() != 0) socket->Append(scratch);
-  }
-  if (SubSystems & ssFCS) {
-    scratch = FCS->GetComponentValues(",");
-    if (scratch.length() != 0) socket->Append(scratch);
-  }
-  if (SubSystems & ssGroundReactions) {
-    socket->Append(GroundReactions->GetGroundReactionValues(","));
-  }
-  if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0) {
-    socket->Append(Propulsion->GetPropulsionValues(","));
+
+  size_t first = RecordValues.size();
+
+  if (SubSystems & ssAeroFunctions)
+    Aerodynamics->GetAeroFunctionValueSources(RecordValues);
+  if (SubSystems & ssFCS)
+    FCS->GetComponentValueSources(RecordValues);
+  if (SubSystems & ssGroundReactions)
+    GroundReactions->GetGroundReactionValueSources(RecordValues);
+  if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0)
+    Propulsion->GetPropulsionValueSources(RecordValues);
+
+  for (size_t i=first; i<RecordValues.size(); i++)
+    RecordValues[i].Deadband = Deadband;
+
+  for (unsigned int i=0; i<OutputParameters.size(); i++) {
+    FGPropertyValue* parameter = OutputParameters[i];
+    RecordValues.push_back({[parameter]() { return parameter->GetValue(); },
+                            precision, 12, OutputDeadbands[i]});
   }
+}
 
-  for (unsigned int i=0;i<OutputParameters.size();++i) {
-    socket->Append(OutputParameters[i]->GetValue());
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputSocket::Print(void)
+{
+  if (socket == 0) return;
+  if (!socket->GetConnectStatus()) return;
+
+  double time = FDMExec->GetSimTime();
+
+  // Records in which nothing changed are skipped.
+  if (DeltaOutput && !Delta.Update(RecordValues, time)) return;
+
+  Record.clear();
+
+  AppendValue(Record, time, precision, 12);
+  for (unsigned int i=0; i<RecordValues.size(); i++) {
+    const FGOutputValue& value = RecordValues[i];
+    Record += ',';
+    if (!DeltaOutput)
+      AppendValue(Record, value.Get(), value.Precision, value.Width);
+    else if (Delta.IsSelected(i))
+      AppendValue(Record, Delta.GetValue(i), value.Precision, value.Width);
   }
+  Record += '\n';
 
-  socket->Send();
+  socket->Send(Record);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
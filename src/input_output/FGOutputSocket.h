@@ -57,6 +57,9 @@ CLASS DOCUMENTATION
     provides services for socket outputs. For instance FGOutputFG inherits
     FGOutputSocket for the socket management but outputs data with a format
     different than FGOutputSocket.
+
+    As for FGOutputTextFile, the values of a record are listed once, when the
+    socket is opened, and the records are formatted in a reused buffer.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -103,12 +106,15 @@ public:
 
 protected:
   virtual void PrintHeaders(void);
+  void BuildRecordPlan(void);
 
   std::string SockName;
   unsigned int SockPort;
   FGfdmSocket::ProtocolType SockProtocol;
   FGfdmSocket* socket;
   int precision;
+  std::vector<FGOutputValue> RecordValues;
+  std::string Record;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
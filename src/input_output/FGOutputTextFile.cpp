@@ -76,6 +76,9 @@ bool FGOutputTextFile::Load(Element* el)
 
   SetDelimiter(delim);
 
+  string compression = el->GetAttributeValue("compression");
+  SetCompression(to_upper(compression) == "ON");
+
   return true;
 }
 
@@ -84,7 +87,9 @@ bool FGOutputTextFile::Load(Element* el)
 bool FGOutputTextFile::OpenFile(void)
 {
   datafile.clear();
-  datafile.open(Filename);
+  // The compressed blocks must not go through the newline translation of the
+  // text mode.
+  datafile.open(Filename, ios::out | ios::binary);
   if (!datafile) {
     FGLogging log(FDMExec->GetLogger(), LogLevel::ERROR);
     log << LogFormat::RED << LogFormat::BOLD << "\nERROR: unable to open the file "
@@ -96,7 +101,10 @@ bool FGOutputTextFile::OpenFile(void)
   }
 
   string scratch = "";
+  // The header of a compressed file is handed over to the compressor.
+  ostringstream header;
   streambuf* buffer = datafile.rdbuf();
+  if (Compressed) buffer = header.rdbuf();
   ostream outstream(buffer);
 
   outstream.precision(10);
@@ -240,157 +248,214 @@ bool FGOutputTextFile::OpenFile(void)
   outstream << endl;
   outstream.flush();
 
+  BuildRecordPlan();
+  Delta.Reset();
+
+  if (Compressed && !ToConsole)
+    Writer.reset(new FGCompressedFileWriter(datafile, header.str()));
+
   return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGOutputTextFile::Print(void)
+void FGOutputTextFile::CloseFile(void)
 {
-  streambuf* buffer;
-  string scratch = Filename.utf8Str();
+  // The compressor must complete before the file is closed.
+  Writer.reset();
 
-  if (to_upper(scratch) == "COUT") {
-    buffer = cout.rdbuf();
-  } else {
-    buffer = datafile.rdbuf();
-  }
-
-  ostream outstream(buffer);
+  if (datafile.is_open()) datafile.close();
+}
 
-  outstream.precision(10);
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  outstream << FDMExec->GetSimTime();
-  if (SubSystems & ssSimulation) {
-  }
+void FGOutputTextFile::BuildRecordPlan(void)
+{
+  string scratch = Filename.utf8Str();
+  ToConsole = to_upper(scratch) == "COUT";
+
+  RecordValues.clear();
+
+  auto AddValue = [this](function<double(void)> value, int precision) {
+    RecordValues.push_back({value, precision});
+  };
+  auto AddVector = [this](function<FGColumnVector3(void)> vector, int precision) {
+    for (unsigned int i=1; i<=3; i++)
+      RecordValues.push_back({[vector, i]() { return vector()(i); }, precision});
+  };
+  auto AddQuaternion = [this](function<FGQuaternion(void)> quaternion) {
+    for (unsigned int i=1; i<=4; i++)
+      RecordValues.push_back({[quaternion, i]() { return quaternion()(i); }, 16});
+  };
+
+  // The precisions below are those that the stream manipulators and the
+  // Dump() methods of the vectors, quaternions and matrices used to produce.
   if (SubSystems & ssAerosurfaces) {
-    outstream << delimeter;
-    outstream << FCS->GetDaCmd() << delimeter;
-    outstream << FCS->GetDeCmd() << delimeter;
-    outstream << FCS->GetDrCmd() << delimeter;
-    outstream << FCS->GetDfCmd() << delimeter;
-    outstream << FCS->GetDaLPos(ofDeg) << delimeter;
-    outstream << FCS->GetDaRPos(ofDeg) << delimeter;
-    outstream << FCS->GetDePos(ofDeg) << delimeter;
-    outstream << FCS->GetDrPos(ofDeg) << delimeter;
-    outstream << FCS->GetDfPos(ofDeg);
+    auto FCS = this->FCS.get();
+    AddValue([FCS]() { return FCS->GetDaCmd(); }, 10);
+    AddValue([FCS]() { return FCS->GetDeCmd(); }, 10);
+    AddValue([FCS]() { return FCS->GetDrCmd(); }, 10);
+    AddValue([FCS]() { return FCS->GetDfCmd(); }, 10);
+    AddValue([FCS]() { return FCS->GetDaLPos(ofDeg); }, 10);
+    AddValue([FCS]() { return FCS->GetDaRPos(ofDeg); }, 10);
+    AddValue([FCS]() { return FCS->GetDePos(ofDeg); }, 10);
+    AddValue([FCS]() { return FCS->GetDrPos(ofDeg); }, 10);
+    AddValue([FCS]() { return FCS->GetDfPos(ofDeg); }, 10);
   }
   if (SubSystems & ssRates) {
-    outstream << delimeter;
-    outstream << (radtodeg*Propagate->GetPQR()).Dump(delimeter) << delimeter;
-    outstream << (radtodeg*Accelerations->GetPQRdot()).Dump(delimeter) << delimeter;
-    outstream << (radtodeg*Propagate->GetPQRi()).Dump(delimeter);
+    auto Propagate = this->Propagate.get();
+    auto Accelerations = this->Accelerations.get();
+    AddVector([Propagate]() { return radtodeg*Propagate->GetPQR(); }, 16);
+    AddVector([Accelerations]() { return radtodeg*Accelerations->GetPQRdot(); }, 16);
+    AddVector([Propagate]() { return radtodeg*Propagate->GetPQRi(); }, 16);
   }
   if (SubSystems & ssVelocities) {
-    outstream << delimeter;
-    outstream << Auxiliary->Getqbar() << delimeter;
-    outstream << Auxiliary->GetReynoldsNumber() << delimeter;
-    outstream << setprecision(12) << Auxiliary->GetVt() << delimeter;
-    outstream << Propagate->GetInertialVelocityMagnitude() << delimeter;
-    outstream << setprecision(12) << Propagate->GetUVW().Dump(delimeter) << delimeter;
-    outstream << setprecision(12) << Accelerations->GetUVWdot().Dump(delimeter) << delimeter;
-    outstream << setprecision(12) << Accelerations->GetUVWidot().Dump(delimeter) << delimeter;
-    outstream << setprecision(12) << Accelerations->GetBodyAccel().Dump(delimeter) << delimeter;
-    outstream << Auxiliary->GetAeroUVW().Dump(delimeter) << delimeter;
-    outstream << Propagate->GetInertialVelocity().Dump(delimeter) << delimeter;
-    outstream << Propagate->GetECEFVelocity().Dump(delimeter) << delimeter;
-    outstream << Propagate->GetVel().Dump(delimeter);
-    outstream.precision(10);
+    auto Auxiliary = this->Auxiliary.get();
+    auto Propagate = this->Propagate.get();
+    auto Accelerations = this->Accelerations.get();
+    AddValue([Auxiliary]() { return Auxiliary->Getqbar(); }, 10);
+    AddValue([Auxiliary]() { return Auxiliary->GetReynoldsNumber(); }, 10);
+    AddValue([Auxiliary]() { return Auxiliary->GetVt(); }, 12);
+    AddValue([Propagate]() { return Propagate->GetInertialVelocityMagnitude(); }, 12);
+    AddVector([Propagate]() { return Propagate->GetUVW(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetUVWdot(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetUVWidot(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetBodyAccel(); }, 16);
+    AddVector([Auxiliary]() { return Auxiliary->GetAeroUVW(); }, 16);
+    AddVector([Propagate]() { return Propagate->GetInertialVelocity(); }, 16);
+    AddVector([Propagate]() { return Propagate->GetECEFVelocity(); }, 16);
+    AddVector([Propagate]() { return Propagate->GetVel(); }, 16);
   }
   if (SubSystems & ssForces) {
-    outstream << delimeter;
-    outstream << Aerodynamics->GetvFw().Dump(delimeter) << delimeter;
-    outstream << Aerodynamics->GetLoD() << delimeter;
-    outstream << Aerodynamics->GetForces().Dump(delimeter) << delimeter;
-    outstream << Propulsion->GetForces().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetGroundForces().Dump(delimeter) << delimeter;
-    outstream << ExternalReactions->GetForces().Dump(delimeter) << delimeter;
-    outstream << BuoyantForces->GetForces().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetWeight().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetForces().Dump(delimeter);
+    auto Aerodynamics = this->Aerodynamics.get();
+    auto Propulsion = this->Propulsion.get();
+    auto Accelerations = this->Accelerations.get();
+    auto ExternalReactions = this->ExternalReactions.get();
+    auto BuoyantForces = this->BuoyantForces.get();
+    AddVector([Aerodynamics]() { return Aerodynamics->GetvFw(); }, 16);
+    AddValue([Aerodynamics]() { return Aerodynamics->GetLoD(); }, 10);
+    AddVector([Aerodynamics]() { return Aerodynamics->GetForces(); }, 16);
+    AddVector([Propulsion]() { return Propulsion->GetForces(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetGroundForces(); }, 16);
+    AddVector([ExternalReactions]() { return ExternalReactions->GetForces(); }, 16);
+    AddVector([BuoyantForces]() { return BuoyantForces->GetForces(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetWeight(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetForces(); }, 16);
   }
   if (SubSystems & ssMoments) {
-    outstream << delimeter;
-    outstream << Aerodynamics->GetMoments().Dump(delimeter) << delimeter;
-    outstream << Aerodynamics->GetMomentsMRC().Dump(delimeter) << delimeter;
-    outstream << Propulsion->GetMoments().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetGroundMoments().Dump(delimeter) << delimeter;
-    outstream << ExternalReactions->GetMoments().Dump(delimeter) << delimeter;
-    outstream << BuoyantForces->GetMoments().Dump(delimeter) << delimeter;
-    outstream << Accelerations->GetMoments().Dump(delimeter);
+    auto Aerodynamics = this->Aerodynamics.get();
+    auto Propulsion = this->Propulsion.get();
+    auto Accelerations = this->Accelerations.get();
+    auto ExternalReactions = this->ExternalReactions.get();
+    auto BuoyantForces = this->BuoyantForces.get();
+    AddVector([Aerodynamics]() { return Aerodynamics->GetMoments(); }, 16);
+    AddVector([Aerodynamics]() { return Aerodynamics->GetMomentsMRC(); }, 16);
+    AddVector([Propulsion]() { return Propulsion->GetMoments(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetGroundMoments(); }, 16);
+    AddVector([ExternalReactions]() { return ExternalReactions->GetMoments(); }, 16);
+    AddVector([BuoyantForces]() { return BuoyantForces->GetMoments(); }, 16);
+    AddVector([Accelerations]() { return Accelerations->GetMoments(); }, 16);
   }
   if (SubSystems & ssAtmosphere) {
-    const auto Atmosphere = FDMExec->GetAtmosphere();
-    outstream << delimeter;
-    outstream << Atmosphere->GetDensity() << delimeter;
-    outstream << Atmosphere->GetAbsoluteViscosity() << delimeter;
-    outstream << Atmosphere->GetKinematicViscosity() << delimeter;
-    outstream << Atmosphere->GetTemperature() << delimeter;
-    outstream << Atmosphere->GetPressureSL() << delimeter;
-    outstream << Atmosphere->GetPressure() << delimeter;
-    outstream << Winds->GetTurbMagnitude() << delimeter;
-    outstream << Winds->GetTurbDirection() << delimeter;
-    outstream << Winds->GetTotalWindNED().Dump(delimeter) << delimeter;
-    outstream << (Winds->GetTurbPQR()*radtodeg).Dump(delimeter);
+    // The atmosphere is not held by the output and is replaced when a planet
+    // is loaded, so it is fetched from the executive at each record.
+    auto FDMExec = this->FDMExec;
+    auto Winds = this->Winds.get();
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetDensity(); }, 10);
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetAbsoluteViscosity(); }, 10);
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetKinematicViscosity(); }, 10);
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetTemperature(); }, 10);
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetPressureSL(); }, 10);
+    AddValue([FDMExec]() { return FDMExec->GetAtmosphere()->GetPressure(); }, 10);
+    AddValue([Winds]() { return Winds->GetTurbMagnitude(); }, 10);
+    AddValue([Winds]() { return Winds->GetTurbDirection(); }, 10);
+    AddVector([Winds]() { return Winds->GetTotalWindNED(); }, 16);
+    AddVector([Winds]() { return Winds->GetTurbPQR()*radtodeg; }, 16);
   }
   if (SubSystems & ssMassProps) {
-    outstream << delimeter;
-    outstream << MassBalance->GetJ().Dump(delimeter) << delimeter;
-    outstream << MassBalance->GetMass() << delimeter;
-    outstream << MassBalance->GetWeight() << delimeter;
-    outstream << MassBalance->GetXYZcg().Dump(delimeter);
+    auto MassBalance = this->MassBalance.get();
+    for (unsigned int r=1; r<=3; r++) {
+      for (unsigned int c=1; c<=3; c++)
+        RecordValues.push_back({[MassBalance, r, c]() { return MassBalance->GetJ()(r,c); }, 10, 12});
+    }
+    AddValue([MassBalance]() { return MassBalance->GetMass(); }, 10);
+    AddValue([MassBalance]() { return MassBalance->GetWeight(); }, 10);
+    AddVector([MassBalance]() { return MassBalance->GetXYZcg(); }, 16);
   }
   if (SubSystems & ssPropagate) {
-    outstream.precision(14);
-    outstream << delimeter;
-    outstream << Propagate->GetAltitudeASL() << delimeter;
-    outstream << Propagate->GetDistanceAGL() << delimeter;
-    outstream << (radtodeg*Propagate->GetEuler()).Dump(delimeter) << delimeter;
-    outstream << Propagate->GetQuaternion().Dump(delimeter) << delimeter;
-    FGQuaternion Qec = Propagate->GetQuaternionECEF();
-    outstream << Qec.Dump(delimeter) << delimeter;
-    outstream << Propagate->GetQuaternionECI().Dump(delimeter) << delimeter;
-    outstream << Auxiliary->Getalpha(inDegrees) << delimeter;
-    outstream << Auxiliary->Getbeta(inDegrees) << delimeter;
-    outstream << Propagate->GetLatitudeDeg() << delimeter;
-    outstream << Propagate->GetGeodLatitudeDeg() << delimeter;
-    outstream << Propagate->GetLongitudeDeg() << delimeter;
-    outstream.precision(18);
-    outstream << ((FGColumnVector3)Propagate->GetInertialPosition()).Dump(delimeter) << delimeter;
-    outstream << ((FGColumnVector3)Propagate->GetLocation()).Dump(delimeter) << delimeter;
-    outstream.precision(14);
-    outstream << Propagate->GetEarthPositionAngleDeg() << delimeter;
-    outstream << Propagate->GetDistanceAGL() << delimeter;
-    outstream << Propagate->GetTerrainElevation();
-    outstream.precision(10);
-  }
-  if (SubSystems & ssAeroFunctions) {
-    scratch = Aerodynamics->GetAeroFunctionValues(delimeter);
-    if (scratch.length() != 0) outstream << delimeter << scratch;
-  }
-  if (SubSystems & ssFCS) {
-    scratch = FCS->GetComponentValues(delimeter);
-    if (scratch.length() != 0) outstream << delimeter << scratch;
-  }
-  if (SubSystems & ssGroundReactions) {
-    outstream << delimeter;
-    outstream << GroundReactions->GetGroundReactionValues(delimeter);
-  }
-  if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0) {
-    outstream << delimeter;
-    outstream << Propulsion->GetPropulsionValues(delimeter);
+    auto Auxiliary = this->Auxiliary.get();
+    auto Propagate = this->Propagate.get();
+    AddValue([Propagate]() { return Propagate->GetAltitudeASL(); }, 14);
+    AddValue([Propagate]() { return Propagate->GetDistanceAGL(); }, 14);
+    AddVector([Propagate]() { return radtodeg*Propagate->GetEuler(); }, 16);
+    AddQuaternion([Propagate]() { return Propagate->GetQuaternion(); });
+    AddQuaternion([Propagate]() { return Propagate->GetQuaternionECEF(); });
+    AddQuaternion([Propagate]() { return Propagate->GetQuaternionECI(); });
+    AddValue([Auxiliary]() { return Auxiliary->Getalpha(inDegrees); }, 14);
+    AddValue([Auxiliary]() { return Auxiliary->Getbeta(inDegrees); }, 14);
+    AddValue([Propagate]() { return Propagate->GetLatitudeDeg(); }, 14);
+    AddValue([Propagate]() { return Propagate->GetGeodLatitudeDeg(); }, 14);
+    AddValue([Propagate]() { return Propagate->GetLongitudeDeg(); }, 14);
+    AddVector([Propagate]() { return Propagate->GetInertialPosition(); }, 16);
+    AddVector([Propagate]() { return Propagate->GetLocation(); }, 16);
+    AddValue([Propagate]() { return Propagate->GetEarthPositionAngleDeg(); }, 14);
+    AddValue([Propagate]() { return Propagate->GetDistanceAGL(); }, 14);
+    AddValue([Propagate]() { return Propagate->GetTerrainElevation(); }, 14);
+  }
+  if (SubSystems & ssAeroFunctions)
+    Aerodynamics->GetAeroFunctionValueSources(RecordValues);
+  if (SubSystems & ssFCS)
+    FCS->GetComponentValueSources(RecordValues);
+  if (SubSystems & ssGroundReactions)
+    GroundReactions->GetGroundReactionValueSources(RecordValues);
+  if (SubSystems & ssPropulsion && Propulsion->GetNumEngines() > 0)
+    Propulsion->GetPropulsionValueSources(RecordValues);
+
+  for (auto& value: RecordValues)
+    value.Deadband = Deadband;
+
+  for (unsigned int i=0; i<OutputParameters.size(); i++) {
+    FGPropertyValue* parameter = OutputParameters[i];
+    RecordValues.push_back({[parameter]() { return parameter->GetValue(); }, 18,
+                            0, OutputDeadbands[i]});
+  }
+  for (auto& function: PreFunctions) {
+    FGFunction* f = function.get();
+    RecordValues.push_back({[f]() { return f->getDoubleValue(); }, 18, 0,
+                            Deadband});
   }
+}
 
-  outstream.precision(18);
-  for (unsigned int i=0;i<OutputParameters.size();++i) {
-    outstream << delimeter << OutputParameters[i]->GetValue();
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputTextFile::Print(void)
+{
+  double time = FDMExec->GetSimTime();
+
+  // Records in which nothing changed are skipped.
+  if (DeltaOutput && !Delta.Update(RecordValues, time)) return;
+
+  Record.clear();
+
+  AppendValue(Record, time, 10);
+  for (unsigned int i=0; i<RecordValues.size(); i++) {
+    const FGOutputValue& value = RecordValues[i];
+    Record += delimeter;
+    if (!DeltaOutput)
+      AppendValue(Record, value.Get(), value.Precision, value.Width);
+    else if (Delta.IsSelected(i))
+      AppendValue(Record, Delta.GetValue(i), value.Precision, value.Width);
   }
-  for (unsigned int i=0;i<PreFunctions.size();i++) {
-    outstream << delimeter << PreFunctions[i]->getDoubleValue();
+  Record += '\n';
+
+  if (Writer) {
+    Writer->Write(Record.data(), Record.size(), time);
+    return;
   }
-  outstream.precision(10);
 
-  outstream << endl;
+  ostream& outstream = ToConsole ? cout : datafile;
+
+  outstream.write(Record.data(), Record.size());
   outstream.flush();
 }
 }
@@ -39,8 +39,12 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <fstream>
+#include <memory>
+#include <vector>
 
 #include "FGOutputFile.h"
+#include "FGCompressedFile.h"
+#include "FGOutputValue.h"
 #include "simgear/io/iostreams/sgstream.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -56,6 +60,24 @@ CLASS DOCUMENTATION
 /** Implements the output to a human readable text file. This class uses the
     standard C++ library to open and close a file to which output values are
     comma-separated (CSV) or tabulated (TAB).
+
+    The values of a record are listed once, when the file is opened, together
+    with the precision they are written with. Each record is then formatted in
+    a buffer that is reused from one record to the next and written to the
+    file in one go.
+
+    When the attribute compression="ON" is given on the \<output> line, the
+    records are written to a compressed file (see FGCompressedFileWriter)
+    rather than to a plain text file. The compression is then performed by a
+    background thread and the file is no longer flushed after each record.
+    prep_plot and the Python module (see FGCompressedFileReader) read such
+    files, either whole or within a time window.
+
+@code
+<output name="B737_datalog.csv.jlz" type="CSV" rate="20" compression="ON">
+   <velocities> ON </velocities>
+</output>
+@endcode
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -66,7 +88,11 @@ class FGOutputTextFile : public FGOutputFile
 {
 public:
   /// Constructor
-  FGOutputTextFile(FGFDMExec* fdmex) : FGOutputFile(fdmex), delimeter(",") {}
+  FGOutputTextFile(FGFDMExec* fdmex)
+    : FGOutputFile(fdmex), delimeter(","), ToConsole(false), Compressed(false) {}
+
+  /// Destructor : closes the file.
+  ~FGOutputTextFile() override { CloseFile(); }
 
   /** Set the delimiter.
       @param delim delimiter of the output values (most likely a comma or a
@@ -74,6 +100,12 @@ public:
    */
   void SetDelimiter(const std::string& delim) { delimeter = delim; }
 
+  /** Set whether the output is compressed.
+      For this method to take effect, it must be called before the file is
+      opened, i.e. prior to FGFDMExec::RunIC() or SetStartNewOutput().
+      @param compress true to write a compressed file */
+  void SetCompression(bool compress) { Compressed = compress; }
+
   /** Init the output directives from an XML file.
       @param element XML Element that is pointing to the output directives
   */
@@ -85,9 +117,15 @@ public:
 protected:
   std::string delimeter;
   sg_ofstream datafile;
+  std::vector<FGOutputValue> RecordValues;
+  std::string Record;
+  bool ToConsole;
+  bool Compressed;
+  std::unique_ptr<FGCompressedFileWriter> Writer;
 
   bool OpenFile(void) override;
-  void CloseFile(void) override { if (datafile.is_open()) datafile.close(); }
+  void BuildRecordPlan(void);
+  void CloseFile(void) override;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
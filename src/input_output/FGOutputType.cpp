@@ -41,6 +41,7 @@ INCLUDES
 #include "FGOutputType.h"
 #include "FGXMLElement.h"
 #include "FGPropertyManager.h"
+#include "string_utilities.h"
 #include "math/FGTemplateFunc.h"
 #include "math/FGFunctionValue.h"
 #include "FGLog.h"
@@ -56,6 +57,8 @@ CLASS IMPLEMENTATION
 FGOutputType::FGOutputType(FGFDMExec* fdmex) :
   FGModel(fdmex),
   SubSystems(0),
+  Deadband(0.0),
+  DeltaOutput(false),
   enabled(true)
 {
   Aerodynamics = FDMExec->GetAerodynamics();
@@ -126,6 +129,13 @@ bool FGOutputType::Load(Element* element)
   if (element->FindElementValue("propulsion") == string("ON"))
     SubSystems += ssPropulsion;
 
+  string delta = element->GetAttributeValue("delta");
+  DeltaOutput = to_upper(delta) == "ON";
+  if (element->HasAttribute("deadband"))
+    Deadband = element->GetAttributeValueAsNumber("deadband");
+  if (element->HasAttribute("keyframe"))
+    Delta.SetKeyframePeriod(element->GetAttributeValueAsNumber("keyframe"));
+
   Element *property_element = element->FindElement("property");
 
   while (property_element) {
@@ -158,6 +168,11 @@ bool FGOutputType::Load(Element* element)
         OutputCaptions.push_back(property_element->GetAttributeValue("caption"));
       else
         OutputCaptions.push_back("");
+
+      if (property_element->HasAttribute("deadband"))
+        OutputDeadbands.push_back(property_element->GetAttributeValueAsNumber("deadband"));
+      else
+        OutputDeadbands.push_back(Deadband);
     }
     property_element = element->FindNextElement("property");
   }
@@ -222,8 +237,10 @@ double FGOutputType::GetRateHz(void) const
 
 void FGOutputType::SetOutputProperties(vector<SGPropertyNode_ptr> & outputProperties)
 {
-  for (auto prop: outputProperties)
+  for (auto prop: outputProperties) {
     OutputParameters.push_back(new FGPropertyValue(prop));
+    OutputDeadbands.push_back(Deadband);
+  }
 }
 
 
@@ -271,6 +288,7 @@ void FGOutputType::Debug(int from)
       if (!OutputParameters.empty())      log << "    Properties logged:\n";
       for (auto param: OutputParameters)
         log << "      - " << param->GetName() << "\n";
+      if (DeltaOutput)                    log << "    Only the changes are logged\n";
     }
   }
   if (debug_lvl & 2 ) { // Instantiation/Destruction notification
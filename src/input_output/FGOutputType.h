@@ -41,6 +41,7 @@ INCLUDES
 #include <memory>
 
 #include "models/FGModel.h"
+#include "FGOutputValue.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -82,6 +83,24 @@ CLASS DOCUMENTATION
     The class mimics some functionalities of FGModel (methods InitModel(),
     Run() and SetRate()). However it does not inherit from FGModel since it is
     conceptually different from the model paradigm.
+
+    When the attribute delta="ON" is given on the \<output> line, the text
+    file and socket outputs only output the values that have changed since the
+    last record (see FGOutputDelta): the fields of the values that did not
+    change are left empty and the records in which no value changed are
+    skipped. A value is deemed to have changed when it differs by more than
+    its deadband from the value that was last output. The deadband is 0.0 by
+    default and can be set for all the values with the attribute "deadband"
+    or for each property. All the values are output every "keyframe" seconds
+    (1.0 by default).
+
+@code
+<output name="localhost" type="SOCKET" port="1138" rate="60" delta="ON"
+        keyframe="5.0">
+   <property deadband="0.5"> velocities/vc-kts </property>
+   <property> gear/gear-pos-norm </property>
+</output>
+@endcode
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -196,6 +215,10 @@ protected:
   int SubSystems;
   std::vector <FGPropertyValue*> OutputParameters;
   std::vector <std::string> OutputCaptions;
+  std::vector <double> OutputDeadbands;
+  double Deadband;
+  bool DeltaOutput;
+  FGOutputDelta Delta;
   bool enabled;
 
   std::shared_ptr<FGAerodynamics> Aerodynamics;
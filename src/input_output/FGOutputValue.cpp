@@ -0,0 +1,136 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputValue.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Formatting of the values sent to the outputs
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+
+#include "FGOutputValue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void AppendValue(string& buffer, double value, int precision, int width)
+{
+  // Large enough for 18 significant digits, the sign and a 3 digits exponent.
+  char str[32];
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  // std::to_chars() is specified to produce the same characters as printf()
+  // but it does not go through the locale and the stdio machinery.
+  auto result = to_chars(str, str+sizeof(str), value, chars_format::general,
+                         precision);
+  int len = result.ec == errc() ? result.ptr - str : sizeof(str);
+#else
+  int len = snprintf(str, sizeof(str), "%.*g", precision, value);
+#endif
+
+  if (len < 0) return;
+
+  if (size_t(len) < sizeof(str)) {
+    if (width > len) buffer.append(width-len, ' ');
+    buffer.append(str, len);
+  }
+  else {
+    // The value does not fit: the buffer is sized for it.
+    len = snprintf(nullptr, 0, "%.*g", precision, value);
+    if (len < 0) return;
+    string large(len + 1, '\0');
+    snprintf(&large[0], large.size(), "%.*g", precision, value);
+    if (width > len) buffer.append(width-len, ' ');
+    buffer.append(large, 0, len);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FormatValues(const vector<FGOutputValue>& values, const string& delimiter)
+{
+  string buffer;
+
+  for (unsigned int i=0; i<values.size(); i++) {
+    if (i > 0) buffer += delimiter;
+    AppendValue(buffer, values[i].Get(), values[i].Precision, values[i].Width);
+  }
+
+  return buffer;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputDelta::Update(const vector<FGOutputValue>& values, double time)
+{
+  size_t size = values.size();
+
+  if (Last.size() != size) {
+    Last.assign(size, 0.0);
+    Pending = true;
+  }
+  Current.resize(size);
+  Selected.resize(size);
+
+  // The time going backward means that the simulation has been reset.
+  Keyframe = Pending || time < LastTime
+             || (KeyframePeriod > 0.0 && time >= NextKeyframe);
+  LastTime = time;
+
+  if (Keyframe) {
+    Pending = false;
+    NextKeyframe = time + KeyframePeriod;
+  }
+
+  bool selected = Keyframe;
+
+  for (size_t i=0; i<size; i++) {
+    double value = values[i].Get();
+    double last = Last[i];
+    bool changed = Keyframe
+                   || !(value == last || fabs(value - last) <= values[i].Deadband
+                        || (std::isnan(value) && std::isnan(last)));
+    Current[i] = value;
+    Selected[i] = changed;
+    if (changed) {
+      Last[i] = value;
+      selected = true;
+    }
+  }
+
+  return selected;
+}
+}
@@ -0,0 +1,152 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputValue.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTVALUE_H
+#define FGOUTPUTVALUE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "JSBSim_API.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Describes how a value is obtained and formatted by the outputs.
+
+    The models list the values they output (see for instance
+    FGPropulsion::GetPropulsionValueSources()) so that an output can gather
+    them once, when it is opened, instead of building strings at each frame.
+    The precision and the width are those of the stream manipulators
+    std::setprecision() and std::setw() that were used to format the value.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+struct FGOutputValue
+{
+  /// Returns the current value.
+  std::function<double(void)> Get;
+  /// Number of significant digits.
+  int Precision;
+  /// Minimum number of characters, the value is padded with spaces on the left.
+  int Width = 0;
+  /// Smallest change that is output when only the changes are output.
+  double Deadband = 0.0;
+};
+
+/** Selects the values that have changed since the last record.
+
+    This class is used by the outputs that only output the changes (see the
+    attribute delta="ON" of FGOutputType). A value is selected when it has
+    changed by more than its deadband since it was last selected, so that a
+    value that drifts slowly is eventually output. All the values are selected
+    periodically in records named keyframes from which the data can be read
+    without the records that precede them.
+ */
+
+class JSBSIM_API FGOutputDelta
+{
+public:
+  /// Constructor
+  FGOutputDelta(void)
+    : KeyframePeriod(1.0), NextKeyframe(0.0), LastTime(0.0), Keyframe(false),
+      Pending(true) {}
+
+  /** Sets the time between two keyframes.
+      @param period the period in seconds. If it is zero or negative, only the
+                    first record is a keyframe. */
+  void SetKeyframePeriod(double period) { KeyframePeriod = period; }
+  /// Returns the time between two keyframes in seconds.
+  double GetKeyframePeriod(void) const { return KeyframePeriod; }
+
+  /// Requests the next record to be a keyframe.
+  void Reset(void) { Pending = true; }
+
+  /** Reads the values and selects those that are to be output.
+      @param values the sources of the values
+      @param time the time of the record
+      @return false if no value is selected i.e. the record can be skipped */
+  bool Update(const std::vector<FGOutputValue>& values, double time);
+
+  /// Returns true if all the values have been selected by the last update.
+  bool IsKeyframe(void) const { return Keyframe; }
+  /// Returns true if the i-th value has been selected by the last update.
+  bool IsSelected(size_t i) const { return Selected[i] != 0; }
+  /// Returns the i-th value read by the last update.
+  double GetValue(size_t i) const { return Current[i]; }
+
+private:
+  std::vector<double> Current;
+  std::vector<double> Last;
+  std::vector<char> Selected;
+  double KeyframePeriod;
+  double NextKeyframe;
+  double LastTime;
+  bool Keyframe;
+  bool Pending;
+};
+
+/** Appends a value to a string.
+    The value is formatted as the default floating point format of the C++
+    streams would, i.e. as printf("%*.*g", width, precision, value).
+    @param buffer the string to which the value is appended
+    @param value the value to format
+    @param precision the number of significant digits
+    @param width the minimum number of characters */
+JSBSIM_API void AppendValue(std::string& buffer, double value, int precision,
+                            int width = 0);
+
+/** Formats a list of values.
+    @param values the sources of the values
+    @param delimiter the item separator (tab or comma)
+    @return a string with the delimiter-separated values */
+JSBSIM_API std::string FormatValues(const std::vector<FGOutputValue>& values,
+                                    const std::string& delimiter);
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
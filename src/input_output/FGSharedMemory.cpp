@@ -0,0 +1,359 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSharedMemory.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Publish a block of values in a shared memory segment
+ Called by:    FGOutputSharedMemory, FGInputSharedMemory
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class maps a named shared memory segment and implements the seqlock
+protocol used to publish and read the data blocks.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "FGSharedMemory.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "The shared memory segment requires lock free atomics");
+static_assert(sizeof(FGSharedMemory::Header) == 48,
+              "Unexpected size of the shared memory header");
+
+static const char Magic[8] = "JSBSHM";
+static const uint32_t Alignment = 64;
+
+static uint32_t Align(size_t offset)
+{
+  return static_cast<uint32_t>((offset + Alignment - 1) / Alignment * Alignment);
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGSharedMemory::FGSharedMemory(void)
+  : header(nullptr), size(0), owner(false), LastSequence(0)
+{
+#ifdef _WIN32
+  handle = nullptr;
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGSharedMemory::~FGSharedMemory()
+{
+  Close();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGSharedMemory::GetSystemName(const string& name)
+{
+#ifdef _WIN32
+  // Windows does not allow backslashes in the name of a file mapping.
+  string sysname = name;
+  if (!sysname.empty() && sysname[0] == '/') sysname.erase(0, 1);
+  return sysname;
+#else
+  // POSIX portable names start with a slash and contain no other slash.
+  if (!name.empty() && name[0] == '/') return name;
+  return "/" + name;
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGSharedMemory::Create(const string& name, const vector<string>& names)
+{
+  Close();
+
+  for (auto& n: names) {
+    if (n.size() >= NameSize)
+      return "The name " + n + " is too long for the shared memory segment";
+  }
+
+  uint32_t count = static_cast<uint32_t>(names.size());
+  uint32_t table_offset = Align(sizeof(Header));
+  uint32_t block_size = (count+1)*sizeof(double);
+  uint32_t block_offset0 = Align(table_offset + count*sizeof(Entry));
+  uint32_t block_offset1 = Align(block_offset0 + block_size);
+  size_t total_size = Align(block_offset1 + block_size);
+  string sysname = GetSystemName(name);
+  void* addr = nullptr;
+
+#ifdef _WIN32
+  handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
+                              static_cast<DWORD>(total_size), sysname.c_str());
+  if (!handle)
+    return "Could not create the shared memory segment " + name;
+  if (GetLastError() == ERROR_ALREADY_EXISTS) {
+    CloseHandle(handle);
+    handle = nullptr;
+    return "The shared memory segment " + name + " is already in use";
+  }
+  addr = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, total_size);
+  if (!addr) {
+    CloseHandle(handle);
+    handle = nullptr;
+    return "Could not map the shared memory segment " + name;
+  }
+#else
+  // Readers that are still mapping a segment left over by a previous writer
+  // keep their mapping: the name is unlinked rather than truncated.
+  shm_unlink(sysname.c_str());
+  int fd = shm_open(sysname.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0)
+    return "Could not create the shared memory segment " + name + ": "
+      + strerror(errno);
+  if (ftruncate(fd, total_size) < 0) {
+    string error = strerror(errno);
+    close(fd);
+    shm_unlink(sysname.c_str());
+    return "Could not resize the shared memory segment " + name + ": " + error;
+  }
+  addr = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    shm_unlink(sysname.c_str());
+    return "Could not map the shared memory segment " + name;
+  }
+#endif
+
+  header = static_cast<Header*>(addr);
+  size = total_size;
+  owner = true;
+  Name = name;
+
+  memset(addr, 0, total_size);
+  header->version = Version;
+  header->count = count;
+  header->table_offset = table_offset;
+  header->entry_size = sizeof(Entry);
+  header->block_offset[0] = block_offset0;
+  header->block_offset[1] = block_offset1;
+  header->block_size = block_size;
+  header->sequence.store(0, memory_order_relaxed);
+  header->active.store(0, memory_order_relaxed);
+
+  Entry* table = reinterpret_cast<Entry*>(static_cast<char*>(addr) + table_offset);
+  for (uint32_t i=0; i < count; ++i) {
+    table[i].offset = (i+1)*sizeof(double);
+    strncpy(table[i].name, names[i].c_str(), NameSize-1);
+  }
+
+  // The magic number is written last so that readers never see a partially
+  // initialized layout.
+  atomic_thread_fence(memory_order_release);
+  memcpy(header->magic, Magic, sizeof(Magic));
+
+  return "";
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Open(const string& name)
+{
+  Close();
+
+  string sysname = GetSystemName(name);
+  void* addr = nullptr;
+  size_t total_size = 0;
+
+#ifdef _WIN32
+  handle = OpenFileMappingA(FILE_MAP_READ, FALSE, sysname.c_str());
+  if (!handle) return false;
+  addr = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+  if (!addr) {
+    CloseHandle(handle);
+    handle = nullptr;
+    return false;
+  }
+  MEMORY_BASIC_INFORMATION info;
+  if (VirtualQuery(addr, &info, sizeof(info)) != 0)
+    total_size = info.RegionSize;
+#else
+  int fd = shm_open(sysname.c_str(), O_RDONLY, 0);
+  if (fd < 0) return false;
+  struct stat st;
+  if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(Header)) {
+    close(fd);
+    return false;
+  }
+  total_size = st.st_size;
+  addr = mmap(nullptr, total_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) return false;
+#endif
+
+  header = static_cast<Header*>(addr);
+  size = total_size;
+  owner = false;
+  Name = name;
+
+  bool valid = size >= sizeof(Header)
+    && memcmp(header->magic, Magic, sizeof(Magic)) == 0;
+  atomic_thread_fence(memory_order_acquire);
+
+  if (valid) {
+    size_t table_end = (size_t)header->table_offset
+      + (size_t)header->count*header->entry_size;
+    size_t block_size = (header->count+1)*sizeof(double);
+    valid = header->version == Version
+      && header->entry_size == sizeof(Entry)
+      && header->block_size == block_size
+      && table_end <= size
+      && (size_t)header->block_offset[0] + block_size <= size
+      && (size_t)header->block_offset[1] + block_size <= size;
+  }
+
+  if (!valid) {
+    Close();
+    return false;
+  }
+
+  // A sequence number of zero means that nothing has been published yet,
+  // otherwise the first call to Read() copies the current data block.
+  uint32_t seq = header->sequence.load(memory_order_acquire);
+  LastSequence = seq ? seq - 2 : 0;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::Close(void)
+{
+  if (!header) return;
+
+  // Tells the readers that the segment is no longer updated.
+  if (owner) header->magic[0] = '\0';
+
+#ifdef _WIN32
+  UnmapViewOfFile(header);
+  CloseHandle(handle);
+  handle = nullptr;
+#else
+  munmap(header, size);
+  if (owner) shm_unlink(GetSystemName(Name).c_str());
+#endif
+
+  header = nullptr;
+  size = 0;
+  owner = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::IsValid(void) const
+{
+  return header && header->magic[0] == Magic[0];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGSharedMemory::GetName(unsigned int idx) const
+{
+  if (!header || idx >= header->count) return "";
+
+  const Entry* entry = reinterpret_cast<const Entry*>(
+    reinterpret_cast<const char*>(header) + header->table_offset) + idx;
+  return string(entry->name, strnlen(entry->name, NameSize));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedMemory::Write(double time, const double* values)
+{
+  if (!header || !owner) return;
+
+  uint32_t next = 1 - header->active.load(memory_order_relaxed);
+  uint32_t seq = header->sequence.load(memory_order_relaxed);
+
+  // The block that is not published is filled without holding the lock. The
+  // fence orders the previous publication before these stores so that a
+  // reader which is still copying this block detects the change of sequence.
+  atomic_thread_fence(memory_order_release);
+  char* block = Block(next);
+  memcpy(block, &time, sizeof(double));
+  memcpy(block + sizeof(double), values, header->count*sizeof(double));
+
+  header->sequence.store(seq+1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  header->active.store(next, memory_order_relaxed);
+  header->sequence.store(seq+2, memory_order_release);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGSharedMemory::Read(double& time, double* values)
+{
+  if (!header) return false;
+
+  // The writer holds the lock for a handful of instructions so a few attempts
+  // are enough. Giving up rather than spinning prevents a writer that died
+  // while publishing from freezing the reader.
+  for (unsigned int attempt=0; attempt < 64; ++attempt) {
+    uint32_t seq = header->sequence.load(memory_order_acquire);
+    if (seq & 1) {
+      this_thread::yield();
+      continue;
+    }
+    if (seq == LastSequence) return false;
+
+    const char* block = Block(header->active.load(memory_order_relaxed));
+    memcpy(&time, block, sizeof(double));
+    memcpy(values, block + sizeof(double), header->count*sizeof(double));
+
+    atomic_thread_fence(memory_order_acquire);
+    if (header->sequence.load(memory_order_relaxed) == seq) {
+      LastSequence = seq;
+      return true;
+    }
+  }
+
+  return false;
+}
+}
@@ -0,0 +1,176 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSharedMemory.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSHAREDMEMORY_H
+#define FGSHAREDMEMORY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Encapsulates a named shared memory segment that publishes a block of
+    doubles to processes running on the same host.
+
+    The segment starts with a Header followed by a table of Entry records which
+    give the name of each value and its byte offset in a data block. Two data
+    blocks follow the table: the writer fills the block that is not being
+    published then flips the index of the active block. The flip is protected
+    by a sequence lock (seqlock) so that readers never block the writer nor
+    each other: a reader checks that the sequence number is even and unchanged
+    before and after copying the active block and retries otherwise.
+
+    Each data block starts with the simulation time followed by the values in
+    the order of the table. All the offsets are relative to the beginning of
+    the segment so that the layout can be read by programs written in any
+    language. There must be only one writer per segment.
+
+    The segment is created with shm_open() on POSIX systems and with
+    CreateFileMapping() on Windows.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedMemory
+{
+public:
+  static constexpr uint32_t Version = 1;
+  static constexpr unsigned int NameSize = 120;
+
+  struct Header {
+    char magic[8];              ///< "JSBSHM" followed by two null characters
+    uint32_t version;           ///< Version of the layout
+    uint32_t count;             ///< Number of values in a data block
+    uint32_t table_offset;      ///< Offset of the first Entry
+    uint32_t entry_size;        ///< Size of an Entry
+    uint32_t block_offset[2];   ///< Offsets of the data blocks
+    uint32_t block_size;        ///< Size of a data block
+    uint32_t padding;
+    std::atomic<uint32_t> sequence; ///< Odd while a block is being published
+    std::atomic<uint32_t> active;   ///< Index of the last published block
+  };
+
+  struct Entry {
+    uint32_t offset;            ///< Offset of the value in a data block
+    uint32_t padding;
+    char name[NameSize];        ///< Null terminated name of the value
+  };
+
+  /// Constructor
+  FGSharedMemory(void);
+  /// Destructor. The segment is removed if it has been created by this instance.
+  ~FGSharedMemory();
+
+  FGSharedMemory(const FGSharedMemory&) = delete;
+  FGSharedMemory& operator=(const FGSharedMemory&) = delete;
+
+  /** Creates a segment and initializes its header and table. A segment with
+      the same name is replaced.
+      @param name name of the segment
+      @param names names of the values
+      @return an empty string if the segment has been created, an error message
+              otherwise. */
+  std::string Create(const std::string& name,
+                     const std::vector<std::string>& names);
+
+  /** Maps an existing segment in read only mode.
+      @param name name of the segment
+      @return false if the segment does not exist (yet) or if its layout is not
+              valid. */
+  bool Open(const std::string& name);
+
+  /// Unmaps the segment.
+  void Close(void);
+
+  bool IsOpen(void) const { return header != nullptr; }
+
+  /** Checks that the writer has not closed the segment since it has been
+      opened. A writer that restarts creates a new segment under the same name
+      so the readers must open it again. */
+  bool IsValid(void) const;
+
+  /// Name of the segment.
+  const std::string& GetSegmentName(void) const { return Name; }
+
+  /// Number of values in a data block (excluding the time).
+  unsigned int GetNumValues(void) const { return header ? header->count : 0; }
+
+  /// Name of the value at the given index.
+  std::string GetName(unsigned int idx) const;
+
+  /** Publishes a new data block. Must only be called by the writer.
+      @param time simulation time
+      @param values array of GetNumValues() values */
+  void Write(double time, const double* values);
+
+  /** Copies the last published data block if it has changed since the
+      previous call.
+      @param time simulation time of the data block
+      @param values array of GetNumValues() values
+      @return true if a new data block has been copied. */
+  bool Read(double& time, double* values);
+
+private:
+  Header* header;
+  size_t size;
+  bool owner;
+  uint32_t LastSequence;
+  std::string Name;
+#ifdef _WIN32
+  void* handle;
+#endif
+
+  static std::string GetSystemName(const std::string& name);
+  char* Block(uint32_t idx) const
+  { return reinterpret_cast<char*>(header) + header->block_offset[idx]; }
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,282 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGUDPBinaryInputSocket.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Manage input of binary data from a UDP socket
+ Called by:    FGInput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class establishes a UDP socket and reads binary datagrams from it. The
+layout of the datagrams is described in the XML input directives.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "FGUDPBinaryInputSocket.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "string_utilities.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+static bool IsLittleEndian(void)
+{
+  const uint16_t one = 1;
+  unsigned char first_byte;
+  memcpy(&first_byte, &one, 1);
+  return first_byte == 1;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGUDPBinaryInputSocket::FGUDPBinaryInputSocket(FGFDMExec* fdmex) :
+  FGInputSocket(fdmex), hasSequence(false), hasTimeStamp(false),
+  swapBytes(false), PacketSize(0), LastBuffer(0), FirstPacket(true),
+  LastSequence(0), LastTimeStamp(0.0)
+{
+  SockProtocol = FGfdmSocket::ptUDP;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUDPBinaryInputSocket::Load(Element* el)
+{
+  if (!FGInputSocket::Load(el))
+    return false;
+
+  if (el->HasAttribute("rate")) {
+    double rate = el->GetAttributeValueAsNumber("rate");
+    if (rate > 0.0)
+      SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*rate));
+  }
+
+  string endian = el->GetAttributeValue("endian");
+  to_lower(endian);
+  if (endian.empty() || endian == "little")
+    swapBytes = !IsLittleEndian();
+  else if (endian == "big")
+    swapBytes = IsLittleEndian();
+  else {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "Unknown endianness: " << endian << "\n";
+    return false;
+  }
+
+  Fields.clear();
+  hasSequence = hasTimeStamp = false;
+  PacketSize = 0;
+
+  for (unsigned int i=0; i < el->GetNumElements(); ++i) {
+    Element* field_element = el->GetElement(i);
+    const string& name = field_element->GetName();
+
+    if (name == "skip") {
+      int bytes = atoi(field_element->GetAttributeValue("bytes").c_str());
+      if (bytes <= 0) {
+        FGXMLLogging log(FDMExec->GetLogger(), field_element, LogLevel::ERROR);
+        log << "The number of bytes to skip must be a positive integer\n";
+        return false;
+      }
+      PacketSize += bytes;
+    } else if (name == "sequence") {
+      if (hasSequence || !LoadField(field_element, Sequence)) return false;
+      if (Sequence.type != ftUInt8 && Sequence.type != ftUInt16
+          && Sequence.type != ftUInt32) {
+        FGXMLLogging log(FDMExec->GetLogger(), field_element, LogLevel::ERROR);
+        log << "The sequence number must be an unsigned integer\n";
+        return false;
+      }
+      hasSequence = true;
+    } else if (name == "timestamp") {
+      if (hasTimeStamp || !LoadField(field_element, TimeStamp)) return false;
+      hasTimeStamp = true;
+    } else if (name == "property") {
+      Field field;
+      if (!LoadField(field_element, field)) return false;
+
+      string property_str = field_element->GetDataLine();
+      field.node = PropertyManager->GetNode(property_str);
+      if (!field.node) {
+        FGXMLLogging log(FDMExec->GetLogger(), field_element, LogLevel::ERROR);
+        log << LogFormat::RED << LogFormat::BOLD << "\n  No property by the name "
+            << property_str << " can be found.\n" << LogFormat::RESET;
+        return false;
+      }
+      Fields.push_back(field);
+    }
+  }
+
+  if (Fields.empty()) {
+    FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+    log << "No property is defined in the binary input layout\n";
+    return false;
+  }
+
+  // One extra byte is allocated to detect the datagrams that are larger than
+  // the declared layout.
+  Buffers[0].resize(PacketSize+1);
+  Buffers[1].resize(PacketSize+1);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUDPBinaryInputSocket::LoadField(Element* el, Field& field)
+{
+  static const struct {
+    const char* name;
+    FieldType type;
+    unsigned int size;
+  } types[] = {
+    {"int8", ftInt8, 1}, {"uint8", ftUInt8, 1},
+    {"int16", ftInt16, 2}, {"uint16", ftUInt16, 2},
+    {"int32", ftInt32, 4}, {"uint32", ftUInt32, 4},
+    {"float", ftFloat, 4}, {"double", ftDouble, 8}
+  };
+
+  string type = el->GetAttributeValue("type");
+  to_lower(type);
+  if (type.empty()) type = "double";
+
+  for (auto& t: types) {
+    if (type == t.name) {
+      field.type = t.type;
+      field.size = t.size;
+      field.offset = PacketSize;
+      field.factor = 1.0;
+      if (el->HasAttribute("factor"))
+        field.factor = el->GetAttributeValueAsNumber("factor");
+
+      PacketSize += t.size;
+      return true;
+    }
+  }
+
+  FGXMLLogging log(FDMExec->GetLogger(), el, LogLevel::ERROR);
+  log << "Unknown binary type: " << type << "\n";
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUDPBinaryInputSocket::InitModel(void)
+{
+  FirstPacket = true;
+  return FGInputSocket::InitModel();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGUDPBinaryInputSocket::Decode(const char* packet, const Field& field) const
+{
+  unsigned char bytes[8];
+
+  memcpy(bytes, packet + field.offset, field.size);
+  if (swapBytes) reverse(bytes, bytes + field.size);
+
+  switch (field.type) {
+  case ftInt8:   { int8_t   v; memcpy(&v, bytes, 1); return v; }
+  case ftUInt8:  { uint8_t  v; memcpy(&v, bytes, 1); return v; }
+  case ftInt16:  { int16_t  v; memcpy(&v, bytes, 2); return v; }
+  case ftUInt16: { uint16_t v; memcpy(&v, bytes, 2); return v; }
+  case ftInt32:  { int32_t  v; memcpy(&v, bytes, 4); return v; }
+  case ftUInt32: { uint32_t v; memcpy(&v, bytes, 4); return v; }
+  case ftFloat:  { float    v; memcpy(&v, bytes, 4); return v; }
+  case ftDouble: { double   v; memcpy(&v, bytes, 8); return v; }
+  }
+
+  return 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGUDPBinaryInputSocket::IsNewer(const char* packet)
+{
+  uint64_t sequence = 0;
+  double timestamp = 0.0;
+
+  if (hasSequence) sequence = (uint64_t)Decode(packet, Sequence);
+  if (hasTimeStamp) timestamp = Decode(packet, TimeStamp) * TimeStamp.factor;
+
+  if (!FirstPacket) {
+    if (hasSequence) {
+      // Serial number arithmetic: the sequence number is allowed to wrap
+      // around.
+      uint64_t range = UINT64_C(1) << (8*Sequence.size);
+      uint64_t delta = (sequence - LastSequence) & (range - 1);
+      if (delta == 0 || delta >= range/2) return false;
+    }
+    if (hasTimeStamp && timestamp <= LastTimeStamp) return false;
+  }
+
+  FirstPacket = false;
+  LastSequence = sequence;
+  LastTimeStamp = timestamp;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGUDPBinaryInputSocket::Read(bool Holding)
+{
+  if (socket == 0) return;
+
+  bool received = false;
+  int num_bytes;
+
+  // Drain the socket and keep the most recent valid datagram.
+  while ((num_bytes = socket->Receive(Buffers[1-LastBuffer].data(),
+                                      PacketSize+1)) > 0) {
+    const char* packet = Buffers[1-LastBuffer].data();
+
+    if ((unsigned int)num_bytes != PacketSize || !IsNewer(packet)) continue;
+
+    LastBuffer = 1 - LastBuffer;
+    received = true;
+  }
+
+  if (!received) return;
+
+  const char* packet = Buffers[LastBuffer].data();
+
+  for (auto& field: Fields)
+    field.node->setDoubleValue(Decode(packet, field) * field.factor);
+}
+
+}
@@ -0,0 +1,144 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGUDPBinaryInputSocket.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGUDPBINARYINPUTSOCKET_H
+#define FGUDPBINARYINPUTSOCKET_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <vector>
+
+#include "FGInputSocket.h"
+#include "simgear/props/props.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements a binary UDP input socket.
+
+    The layout of the datagrams is declared in the XML input directives: the
+    fields are packed in the order in which they are declared, without any
+    padding unless explicitly requested with a <tt>skip</tt> element. The
+    property nodes are bound once at load time so that decoding a datagram
+    neither parses text nor allocates memory.
+
+@code
+<input type="BINARY" port="5140" endian="little" rate="1000">
+  <sequence type="uint32"/>
+  <timestamp type="double"/>
+  <property type="float"> fcs/aileron-cmd-norm </property>
+  <property type="int16" factor="0.001"> fcs/elevator-cmd-norm </property>
+  <skip bytes="2"/>
+  <property type="double"> fcs/throttle-cmd-norm[0] </property>
+</input>
+@endcode
+
+    - <tt>endian</tt> is either "little" (default) or "big".
+    - <tt>type</tt> is one of int8, uint8, int16, uint16, int32, uint32, float
+      or double. The sequence number must be an unsigned integer.
+    - <tt>factor</tt> is an optional scale factor applied to the raw value.
+    - <tt>rate</tt> is the rate in Hz at which the socket is read. By default
+      it is read at each time step.
+
+    All the datagrams pending on the socket are read at each call to Read() but
+    only the most recent valid one is applied to the properties. Datagrams
+    whose size does not match the layout are discarded as well as datagrams
+    which sequence number (modulo the range of its type) or time stamp is not
+    strictly greater than that of the last accepted datagram.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGUDPBinaryInputSocket : public FGInputSocket
+{
+public:
+  /** Constructor. */
+  FGUDPBinaryInputSocket(FGFDMExec* fdmex);
+
+  /** Reads the packet layout from an XML file.
+      @param element The root XML Element of the input file.
+  */
+  bool Load(Element* el) override;
+
+  /** Opens the socket and resets the sequence number and time stamp checks.
+      @result true if the execution succeeded. */
+  bool InitModel(void) override;
+
+  /// Reads the socket and updates properties accordingly.
+  void Read(bool Holding) override;
+
+protected:
+  enum FieldType {ftInt8, ftUInt8, ftInt16, ftUInt16, ftInt32, ftUInt32,
+                  ftFloat, ftDouble};
+
+  struct Field {
+    FieldType type;
+    unsigned int size;
+    unsigned int offset;
+    double factor;
+    SGPropertyNode_ptr node;
+  };
+
+  std::vector<Field> Fields;
+  Field Sequence;
+  Field TimeStamp;
+  bool hasSequence;
+  bool hasTimeStamp;
+  bool swapBytes;
+  unsigned int PacketSize;
+
+  std::vector<char> Buffers[2];
+  unsigned int LastBuffer;
+  bool FirstPacket;
+  uint64_t LastSequence;
+  double LastTimeStamp;
+
+  bool LoadField(Element* el, Field& field);
+  double Decode(const char* packet, const Field& field) const;
+  bool IsNewer(const char* packet);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
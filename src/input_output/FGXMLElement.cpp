@@ -29,8 +29,11 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iostream>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>  // for assembling the error messages / what of exceptions.
 #include <stdexcept>  // using domain_error, invalid_argument, and length_error.
+#include <unordered_set>
 
 #include "FGXMLElement.h"
 #include "FGJSBBase.h"
@@ -44,22 +47,64 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
-bool Element::converterIsInitialized = false;
 map <string, map <string, double> > Element::convert;
 
+namespace {
+// Pool of the element names, attribute names and file names. Each string is
+// stored once and is never released so that the elements can refer to it by
+// address. The pool is shared by the threads that load models concurrently.
+class StringPool {
+public:
+  const string* Insert(const string& s) {
+    {
+      shared_lock<shared_mutex> lock(mutex);
+      auto it = strings.find(s);
+      if (it != strings.end()) return &*it;
+    }
+    unique_lock<shared_mutex> lock(mutex);
+    return &*strings.insert(s).first;
+  }
+
+  // Returns nullptr if the string has never been inserted.
+  const string* Find(const string& s) const {
+    shared_lock<shared_mutex> lock(mutex);
+    auto it = strings.find(s);
+    return it != strings.end() ? &*it : nullptr;
+  }
+
+private:
+  mutable shared_mutex mutex;
+  unordered_set<string> strings;
+};
+
+StringPool& GetStringPool(void)
+{
+  static StringPool pool;
+  return pool;
+}
+
+const string& EmptyString(void)
+{
+  static const string empty;
+  return empty;
+}
+}
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 Element::Element(const string& nm)
 {
-  name   = nm;
+  name   = GetStringPool().Insert(nm);
+  file_name = &EmptyString();
   parent = 0L;
   element_index = 0;
   line_number = -1;
 
-  if (!converterIsInitialized) {
-    converterIsInitialized = true;
+  // Elements may be created concurrently (see FGXMLPreloader).
+  static once_flag converterIsInitialized;
+  call_once(converterIsInitialized, []() {
     // convert ["from"]["to"] = factor, so: from * factor = to
     // Length
     convert["M"]["FT"] = 3.2808399;
@@ -251,7 +296,7 @@ Element::Element(const string& nm)
     convert["VOLTS"]["VOLTS"] = 1.0;
     convert["OHMS"]["OHMS"] = 1.0;
     convert["AMPERES"]["AMPERES"] = 1.0;
-  }
+  });
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -264,21 +309,61 @@ Element::~Element(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void Element::ChangeName(const string& _name)
+{
+  name = GetStringPool().Insert(_name);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void Element::SetFileName(const string& name)
+{
+  file_name = GetStringPool().Insert(name);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element::AttributeList::iterator Element::FindAttribute(const string& key)
+{
+  auto it = attributes.begin();
+  while (it != attributes.end() && *it->first != key) ++it;
+  return it;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element::AttributeList::const_iterator Element::FindAttribute(const string& key) const
+{
+  auto it = attributes.cbegin();
+  while (it != attributes.cend() && *it->first != key) ++it;
+  return it;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool Element::HasAttribute(const string& key) const
+{
+  return FindAttribute(key) != attributes.end();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string Element::GetAttributeValue(const string& attr)
 {
-  if (HasAttribute(attr))  return attributes[attr];
-  else                     return ("");
+  auto it = FindAttribute(attr);
+  if (it != attributes.end())  return it->second;
+  else                         return ("");
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool Element::SetAttributeValue(const std::string& key, const std::string& value)
 {
-  bool ret = HasAttribute(key);
-  if (ret)
-    attributes[key] = value;
+  auto it = FindAttribute(key);
+  if (it == attributes.end()) return false;
 
-  return ret;
+  it->second = value;
+  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -337,10 +422,10 @@ Element* Element::GetNextElement(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string Element::GetDataLine(unsigned int i)
+const string& Element::GetDataLine(unsigned int i) const
 {
   if (!data_lines.empty()) return data_lines[i];
-  else return string("");
+  else return EmptyString();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -366,13 +451,13 @@ double Element::GetDataAsNumber(void)
     throw length_error(s.str());
   } else {
     cerr << ReadFrom() << "Attempting to get single data value in element "
-         << "<" << name << ">" << endl
+         << "<" << *name << ">" << endl
          << " from multiple lines:" << endl;
     for(unsigned int i=0; i<data_lines.size(); ++i)
       cerr << data_lines[i] << endl;
     std::stringstream s;
     s << ReadFrom() << "Attempting to get single data value in element "
-      << "<" << name << ">"
+      << "<" << *name << ">"
       << " from multiple lines (" << data_lines.size() << ").";
     throw length_error(s.str());
   }
@@ -380,6 +465,21 @@ double Element::GetDataAsNumber(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void Element::GetDataAsNumbers(vector<double>& values) const
+{
+  try {
+    for (const auto& line: data_lines)
+      read_numbers_locale_c(line, values);
+  } catch (InvalidNumber& e) {
+    std::stringstream s;
+    s << ReadFrom() << e.what();
+    cerr << s.str() << endl;
+    throw BaseException(s.str());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 unsigned int Element::GetNumElements(const string& element_name)
 {
   unsigned int number_of_elements=0;
@@ -399,8 +499,10 @@ Element* Element::FindElement(const string& el)
     element_index = 1;
     return children[0];
   }
-  for (unsigned int i=0; i<children.size(); i++) {
-    if (el == children[i]->GetName()) {
+  // No child can match a name that has never been interned.
+  const string* key = GetStringPool().Find(el);
+  for (unsigned int i=0; key && i<children.size(); i++) {
+    if (key == children[i]->name) {
       element_index = i+1;
       return children[i];
     }
@@ -421,8 +523,9 @@ Element* Element::FindNextElement(const string& el)
       return 0L;
     }
   }
-  for (unsigned int i=element_index; i<children.size(); i++) {
-    if (el == children[i]->GetName()) {
+  const string* key = GetStringPool().Find(el);
+  for (unsigned int i=element_index; key && i<children.size(); i++) {
+    if (key == children[i]->name) {
       element_index = i+1;
       return children[i];
     }
@@ -699,11 +802,10 @@ void Element::Print(unsigned int level)
 
   level+=2;
   for (spaces=0; spaces<=level; spaces++) cout << " "; // format output
-  cout << "Element Name: " << name;
+  cout << "Element Name: " << *name;
 
-  map<string, string>::iterator it;
-  for (it = attributes.begin(); it != attributes.end(); ++it)
-    cout << "  " << it->first << " = " << it->second;
+  for (const auto& attribute: attributes)
+    cout << "  " << *attribute.first << " = " << attribute.second;
 
   cout << endl;
   for (i=0; i<data_lines.size(); i++) {
@@ -719,7 +821,11 @@ void Element::Print(unsigned int level)
 
 void Element::AddAttribute(const string& name, const string& value)
 {
-  attributes[name] = value;
+  auto it = FindAttribute(name);
+  if (it != attributes.end())
+    it->second = value;
+  else
+    attributes.emplace_back(GetStringPool().Insert(name), value);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -750,17 +856,16 @@ string Element::ReadFrom(void) const
 
 void Element::MergeAttributes(Element* el)
 {
-  map<string, string>::iterator it;
-
-  for (it=el->attributes.begin(); it != el->attributes.end(); ++it) {
-    if (attributes.find(it->first) == attributes.end())
-      attributes[it->first] = it->second;
+  for (const auto& attribute: el->attributes) {
+    auto it = FindAttribute(*attribute.first);
+    if (it == attributes.end())
+      attributes.push_back(attribute);
     else {
-      if (FGJSBBase::debug_lvl > 0 && (attributes[it->first] != it->second))
-        cout << el->ReadFrom() << " Attribute '" << it->first << "' is overridden in file "
+      if (FGJSBBase::debug_lvl > 0 && (it->second != attribute.second))
+        cout << el->ReadFrom() << " Attribute '" << *attribute.first << "' is overridden in file "
              << GetFileName() << ": line " << GetLineNumber() << endl
-             << " The value '" << attributes[it->first] << "' will be used instead of '"
-             << it->second << "'." << endl;
+             << " The value '" << it->second << "' will be used instead of '"
+             << attribute.second << "'." << endl;
     }
   }
 }
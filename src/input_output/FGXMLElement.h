@@ -36,6 +36,7 @@ INCLUDES
 
 #include <string>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "simgear/structure/SGSharedPtr.hxx"
@@ -142,6 +143,10 @@ CLASS DECLARATION
 
 class JSBSIM_API Element : public SGReferenced {
 public:
+  /** List of the attributes of an element. The attribute names point to
+      strings that are shared by all the elements (see GetName()). */
+  typedef std::vector<std::pair<const std::string*, std::string>> AttributeList;
+
   /** Constructor
       @param nm the name of this element (if given)
       */
@@ -152,7 +157,7 @@ public:
   /** Determines if an element has the supplied attribute.
       @param key specifies the attribute key to retrieve the value of.
       @return true or false. */
-  bool HasAttribute(const std::string& key) {return attributes.find(key) != attributes.end();}
+  bool HasAttribute(const std::string& key) const;
 
   /** Retrieves an attribute.
       @param key specifies the attribute key to retrieve the value of.
@@ -174,16 +179,24 @@ public:
               attribute exists. */
   double GetAttributeValueAsNumber(const std::string& key);
 
+  /** Retrieves all the attributes.
+      @return the list of the attributes in the order in which they have been
+              added. */
+  const AttributeList& GetAttributes(void) const { return attributes; }
+
   /** Retrieves the element name.
+      The element and attribute names are interned: all the elements with the
+      same name refer to the same string so the name can be compared by
+      address.
       @return the element name, or the empty string if no name has been set.*/
-  const std::string& GetName(void) const {return name;}
-  void ChangeName(const std::string& _name) { name = _name; }
+  const std::string& GetName(void) const {return *name;}
+  void ChangeName(const std::string& _name);
 
   /** Gets a line of data belonging to an element.
       @param i the index of the data line to return (0 by default).
       @return a string representing the data line requested, or the empty string
               if none exists.*/
-  std::string GetDataLine(unsigned int i=0);
+  const std::string& GetDataLine(unsigned int i=0) const;
 
   /// Returns the number of lines of data stored
   unsigned int GetNumDataLines(void) {return (unsigned int)data_lines.size();}
@@ -201,6 +214,13 @@ public:
       @return the numeric value of the data owned by the element.*/
   double GetDataAsNumber(void);
 
+  /** Converts all the element data to numbers.
+      The numbers separated by white spaces in the data lines are parsed in
+      place and appended to a vector, without building intermediate strings.
+      This is intended for large blocks of numbers such as table data.
+      @param values the vector to which the numbers are appended. */
+  void GetDataAsNumbers(std::vector<double>& values) const;
+
   /** Returns a pointer to the element requested by index.
       This function also resets an internal counter to the index, so that
       subsequent calls to GetNextElement() will return the following
@@ -232,7 +252,7 @@ public:
   /** Returns the name of the file in which the element has been read.
       @return the file name
   */
-  const std::string& GetFileName(void) const { return file_name; }
+  const std::string& GetFileName(void) const { return *file_name; }
 
   /** Searches for a specified element.
       Finds the first element that matches the supplied string, or simply the first
@@ -366,7 +386,7 @@ public:
   /** Set the name of the file in which the element has been read.
    *  @param name file name
    */
-  void SetFileName(const std::string& name) { file_name = name; }
+  void SetFileName(const std::string& name);
 
   /** Return a string that contains a description of the location where the
    *  current XML element was read from.
@@ -385,17 +405,19 @@ public:
   void MergeAttributes(Element* el);
 
 private:
-  std::string name;
-  std::map <std::string, std::string> attributes;
+  const std::string* name;
+  AttributeList attributes;
   std::vector <std::string> data_lines;
   std::vector <Element_ptr> children;
   Element *parent;
   unsigned int element_index;
-  std::string file_name;
+  const std::string* file_name;
   int line_number;
   typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
   static tMapConvert convert;
-  static bool converterIsInitialized;
+
+  AttributeList::iterator FindAttribute(const std::string& key);
+  AttributeList::const_iterator FindAttribute(const std::string& key) const;
 };
 
 } // namespace JSBSim
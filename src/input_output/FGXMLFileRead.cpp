@@ -29,6 +29,8 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGXMLFileRead.h"
+#include "FGCompiledModel.h"
+#include "FGXMLPreloader.h"
 #include "simgear/io/iostreams/sgstream.hxx"
 
 namespace JSBSim {
@@ -42,9 +44,28 @@ Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
 {
   sg_ifstream infile;
   SGPath filename(XML_filename);
+  FGCompiledModel* compiled = FGCompiledModel::GetActive();
   if (!filename.isNull()) {
     if (filename.extension().empty())
       filename.concat(".xml");
+
+    // The documents of a compiled model are instantiated without parsing XML.
+    // The files that it does not contain are parsed.
+    if (compiled && !compiled->IsRecording()) {
+      loaded_document = compiled->LoadDocument(filename);
+      if (loaded_document) return loaded_document;
+    }
+
+    // Files parsed ahead of time are not parsed again.
+    FGXMLPreloader* preloader = FGXMLPreloader::GetActive();
+    if (preloader) {
+      loaded_document = preloader->Take(filename);
+      if (loaded_document) {
+        if (compiled) compiled->AddDocument(filename, loaded_document);
+        return loaded_document;
+      }
+    }
+
     infile.open(filename);
     if ( !infile.is_open()) {
       if (verbose) std::cerr << "Could not open file: " << filename << std::endl;
@@ -57,6 +78,7 @@ Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
   readXML(infile, fparse, filename.utf8Str());
   Element* document = fparse.GetDocument();
   infile.close();
+  if (compiled) compiled->AddDocument(filename, document);
   return document;
 }
 
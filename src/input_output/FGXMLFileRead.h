@@ -57,10 +57,12 @@ public:
   Element* LoadXMLDocument(const SGPath& XML_filename, FGXMLParse& fparse,
                            bool verbose=true);
 
-  void ResetParser(void) {file_parser.reset();}
+  void ResetParser(void) {file_parser.reset(); loaded_document = nullptr;}
 
 private:
   FGXMLParse file_parser;
+  // Document that has not been parsed by file_parser (compiled or preloaded).
+  Element_ptr loaded_document;
 };
 }
 #endif
@@ -29,8 +29,10 @@
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <cctype>
+#include <cstring>
+
 #include "FGXMLParse.h"
-#include "input_output/string_utilities.h"
 
 using namespace std;
 
@@ -50,9 +52,19 @@ void FGXMLParse::reset(void)
 
 void FGXMLParse::dumpDataLines(void)
 {
-  if (!working_string.empty()) {
-    for (auto s: split(working_string, '\n'))
-      current_element->AddData(s);
+  // Split the data in trimmed lines without copying the remainder of the
+  // string for each line: large <tableData> blocks have thousands of lines.
+  const char* p = working_string.c_str();
+  const char* end = p + working_string.size();
+
+  while (p < end) {
+    const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+    if (!eol) eol = end;
+    const char* last = eol;
+    while (p < last && isspace((unsigned char)*p)) ++p;
+    while (last > p && isspace((unsigned char)*(last-1))) --last;
+    if (p < last) current_element->AddData(string(p, last));
+    p = eol + 1;
   }
   working_string.erase();
 }
@@ -101,7 +113,7 @@ void FGXMLParse::endElement (const char * name)
 
 void FGXMLParse::data (const char * s, int length)
 {
-  working_string += string(s, length);
+  working_string.append(s, length);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -0,0 +1,152 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGXMLPreloader.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Concurrent parsing of the XML files referenced by an aircraft
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "FGXMLPreloader.h"
+#include "FGXMLParse.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+namespace {
+  thread_local FGXMLPreloader* ActivePreloader = nullptr;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGXMLPreloader* FGXMLPreloader::GetActive(void)
+{
+  return ActivePreloader;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGXMLPreloader::Scope::Scope(FGXMLPreloader& preloader)
+  : previous(ActivePreloader)
+{
+  ActivePreloader = &preloader;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGXMLPreloader::Scope::~Scope()
+{
+  ActivePreloader = previous;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<FGXMLPreloader::File>::iterator FGXMLPreloader::Find(const SGPath& path)
+{
+  SGPath filename(path);
+  if (filename.extension().empty())
+    filename.concat(".xml");
+
+  return find_if(Files.begin(), Files.end(),
+                 [&](const File& file) { return file.path == filename; });
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLPreloader::Add(const SGPath& path)
+{
+  if (path.isNull() || Find(path) != Files.end()) return;
+
+  File file {path, nullptr};
+  if (file.path.extension().empty())
+    file.path.concat(".xml");
+  Files.push_back(file);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLPreloader::Run(unsigned int threads)
+{
+  const unsigned int nFiles = static_cast<unsigned int>(Files.size());
+  if (threads == 0) threads = max(thread::hardware_concurrency(), 1U);
+  threads = min(threads, nFiles);
+
+  // Each file is parsed in a separate document: the only state shared by the
+  // threads is the pool of the interned names of FGXMLElement.
+  atomic<unsigned int> next_file(0);
+  auto parse_files = [&]() {
+    unsigned int i;
+    while ((i = next_file++) < nFiles)
+      Files[i].document = Parse(Files[i].path);
+  };
+
+  vector<thread> pool;
+  for (unsigned int i=1; i < threads; ++i)
+    pool.emplace_back(parse_files);
+  if (threads > 0) parse_files();
+  for (auto& t: pool) t.join();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGXMLPreloader::Parse(const SGPath& path)
+{
+  sg_ifstream infile(path);
+  if (!infile.is_open()) return nullptr;
+
+  FGXMLParse parser;
+  try {
+    readXML(infile, parser, path.utf8Str(), false);
+  } catch (...) {
+    return nullptr;
+  }
+
+  return parser.GetDocument();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr FGXMLPreloader::Take(const SGPath& path)
+{
+  auto it = Find(path);
+  if (it == Files.end()) return nullptr;
+
+  Element_ptr document = it->document;
+  it->document = nullptr;
+  return document;
+}
+
+} // namespace JSBSim
@@ -0,0 +1,127 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGXMLPreloader.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGXMLPRELOADER_H
+#define FGXMLPRELOADER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#include "JSBSim_API.h"
+#include "input_output/FGXMLElement.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Parses a set of XML files concurrently ahead of their use.
+
+    The files referenced by an aircraft (engines, thrusters, systems) are
+    independent documents. FGFDMExec::LoadModel() schedules them with Add()
+    and parses them on a pool of threads with Run() before the models are
+    built. While the preloader is active (see Scope), FGXMLFileRead returns
+    the preloaded documents instead of parsing the files again, so the models
+    are still built serially and in the same order as without a preloader.
+
+    A document is handed out only once: a file that is read a second time is
+    parsed again, as it would be without a preloader. The errors are not
+    reported by the threads of the pool: a file that can not be parsed is
+    simply not preloaded, and the error is reported when the file is read by
+    the model that needs it. The error messages are therefore issued in the
+    same order as when the files are loaded serially.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGXMLPreloader
+{
+public:
+  /** Schedules the parsing of a file. Null paths and files that have already
+      been scheduled are ignored.
+      @param path path to the file (".xml" is appended if it has no
+                  extension) */
+  void Add(const SGPath& path);
+
+  /** Parses the scheduled files.
+      @param threads maximum number of threads. 0 selects one thread per
+                     hardware thread. */
+  void Run(unsigned int threads=0);
+
+  /** Hands out the document parsed from a file.
+      @return nullptr if the file has not been preloaded, has failed to parse
+              or has already been handed out. */
+  Element_ptr Take(const SGPath& path);
+
+  /// Number of scheduled files.
+  size_t GetNumFiles(void) const { return Files.size(); }
+
+  /// Returns the preloader that is active in the calling thread (if any).
+  static FGXMLPreloader* GetActive(void);
+
+  /// Activates a preloader in the calling thread during its lifetime.
+  class JSBSIM_API Scope {
+  public:
+    explicit Scope(FGXMLPreloader& preloader);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  private:
+    FGXMLPreloader* previous;
+  };
+
+private:
+  struct File {
+    SGPath path;
+    Element_ptr document;
+  };
+
+  std::vector<File> Files;
+
+  static Element_ptr Parse(const SGPath& path);
+  std::vector<File>::iterator Find(const SGPath& path);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -321,6 +321,31 @@ string FGfdmSocket::Receive(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+int FGfdmSocket::Receive(char* buffer, int size)
+{
+  assert(Protocol == ptUDP);
+  if (sckt == INVALID_SOCKET) return 0;
+
+  struct sockaddr addr;
+  socklen_t fromlen = sizeof addr;
+  int num_chars = recvfrom(sckt, buffer, size, 0, (struct sockaddr*)&addr, &fromlen);
+  if (num_chars == SOCKET_ERROR) {
+#ifdef _WIN32
+    int error = WSAGetLastError();
+    // A truncated datagram is reported as an error by Winsock.
+    if (error == WSAEMSGSIZE) return size;
+    if (error != WSAEWOULDBLOCK)
+#else
+    if (errno != EWOULDBLOCK && errno != EAGAIN)
+#endif
+      LogSocketError("Receive - UDP data reception");
+    return 0;
+  }
+
+  return num_chars;
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 int FGfdmSocket::Reply(const string& text)
 {
   int num_chars_sent=0;
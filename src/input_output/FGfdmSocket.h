@@ -115,6 +115,18 @@ public:
    */
   std::string Receive(void);
 
+  /**
+   * @brief Receive a single datagram from a UDP socket.
+   *
+   * The datagram is copied in the buffer supplied by the caller so that no
+   * memory is allocated. A datagram larger than the buffer is truncated.
+   *
+   * @param buffer The buffer where the datagram is copied.
+   * @param size The size of the buffer.
+   * @return The number of bytes received or 0 if no datagram is pending.
+   */
+  int Receive(char* buffer, int size);
+
   /**
    * @brief Send a reply to the client ending by a prompt "JSBSim>"
    *
@@ -41,6 +41,7 @@ INCLUDES
 #include <iostream>
 #include <sstream>
 #include <stdio.h>
+#include <string.h>
 #include <regex>
 #ifdef __APPLE__
 #include <xlocale.h>
@@ -79,6 +80,12 @@ struct CNumericLocale
   locale_t Locale;
 };
 
+static locale_t GetNumericLocale(void)
+{
+  static const CNumericLocale numeric_c;
+  return numeric_c.Locale;
+}
+
 /* A locale independent version of atof().
  * Whatever is the current locale of the application, atof_locale_c() reads
  * numbers assuming that the decimal point is the period (.)
@@ -97,9 +104,8 @@ double atof_locale_c(const string& input)
   if (!std::regex_match(input, number_format))
     throw InvalidNumber("Expecting a numeric attribute value, but got: " + input);
 
-  CNumericLocale numeric_c;
   errno = 0;          // Reset the error code
-  double value = strtod_l(first, nullptr, numeric_c.Locale);
+  double value = strtod_l(first, nullptr, GetNumericLocale());
 
   // Error management
   std::stringstream s;
@@ -114,6 +120,47 @@ double atof_locale_c(const string& input)
   throw InvalidNumber(s.str());
 }
 
+/* Reads the numbers of a string and appends them to a vector. The numbers are
+ * read in place with the same locale as atof_locale_c(). As with the stream
+ * extraction that was used by FGTable, the numbers are read one after the
+ * other so they are separated by white spaces or by the sign or the decimal
+ * point that starts the next number: "1-2" is read as 1 and -2.
+ */
+void read_numbers_locale_c(const string& input, vector<double>& values)
+{
+  const char* p = input.c_str();
+
+  while (true) {
+    while (isspace((unsigned char)*p)) ++p;
+    if (!*p) return;
+
+    // strtod() also accepts hexadecimal numbers, infinities and NaNs so the
+    // characters of the token are checked beforehand.
+    const char* first = p;
+    const char* end = p;
+    while (*end && !isspace((unsigned char)*end)) ++end;
+    for (const char* c = first; c != end; ++c) {
+      if (!strchr("0123456789.+-eE", *c))
+        throw InvalidNumber("Expecting a numeric value, but got: "
+                            + string(first, end));
+    }
+
+    while (p != end) {
+      char* last;
+      errno = 0;
+      double value = strtod_l(p, &last, GetNumericLocale());
+
+      if (last == p)
+        throw InvalidNumber("Expecting a numeric value, but got: "
+                            + string(first, end));
+      if (fabs(value) == HUGE_VAL && errno == ERANGE)
+        throw InvalidNumber("This number is too large: " + string(p, last-p));
+
+      values.push_back(value);
+      p = last;
+    }
+  }
+}
 
 std::string& trim_left(std::string& str)
 {
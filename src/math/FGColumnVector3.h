@@ -228,6 +228,22 @@ public:
   /// Scale by a 1/scalar.
   FGColumnVector3& operator/=(const double scalar);
 
+  /** Add a cross product.
+      This is the same as *this += A*B without building the intermediate
+      vector. The result is the same as the expression above, bit for bit.
+      @param A left operand of the cross product.
+      @param B right operand of the cross product.
+      @return a reference to this vector.   */
+  FGColumnVector3& AddCross(const FGColumnVector3& A, const FGColumnVector3& B) {
+    const double x = A.data[1] * B.data[2] - A.data[2] * B.data[1];
+    const double y = A.data[2] * B.data[0] - A.data[0] * B.data[2];
+    const double z = A.data[0] * B.data[1] - A.data[1] * B.data[0];
+    data[0] += x;
+    data[1] += y;
+    data[2] += z;
+    return *this;
+  }
+
   void InitMatrix(void) { data[0] = data[1] = data[2] = 0.0; }
   void InitMatrix(const double a) { data[0] = data[1] = data[2] = a; }
   void InitMatrix(const double a, const double b, const double c) {
@@ -291,16 +291,37 @@ void FGFunction::CheckOddOrEvenArguments(Element* el, OddEven odd_even)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-shared_ptr<RandomNumberGenerator> makeRandomGenerator(Element *el, FGFDMExec* fdmex)
+shared_ptr<RandomNumberGenerator> makeRandomGenerator(Element *el, FGFDMExec* fdmex,
+                                                     const string& Prefix)
 {
+  // The stream is named after the location of the element rather than its
+  // full path so that the sequence does not depend on the installation
+  // directory. The name of the closest named parent (function, component,
+  // ...) and the prefix (engine number) tell apart the functions loaded from
+  // the same file several times or from files with the same name.
+  string file_name = el->GetFileName();
+  size_t pos = file_name.find_last_of("/\\");
+  if (pos != string::npos) file_name.erase(0, pos+1);
+  string stream = "function/";
+  for (Element* parent = el->GetParent(); parent; parent = parent->GetParent()) {
+    string name = parent->GetAttributeValue("name");
+    if (!name.empty()) {
+      stream += name + "/";
+      break;
+    }
+  }
+  stream += file_name + ":" + to_string(el->GetLineNumber());
+  if (!Prefix.empty()) stream += "#" + Prefix;
+
   string seed_attr = el->GetAttributeValue("seed");
   if (seed_attr.empty())
-    return fdmex->GetRandomGenerator();
+    return fdmex->GetRandomGenerator(stream);
   else if (seed_attr == "time_now")
     return make_shared<RandomNumberGenerator>();
   else {
     unsigned int seed = atoi(seed_attr.c_str());
-    return make_shared<RandomNumberGenerator>(seed);
+    return make_shared<RandomNumberGenerator>(seed,
+                                              RandomNumberGenerator::StreamId(stream));
   }
 }
 
@@ -627,7 +648,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
           throw e;
         }
       }
-      auto generator(makeRandomGenerator(element, fdmex));
+      auto generator(makeRandomGenerator(element, fdmex, Prefix));
       auto f = [generator, mean, stddev]()->double {
                  double value = generator->GetNormalRandomNumber();
                  return value*stddev + mean;
@@ -655,7 +676,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
           throw e;
         }
       }
-      auto generator(makeRandomGenerator(element, fdmex));
+      auto generator(makeRandomGenerator(element, fdmex, Prefix));
       double a = 0.5*(upper-lower);
       double b = 0.5*(upper+lower);
       auto f = [generator, a, b]()->double {
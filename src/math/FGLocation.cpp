@@ -54,13 +54,15 @@ CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 FGLocation::FGLocation(void)
-  : mECLoc(1.0, 0.0, 0.0), mCacheValid(false)
+  : mECLoc(1.0, 0.0, 0.0), mCacheValid(0)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
 
   mLon = mLat = mRadius = 0.0;
   mGeodLat = GeodeticAltitude = 0.0;
+  mSinGeodLat = 0.0;
+  mCosGeodLat = 1.0;
 
   mTl2ec.InitMatrix();
   mTec2l.InitMatrix();
@@ -69,13 +71,15 @@ FGLocation::FGLocation(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(double lon, double lat, double radius)
-  : mCacheValid(false)
+  : mCacheValid(0)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
 
   mLon = mLat = mRadius = 0.0;
   mGeodLat = GeodeticAltitude = 0.0;
+  mSinGeodLat = 0.0;
+  mCosGeodLat = 1.0;
 
   mTl2ec.InitMatrix();
   mTec2l.InitMatrix();
@@ -92,13 +96,15 @@ FGLocation::FGLocation(double lon, double lat, double radius)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 FGLocation::FGLocation(const FGColumnVector3& lv)
-  : mECLoc(lv), mCacheValid(false)
+  : mECLoc(lv), mCacheValid(0)
 {
   e2 = c = 0.0;
   a = ec = ec2 = 1.0;
 
   mLon = mLat = mRadius = 0.0;
   mGeodLat = GeodeticAltitude = 0.0;
+  mSinGeodLat = 0.0;
+  mCosGeodLat = 1.0;
 
   mTl2ec.InitMatrix();
   mTec2l.InitMatrix();
@@ -116,23 +122,7 @@ FGLocation::FGLocation(const FGLocation& l)
   ec2 = l.ec2;
   mEllipseSet = l.mEllipseSet;
 
-  /*ag
-   * if the cache is not valid, all of the following values are unset.
-   * They will be calculated once ComputeDerivedUnconditional is called.
-   * If unset, they may possibly contain NaN and could thus trigger floating
-   * point exceptions.
-   */
-  if (!mCacheValid) return;
-
-  mLon = l.mLon;
-  mLat = l.mLat;
-  mRadius = l.mRadius;
-
-  mTl2ec = l.mTl2ec;
-  mTec2l = l.mTec2l;
-
-  mGeodLat = l.mGeodLat;
-  GeodeticAltitude = l.GeodeticAltitude;
+  CopyCache(l);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -149,20 +139,38 @@ FGLocation& FGLocation::operator=(const FGLocation& l)
   ec = l.ec;
   ec2 = l.ec2;
 
-  //ag See comment in constructor above
-  if (!mCacheValid) return *this;
+  CopyCache(l);
 
-  mLon = l.mLon;
-  mLat = l.mLat;
-  mRadius = l.mRadius;
+  return *this;
+}
 
-  mTl2ec = l.mTl2ec;
-  mTec2l = l.mTec2l;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  mGeodLat = l.mGeodLat;
-  GeodeticAltitude = l.GeodeticAltitude;
+void FGLocation::CopyCache(const FGLocation& l)
+{
+  /*ag
+   * if a group of the cache is not valid, its values are unset.
+   * They will be calculated once the group is requested.
+   * If unset, they may possibly contain NaN and could thus trigger floating
+   * point exceptions.
+   */
+  if (mCacheValid & eSpherical) {
+    mLon = l.mLon;
+    mLat = l.mLat;
+    mRadius = l.mRadius;
+  }
 
-  return *this;
+  if (mCacheValid & eGeodetic) {
+    mGeodLat = l.mGeodLat;
+    GeodeticAltitude = l.GeodeticAltitude;
+    mSinGeodLat = l.mSinGeodLat;
+    mCosGeodLat = l.mCosGeodLat;
+  }
+
+  if (mCacheValid & eLocalFrame) {
+    mTl2ec = l.mTl2ec;
+    mTec2l = l.mTec2l;
+  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -179,7 +187,7 @@ void FGLocation::SetLongitude(double longitude)
   if (rtmp == 0.0)
     return;
 
-  mCacheValid = false;
+  mCacheValid = 0;
 
   mECLoc(eX) = rtmp*cos(longitude);
   mECLoc(eY) = rtmp*sin(longitude);
@@ -189,7 +197,7 @@ void FGLocation::SetLongitude(double longitude)
 
 void FGLocation::SetLatitude(double latitude)
 {
-  mCacheValid = false;
+  mCacheValid = 0;
 
   double r = mECLoc.Magnitude();
   if (r == 0.0) {
@@ -213,7 +221,7 @@ void FGLocation::SetLatitude(double latitude)
 
 void FGLocation::SetRadius(double radius)
 {
-  mCacheValid = false;
+  mCacheValid = 0;
 
   double rold = mECLoc.Magnitude();
   if (rold == 0.0)
@@ -226,7 +234,7 @@ void FGLocation::SetRadius(double radius)
 
 void FGLocation::SetPosition(double lon, double lat, double radius)
 {
-  mCacheValid = false;
+  mCacheValid = 0;
 
   double sinLat = sin(lat);
   double cosLat = cos(lat);
@@ -243,7 +251,7 @@ void FGLocation::SetPosition(double lon, double lat, double radius)
 void FGLocation::SetPositionGeodetic(double lon, double lat, double height)
 {
   assert(mEllipseSet);
-  mCacheValid = false;
+  mCacheValid = 0;
 
   double slat = sin(lat);
   double clat = cos(lat);
@@ -258,7 +266,7 @@ void FGLocation::SetPositionGeodetic(double lon, double lat, double height)
 
 void FGLocation::SetEllipse(double semimajor, double semiminor)
 {
-  mCacheValid = false;
+  mCacheValid = 0;
   mEllipseSet = true;
 
   a = semimajor;
@@ -273,14 +281,14 @@ void FGLocation::SetEllipse(double semimajor, double semiminor)
 double FGLocation::GetSeaLevelRadius(void) const
 {
   assert(mEllipseSet);
-  ComputeDerived();
+  ComputeSpherical();
   double cosLat = cos(mLat);
   return a*ec/sqrt(1.0-e2*cosLat*cosLat);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGLocation::ComputeDerivedUnconditional(void) const
+void FGLocation::ComputeSphericalUnconditional(void) const
 {
   // The radius is just the Euclidean norm of the vector.
   mRadius = mECLoc.Magnitude();
@@ -289,32 +297,35 @@ void FGLocation::ComputeDerivedUnconditional(void) const
   // through the poles.
   double rxy = mECLoc.Magnitude(eX, eY);
 
-  // Compute the longitude and its sin/cos values.
-  double sinLon, cosLon;
-  if (rxy == 0.0) {
-    sinLon = 0.0;
-    cosLon = 1.0;
-    mLon = 0.0;
-  } else {
-    sinLon = mECLoc(eY)/rxy;
-    cosLon = mECLoc(eX)/rxy;
-    mLon = atan2(mECLoc(eY), mECLoc(eX));
+  // Compute the longitude and the geocentric latitude.
+  mLon = rxy == 0.0 ? 0.0 : atan2(mECLoc(eY), mECLoc(eX));
+  mLat = mRadius == 0.0 ? 0.0 : atan2(mECLoc(eZ), rxy);
+
+  mCacheValid |= eSpherical;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLocation::ComputeGeodeticUnconditional(void) const
+{
+  // The geodetic coordinates are only defined once the ellipse has been set.
+  // Otherwise their sine and cosine are not used by the local frame.
+  if (!mEllipseSet) {
+    mCacheValid |= eGeodetic;
+    return;
   }
 
-  // Compute the geocentric & geodetic latitudes.
-  double sinLat, cosLat;
-  if (mRadius == 0.0)  {
-    mLat = 0.0;
-    sinLat = 0.0;
-    cosLat = 1.0;
-    if (mEllipseSet) {
-      mGeodLat = 0.0;
-      GeodeticAltitude = -a;
-    }
+  // The distance of the location to the Z-axis, which is the axis
+  // through the poles.
+  double rxy = mECLoc.Magnitude(eX, eY);
+
+  if (rxy == 0.0 && mECLoc(eZ) == 0.0) {
+    mGeodLat = 0.0;
+    GeodeticAltitude = -a;
+    mSinGeodLat = 0.0;
+    mCosGeodLat = 1.0;
   }
   else {
-    mLat = atan2( mECLoc(eZ), rxy );
-
     // Calculate the geodetic latitude based on "Transformation from Cartesian to
     // geodetic coordinates accelerated by Halley's method", Fukushima T. (2006)
     // Journal of Geodesy, Vol. 79, pp. 689-693
@@ -323,32 +334,67 @@ void FGLocation::ComputeDerivedUnconditional(void) const
     // iteration suffices. In addition, Fukushima's method has a much better
     // numerical stability over Sofair's method at the North and South poles and
     // it also gives the correct result for a spherical Earth.
-    if (mEllipseSet) {
-      double s0 = fabs(mECLoc(eZ));
-      double zc = ec * s0;
-      double c0 = ec * rxy;
-      double c02 = c0 * c0;
-      double s02 = s0 * s0;
-      double a02 = c02 + s02;
-      double a0 = sqrt(a02);
-      double a03 = a02 * a0;
-      double s1 = zc*a03 + c*s02*s0;
-      double c1 = rxy*a03 - c*c02*c0;
-      double cs0c0 = c*c0*s0;
-      double b0 = 1.5*cs0c0*((rxy*s0-zc*c0)*a0-cs0c0);
-      s1 = s1*a03-b0*s0;
-      double cc = ec*(c1*a03-b0*c0);
-      mGeodLat = sign(mECLoc(eZ))*atan(s1 / cc);
-      double s12 = s1 * s1;
-      double cc2 = cc * cc;
-      double norm = sqrt(s12 + cc2);
-      cosLat = cc / norm;
-      sinLat = sign(mECLoc(eZ)) * s1 / norm;
-      GeodeticAltitude = (rxy*cc + s0*s1 - a*sqrt(ec2*s12 + cc2)) / norm;
+    double s0 = fabs(mECLoc(eZ));
+    double zc = ec * s0;
+    double c0 = ec * rxy;
+    double c02 = c0 * c0;
+    double s02 = s0 * s0;
+    double a02 = c02 + s02;
+    double a0 = sqrt(a02);
+    double a03 = a02 * a0;
+    double s1 = zc*a03 + c*s02*s0;
+    double c1 = rxy*a03 - c*c02*c0;
+    double cs0c0 = c*c0*s0;
+    double b0 = 1.5*cs0c0*((rxy*s0-zc*c0)*a0-cs0c0);
+    s1 = s1*a03-b0*s0;
+    double cc = ec*(c1*a03-b0*c0);
+    mGeodLat = sign(mECLoc(eZ))*atan(s1 / cc);
+    double s12 = s1 * s1;
+    double cc2 = cc * cc;
+    double norm = sqrt(s12 + cc2);
+    mCosGeodLat = cc / norm;
+    mSinGeodLat = sign(mECLoc(eZ)) * s1 / norm;
+    GeodeticAltitude = (rxy*cc + s0*s1 - a*sqrt(ec2*s12 + cc2)) / norm;
+  }
+
+  mCacheValid |= eGeodetic;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLocation::ComputeLocalFrameUnconditional(void) const
+{
+  // The distance of the location to the Z-axis, which is the axis
+  // through the poles.
+  double rxy = mECLoc.Magnitude(eX, eY);
+
+  // Compute the sin/cos values of the longitude.
+  double sinLon, cosLon;
+  if (rxy == 0.0) {
+    sinLon = 0.0;
+    cosLon = 1.0;
+  } else {
+    sinLon = mECLoc(eY)/rxy;
+    cosLon = mECLoc(eX)/rxy;
+  }
+
+  // Compute the sin/cos values of the latitude: the local frame is tangent to
+  // the ellipsoid when it is set, to the sphere otherwise.
+  double sinLat, cosLat;
+  if (mEllipseSet) {
+    ComputeGeodetic();
+    sinLat = mSinGeodLat;
+    cosLat = mCosGeodLat;
+  }
+  else {
+    double radius = mECLoc.Magnitude();
+    if (radius == 0.0) {
+      sinLat = 0.0;
+      cosLat = 1.0;
     }
     else {
-      sinLat = mECLoc(eZ)/mRadius;
-      cosLat = rxy/mRadius;
+      sinLat = mECLoc(eZ)/radius;
+      cosLat = rxy/radius;
     }
   }
 
@@ -369,7 +415,7 @@ void FGLocation::ComputeDerivedUnconditional(void) const
   mTl2ec = mTec2l.Transposed();
 
   // Mark the cached values as valid
-  mCacheValid = true;
+  mCacheValid |= eLocalFrame;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -378,8 +424,33 @@ double FGLocation::GetDistanceTo(double target_longitude,
                                  double target_latitude) const
 {
   assert(mEllipseSet);
-  ComputeDerived();
   GeographicLib::Geodesic geod(a, 1 - ec);
+  return GetDistanceTo(geod, target_longitude, target_latitude);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGLocation::GetHeadingTo(double target_longitude,
+                                double target_latitude) const
+{
+  assert(mEllipseSet);
+  GeographicLib::Geodesic geod(a, 1 - ec);
+  double distance, heading;
+  GetDistanceAndHeadingTo(geod, target_longitude, target_latitude, distance,
+                          heading);
+
+  return heading;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGLocation::GetDistanceTo(const GeographicLib::Geodesic& geod,
+                                 double target_longitude,
+                                 double target_latitude) const
+{
+  assert(mEllipseSet);
+  ComputeSpherical();
+  ComputeGeodetic();
   GeographicLib::Math::real distance;
   geod.Inverse(mGeodLat * radtodeg, mLon * radtodeg, target_latitude * radtodeg,
                target_longitude * radtodeg, distance);
@@ -389,17 +460,21 @@ double FGLocation::GetDistanceTo(double target_longitude,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-double FGLocation::GetHeadingTo(double target_longitude,
-                                double target_latitude) const
+void FGLocation::GetDistanceAndHeadingTo(const GeographicLib::Geodesic& geod,
+                                         double target_longitude,
+                                         double target_latitude,
+                                         double& distance,
+                                         double& heading) const
 {
   assert(mEllipseSet);
-  ComputeDerived();
-  GeographicLib::Geodesic geod(a, 1 - ec);
-  GeographicLib::Math::real heading, azimuth2;
+  ComputeSpherical();
+  ComputeGeodetic();
+  GeographicLib::Math::real s12, azimuth1, azimuth2;
   geod.Inverse(mGeodLat * radtodeg, mLon * radtodeg, target_latitude * radtodeg,
-               target_longitude * radtodeg, heading, azimuth2);
+               target_longitude * radtodeg, s12, azimuth1, azimuth2);
 
-  return heading * degtorad;
+  distance = s12;
+  heading = azimuth1 * degtorad;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -57,6 +57,10 @@ INCLUDES
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+namespace GeographicLib {
+class Geodesic;
+}
+
 namespace JSBSim {
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -231,25 +235,25 @@ public:
       @return the longitude in rad of the location represented with this
       class instance. The returned values are in the range between
       -pi <= lon <= pi. Longitude is positive east and negative west. */
-  double GetLongitude() const { ComputeDerived(); return mLon; }
+  double GetLongitude() const { ComputeSpherical(); return mLon; }
 
   /** Get the longitude.
       @return the longitude in deg of the location represented with this
       class instance. The returned values are in the range between
       -180 <= lon <= 180.  Longitude is positive east and negative west. */
-  double GetLongitudeDeg() const { ComputeDerived(); return radtodeg*mLon; }
+  double GetLongitudeDeg() const { ComputeSpherical(); return radtodeg*mLon; }
 
   /** Get the sine of Longitude. */
-  double GetSinLongitude() const { ComputeDerived(); return -mTec2l(2,1); }
+  double GetSinLongitude() const { ComputeLocalFrame(); return -mTec2l(2,1); }
 
   /** Get the cosine of Longitude. */
-  double GetCosLongitude() const { ComputeDerived(); return mTec2l(2,2); }
+  double GetCosLongitude() const { ComputeLocalFrame(); return mTec2l(2,2); }
 
   /** Get the GEOCENTRIC latitude in radians.
       @return the geocentric latitude in rad of the location represented with
       this class instance. The returned values are in the range between
       -pi/2 <= lon <= pi/2. Latitude is positive north and negative south. */
-  double GetLatitude() const { ComputeDerived(); return mLat; }
+  double GetLatitude() const { ComputeSpherical(); return mLat; }
 
   /** Get the GEODETIC latitude in radians.
       @return the geodetic latitude in rad of the location represented with this
@@ -257,14 +261,14 @@ public:
       -pi/2 <= lon <= pi/2. Latitude is positive north and negative south. */
   double GetGeodLatitudeRad(void) const {
     assert(mEllipseSet);
-    ComputeDerived(); return mGeodLat;
+    ComputeGeodetic(); return mGeodLat;
   }
 
   /** Get the GEOCENTRIC latitude in degrees.
       @return the geocentric latitude in deg of the location represented with
       this class instance. The returned value is in the range between
       -90 <= lon <= 90. Latitude is positive north and negative south. */
-  double GetLatitudeDeg() const { ComputeDerived(); return radtodeg*mLat; }
+  double GetLatitudeDeg() const { ComputeSpherical(); return radtodeg*mLat; }
 
   /** Get the GEODETIC latitude in degrees.
       @return the geodetic latitude in degrees of the location represented by
@@ -272,13 +276,13 @@ public:
       -90 <= lon <= 90. Latitude is positive north and negative south. */
   double GetGeodLatitudeDeg(void) const {
     assert(mEllipseSet);
-    ComputeDerived(); return radtodeg*mGeodLat;
+    ComputeGeodetic(); return radtodeg*mGeodLat;
   }
 
   /** Gets the geodetic altitude in feet. */
   double GetGeodAltitude(void) const {
     assert(mEllipseSet);
-    ComputeDerived(); return GeodeticAltitude;
+    ComputeGeodetic(); return GeodeticAltitude;
   }
 
   /** Get the sea level radius in feet below the current location. */
@@ -288,17 +292,17 @@ public:
       @return the distance of the location represented with this class
       instance to the center of the earth in ft. The radius value is
       always positive. */
-  double GetRadius() const { ComputeDerived(); return mRadius; }
+  double GetRadius() const { ComputeSpherical(); return mRadius; }
 
   /** Transform matrix from local horizontal to earth centered frame.
       @return a const reference to the rotation matrix of the transform from
       the local horizontal frame to the earth centered frame. */
-  const FGMatrix33& GetTl2ec(void) const { ComputeDerived(); return mTl2ec; }
+  const FGMatrix33& GetTl2ec(void) const { ComputeLocalFrame(); return mTl2ec; }
 
   /** Transform matrix from the earth centered to local horizontal frame.
       @return a const reference to the rotation matrix of the transform from
       the earth centered frame to the local horizontal frame. */
-  const FGMatrix33& GetTec2l(void) const { ComputeDerived(); return mTec2l; }
+  const FGMatrix33& GetTec2l(void) const { ComputeLocalFrame(); return mTec2l; }
 
   /** Get the geodetic distance between the current location and a given
       location. This corresponds to the shortest distance between the two
@@ -317,6 +321,28 @@ public:
               targeted location along the shortest path */
   double GetHeadingTo(double target_longitude, double target_latitude) const;
 
+  /** Get the geodetic distance and the heading between the current location
+      and a given location. Both are obtained from the same solution of the
+      inverse geodesic problem.
+      @param geod geodesic solver of the planet. It must have been built for
+                  the ellipse of this location (see
+                  FGInertial::GetGeodesic()). Reusing it spares the
+                  computation of its coefficients at each call.
+      @param target_longitude the target longitude in radians
+      @param target_latitude the target geodetic latitude in radians
+      @param distance the geodetic distance in feet between the two locations
+      @param heading the heading in radians that should be followed to reach
+                     the targeted location along the shortest path */
+  void GetDistanceAndHeadingTo(const GeographicLib::Geodesic& geod,
+                               double target_longitude, double target_latitude,
+                               double& distance, double& heading) const;
+
+  /** Get the geodetic distance between the current location and a given
+      location using the geodesic solver of the planet.
+      @see GetDistanceAndHeadingTo() */
+  double GetDistanceTo(const GeographicLib::Geodesic& geod,
+                       double target_longitude, double target_latitude) const;
+
   /** Conversion from Local frame coordinates to a location in the
       earth centered and fixed frame.
       This function calculates the FGLocation of an object which position
@@ -324,7 +350,7 @@ public:
       @param lvec Vector in the local horizontal coordinate frame
       @return The location in the earth centered and fixed frame */
   FGLocation LocalToLocation(const FGColumnVector3& lvec) const {
-    ComputeDerived(); return mTl2ec*lvec + mECLoc;
+    ComputeLocalFrame(); return mTl2ec*lvec + mECLoc;
   }
 
   /** Conversion from a location in the earth centered and fixed frame
@@ -334,7 +360,7 @@ public:
       @param ecvec Vector in the earth centered and fixed frame
       @return The vector in the local horizontal coordinate frame */
   FGColumnVector3 LocationToLocal(const FGColumnVector3& ecvec) const {
-    ComputeDerived(); return mTec2l*(ecvec - mECLoc);
+    ComputeLocalFrame(); return mTec2l*(ecvec - mECLoc);
   }
 
   // For time-stepping, locations have vector properties...
@@ -351,7 +377,7 @@ public:
       @return a reference to the vector entry at the given index.
       Indices are counted starting with 1.
       Note that the index given in the argument is unchecked. */
-  double& operator()(unsigned int idx) { mCacheValid = false; return mECLoc.Entry(idx); }
+  double& operator()(unsigned int idx) { mCacheValid = 0; return mECLoc.Entry(idx); }
 
   /** Read access the entries of the vector.
       @param idx the component index.
@@ -372,7 +398,7 @@ public:
       used internally to access the elements in a more convenient way.
       Note that the index given in the argument is unchecked. */
   double& Entry(unsigned int idx) {
-    mCacheValid = false; return mECLoc.Entry(idx);
+    mCacheValid = 0; return mECLoc.Entry(idx);
   }
 
   /** Sets this location via the supplied vector.
@@ -386,8 +412,7 @@ public:
     mECLoc(eX) = v(eX);
     mECLoc(eY) = v(eY);
     mECLoc(eZ) = v(eZ);
-    mCacheValid = false;
-    //ComputeDerived();
+    mCacheValid = 0;
     return *this;
   }
 
@@ -411,7 +436,7 @@ public:
       the ECEF position vector on the left side of the equality, and a reference
       to this object is returned. */
   const FGLocation& operator+=(const FGLocation &l) {
-    mCacheValid = false;
+    mCacheValid = 0;
     mECLoc += l.mECLoc;
     return *this;
   }
@@ -421,7 +446,7 @@ public:
       substracted from the ECEF position vector on the left side of the
       equality, and a reference to this object is returned. */
   const FGLocation& operator-=(const FGLocation &l) {
-    mCacheValid = false;
+    mCacheValid = 0;
     mECLoc -= l.mECLoc;
     return *this;
   }
@@ -431,7 +456,7 @@ public:
       the equality are scaled by the supplied value (right side), and a
       reference to this object is returned. */
   const FGLocation& operator*=(double scalar) {
-    mCacheValid = false;
+    mCacheValid = 0;
     mECLoc *= scalar;
     return *this;
   }
@@ -478,19 +503,41 @@ public:
   }
 
 private:
+  /** Groups of derived values that are computed and invalidated together.
+      The geodetic coordinates and the local frame are only computed when they
+      are requested, so that a location which is only queried for its radius
+      or its longitude does not pay for the geodetic latitude and the
+      transformation matrices. */
+  enum eCacheGroup {
+    eSpherical  = 1, ///< Radius, longitude and geocentric latitude
+    eGeodetic   = 2, ///< Geodetic latitude and altitude
+    eLocalFrame = 4  ///< Transformation matrices to and from the local frame
+  };
+
   /** Computation of derived values.
-      This function re-computes the derived values like lat/lon and
-      transformation matrices. It does this unconditionally. */
-  void ComputeDerivedUnconditional(void) const;
+      These functions re-compute a group of derived values unconditionally. */
+  void ComputeSphericalUnconditional(void) const;
+  void ComputeGeodeticUnconditional(void) const;
+  void ComputeLocalFrameUnconditional(void) const;
 
   /** Computation of derived values.
-      This function checks if the derived values like lat/lon and
-      transformation matrices are already computed. If so, it
-      returns. If they need to be computed this is done here. */
-  void ComputeDerived(void) const {
-    if (!mCacheValid)
-      ComputeDerivedUnconditional();
+      These functions check if a group of derived values is already computed.
+      If so, they return. If it needs to be computed this is done here. */
+  void ComputeSpherical(void) const {
+    if (!(mCacheValid & eSpherical))
+      ComputeSphericalUnconditional();
+  }
+  void ComputeGeodetic(void) const {
+    if (!(mCacheValid & eGeodetic))
+      ComputeGeodeticUnconditional();
   }
+  void ComputeLocalFrame(void) const {
+    if (!(mCacheValid & eLocalFrame))
+      ComputeLocalFrameUnconditional();
+  }
+
+  /// Copies the derived values of the groups that are valid in l.
+  void CopyCache(const FGLocation& l);
 
   /** The coordinates in the earth centered frame. This is the master copy.
       The coordinate frame has its center in the middle of the earth.
@@ -509,6 +556,10 @@ private:
   mutable double mRadius;
   mutable double mGeodLat;
   mutable double GeodeticAltitude;
+  /** The sine and cosine of the geodetic latitude, computed along with it and
+      used by the local frame. */
+  mutable double mSinGeodLat;
+  mutable double mCosGeodLat;
 
   /** The cached rotation matrices from and to the associated frames. */
   mutable FGMatrix33 mTl2ec;
@@ -521,13 +572,15 @@ private:
   double ec;
   double ec2;
 
-  /** A data validity flag.
+  /** The data validity flags.
       This class implements caching of the derived values like the
       orthogonal rotation matrices or the lon/lat/radius values. For caching we
-      carry a flag which signals if the values are valid or not.
+      carry a flag per group of values (see eCacheGroup) which signals if the
+      values are valid or not. All the flags are cleared when the location is
+      modified.
       The C++ keyword "mutable" tells the compiler that the data member is
       allowed to change during a const member function. */
-  mutable bool mCacheValid;
+  mutable unsigned int mCacheValid;
   // Flag that checks that geodetic methods are called after SetEllipse() has
   // been called.
   bool mEllipseSet = false;
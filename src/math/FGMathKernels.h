@@ -0,0 +1,331 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGMathKernels.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGMATHKERNELS_H
+#define FGMATHKERNELS_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#if !defined(JSBSIM_NO_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSBSIM_SIMD_SSE2
+#    if defined(__AVX__)
+#      define JSBSIM_SIMD_AVX
+#    endif
+#  elif defined(__ARM_NEON) && defined(__aarch64__)
+#    define JSBSIM_SIMD_NEON
+#  endif
+#endif
+
+#if defined(JSBSIM_SIMD_AVX)
+#  include <immintrin.h>
+#elif defined(JSBSIM_SIMD_SSE2)
+#  include <emmintrin.h>
+#elif defined(JSBSIM_SIMD_NEON)
+#  include <arm_neon.h>
+#endif
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Kernels of the 3x3 matrix, vector and quaternion operations.
+
+    The kernels operate on the storage of FGMatrix33 (9 doubles, column major),
+    FGColumnVector3 (3 doubles) and FGQuaternion (4 doubles). The
+    implementation is selected at compile time:
+    - AVX when the compiler targets it (e.g. -mavx), for the matrix-vector and
+      matrix-matrix products,
+    - SSE2 on x86-64 (and on x86 when enabled),
+    - NEON on AArch64,
+    - the scalar reference otherwise, or when JSBSIM_NO_SIMD is defined (see
+      the CMake option ENABLE_SIMD).
+
+    The vectorized kernels perform the same operations in the same order as
+    the scalar ones and do not use fused multiply-add instructions, so they
+    return the same results bit for bit (unless the compiler is allowed to
+    contract the scalar operations into fused multiply-adds). The scalar
+    kernels are always available in MathKernels::Scalar for reference.
+
+    The output may alias any of the inputs.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace MathKernels {
+
+namespace Scalar {
+
+/// out = M*v
+inline void MatVec(const double* M, const double* v, double* out)
+{
+  double v1 = v[0], v2 = v[1], v3 = v[2];
+  double tmp1 = v1*M[0] + v2*M[3] + v3*M[6];
+  double tmp2 = v1*M[1] + v2*M[4] + v3*M[7];
+  double tmp3 = v1*M[2] + v2*M[5] + v3*M[8];
+  out[0] = tmp1; out[1] = tmp2; out[2] = tmp3;
+}
+
+/// out = M^T*v
+inline void TransposedMatVec(const double* M, const double* v, double* out)
+{
+  double v1 = v[0], v2 = v[1], v3 = v[2];
+  double tmp1 = v1*M[0] + v2*M[1] + v3*M[2];
+  double tmp2 = v1*M[3] + v2*M[4] + v3*M[5];
+  double tmp3 = v1*M[6] + v2*M[7] + v3*M[8];
+  out[0] = tmp1; out[1] = tmp2; out[2] = tmp3;
+}
+
+/// out = A*B
+inline void MatMul(const double* A, const double* B, double* out)
+{
+  double P[9];
+  for (int j=0; j<9; j+=3) {
+    P[j]   = A[0]*B[j] + A[3]*B[j+1] + A[6]*B[j+2];
+    P[j+1] = A[1]*B[j] + A[4]*B[j+1] + A[7]*B[j+2];
+    P[j+2] = A[2]*B[j] + A[5]*B[j+1] + A[8]*B[j+2];
+  }
+  for (int i=0; i<9; ++i) out[i] = P[i];
+}
+
+/** Transformation matrix of a unit quaternion, see Eqn. 1.3-32 in Stevens and
+    Lewis, "Aircraft Control and Simulation", Second Edition. */
+inline void QuatToMatrix(const double* q, double* T)
+{
+  double q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+  double q0q0 = q0*q0;
+  double q1q1 = q1*q1;
+  double q2q2 = q2*q2;
+  double q3q3 = q3*q3;
+  double q0q1 = q0*q1;
+  double q0q2 = q0*q2;
+  double q0q3 = q0*q3;
+  double q1q2 = q1*q2;
+  double q1q3 = q1*q3;
+  double q2q3 = q2*q3;
+
+  T[0] = q0q0 + q1q1 - q2q2 - q3q3;  // T(1,1)
+  T[3] = 2.0*(q1q2 + q0q3);          // T(1,2)
+  T[6] = 2.0*(q1q3 - q0q2);          // T(1,3)
+  T[1] = 2.0*(q1q2 - q0q3);          // T(2,1)
+  T[4] = q0q0 - q1q1 + q2q2 - q3q3;  // T(2,2)
+  T[7] = 2.0*(q2q3 + q0q1);          // T(2,3)
+  T[2] = 2.0*(q1q3 + q0q2);          // T(3,1)
+  T[5] = 2.0*(q2q3 - q0q1);          // T(3,2)
+  T[8] = q0q0 - q1q1 - q2q2 + q3q3;  // T(3,3)
+}
+
+} // namespace Scalar
+
+#if defined(JSBSIM_SIMD_SSE2) || defined(JSBSIM_SIMD_NEON)
+
+// Operations on pairs of doubles, shared by the SSE2 and NEON kernels.
+namespace Pair {
+#if defined(JSBSIM_SIMD_SSE2)
+typedef __m128d type;
+inline type load(const double* p) { return _mm_loadu_pd(p); }
+inline void store(double* p, type a) { _mm_storeu_pd(p, a); }
+inline type set(double lo, double hi) { return _mm_set_pd(hi, lo); }
+inline type splat(double a) { return _mm_set1_pd(a); }
+inline type add(type a, type b) { return _mm_add_pd(a, b); }
+inline type mul(type a, type b) { return _mm_mul_pd(a, b); }
+#else
+typedef float64x2_t type;
+inline type load(const double* p) { return vld1q_f64(p); }
+inline void store(double* p, type a) { vst1q_f64(p, a); }
+inline type set(double lo, double hi)
+{ return vcombine_f64(vdup_n_f64(lo), vdup_n_f64(hi)); }
+inline type splat(double a) { return vdupq_n_f64(a); }
+inline type add(type a, type b) { return vaddq_f64(a, b); }
+inline type mul(type a, type b) { return vmulq_f64(a, b); }
+#endif
+}
+
+// The rows 1 and 2 are computed in a pair and the row 3 by the scalar unit.
+
+#if !defined(JSBSIM_SIMD_AVX)
+inline void MatVec(const double* M, const double* v, double* out)
+{
+  using namespace Pair;
+  double v1 = v[0], v2 = v[1], v3 = v[2];
+  type r12 = add(add(mul(splat(v1), load(M)), mul(splat(v2), load(M+3))),
+                 mul(splat(v3), load(M+6)));
+  double r3 = v1*M[2] + v2*M[5] + v3*M[8];
+  store(out, r12);
+  out[2] = r3;
+}
+
+inline void MatMul(const double* A, const double* B, double* out)
+{
+  using namespace Pair;
+  type a1 = load(A), a2 = load(A+3), a3 = load(A+6);
+  double a13 = A[2], a23 = A[5], a33 = A[8];
+  for (int j=0; j<9; j+=3) {
+    double b1 = B[j], b2 = B[j+1], b3 = B[j+2];
+    type p12 = add(add(mul(a1, splat(b1)), mul(a2, splat(b2))),
+                   mul(a3, splat(b3)));
+    out[j+2] = a13*b1 + a23*b2 + a33*b3;
+    store(out+j, p12);
+  }
+}
+#endif
+
+inline void TransposedMatVec(const double* M, const double* v, double* out)
+{
+  using namespace Pair;
+  double v1 = v[0], v2 = v[1], v3 = v[2];
+  type r12 = add(add(mul(splat(v1), set(M[0], M[3])),
+                     mul(splat(v2), set(M[1], M[4]))),
+                 mul(splat(v3), set(M[2], M[5])));
+  double r3 = v1*M[6] + v2*M[7] + v3*M[8];
+  store(out, r12);
+  out[2] = r3;
+}
+
+// The pairs of entries of the matrix that only differ by the sign of a term
+// are computed together. Multiplying by -1 and adding are exact so the
+// results are those of the scalar kernel.
+inline void QuatToMatrix(const double* q, double* T)
+{
+  using namespace Pair;
+  type pm = set(1.0, -1.0);
+  type two = splat(2.0);
+  double q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+
+  // T(1,1), T(2,2)
+  type d = add(add(add(splat(q0*q0), mul(splat(q1*q1), pm)),
+                   mul(splat(q2*q2), set(-1.0, 1.0))),
+               splat(-(q3*q3)));
+  // T(1,2), T(2,1)
+  type t12 = mul(two, add(splat(q1*q2), mul(splat(q0*q3), pm)));
+  // T(2,3), T(3,2)
+  type t23 = mul(two, add(splat(q2*q3), mul(splat(q0*q1), pm)));
+  // T(3,1), T(1,3)
+  type t31 = mul(two, add(splat(q1*q3), mul(splat(q0*q2), pm)));
+
+  double r[8];
+  store(r, d);
+  store(r+2, t12);
+  store(r+4, t23);
+  store(r+6, t31);
+  T[0] = r[0]; T[4] = r[1];
+  T[3] = r[2]; T[1] = r[3];
+  T[7] = r[4]; T[5] = r[5];
+  T[2] = r[6]; T[6] = r[7];
+  T[8] = q0*q0 - q1*q1 - q2*q2 + q3*q3;
+}
+
+#endif // JSBSIM_SIMD_SSE2 || JSBSIM_SIMD_NEON
+
+#if defined(JSBSIM_SIMD_AVX)
+
+// The columns are processed in 4 lanes. The last column is loaded and the
+// results are stored in two halves so that nothing is read or written past
+// the 9 entries of the matrix or the 3 entries of the vector (the masked
+// loads and stores are much slower).
+inline __m256d LoadLastColumn(const double* p)
+{
+  return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(p)),
+                              _mm_load_sd(p+2), 1);
+}
+
+inline void StoreColumn(double* p, __m256d a)
+{
+  _mm_storeu_pd(p, _mm256_castpd256_pd128(a));
+  _mm_store_sd(p+2, _mm256_extractf128_pd(a, 1));
+}
+
+inline void MatVec(const double* M, const double* v, double* out)
+{
+  __m256d c1 = _mm256_loadu_pd(M);
+  __m256d c2 = _mm256_loadu_pd(M+3);
+  __m256d c3 = LoadLastColumn(M+6);
+  __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(v[0]), c1),
+                                          _mm256_mul_pd(_mm256_set1_pd(v[1]), c2)),
+                            _mm256_mul_pd(_mm256_set1_pd(v[2]), c3));
+  StoreColumn(out, r);
+}
+
+inline void MatMul(const double* A, const double* B, double* out)
+{
+  __m256d a1 = _mm256_loadu_pd(A);
+  __m256d a2 = _mm256_loadu_pd(A+3);
+  __m256d a3 = LoadLastColumn(A+6);
+  __m256d p[3];
+  for (int j=0; j<3; ++j)
+    p[j] = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a1, _mm256_set1_pd(B[3*j])),
+                                       _mm256_mul_pd(a2, _mm256_set1_pd(B[3*j+1]))),
+                         _mm256_mul_pd(a3, _mm256_set1_pd(B[3*j+2])));
+  // The 4th lane of the first two columns is overwritten by the next column.
+  _mm256_storeu_pd(out, p[0]);
+  _mm256_storeu_pd(out+3, p[1]);
+  StoreColumn(out+6, p[2]);
+}
+
+#endif // JSBSIM_SIMD_AVX
+
+#if !defined(JSBSIM_SIMD_SSE2) && !defined(JSBSIM_SIMD_NEON)
+using Scalar::MatVec;
+using Scalar::TransposedMatVec;
+using Scalar::MatMul;
+using Scalar::QuatToMatrix;
+#endif
+
+/// Name of the kernels selected at compile time.
+inline const char* Name(void)
+{
+#if defined(JSBSIM_SIMD_AVX)
+  return "AVX";
+#elif defined(JSBSIM_SIMD_SSE2)
+  return "SSE2";
+#elif defined(JSBSIM_SIMD_NEON)
+  return "NEON";
+#else
+  return "scalar";
+#endif
+}
+
+} // namespace MathKernels
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
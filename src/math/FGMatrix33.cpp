@@ -40,6 +40,7 @@ INCLUDES
 #include "FGMatrix33.h"
 #include "FGColumnVector3.h"
 #include "FGQuaternion.h"
+#include "FGMathKernels.h"
 #include <sstream>
 #include <iomanip>
 
@@ -381,15 +382,7 @@ FGMatrix33 FGMatrix33::operator*(const FGMatrix33& M) const
 {
   FGMatrix33 Product;
 
-  Product.data[0] = data[0]*M.data[0] + data[3]*M.data[1] + data[6]*M.data[2];
-  Product.data[3] = data[0]*M.data[3] + data[3]*M.data[4] + data[6]*M.data[5];
-  Product.data[6] = data[0]*M.data[6] + data[3]*M.data[7] + data[6]*M.data[8];
-  Product.data[1] = data[1]*M.data[0] + data[4]*M.data[1] + data[7]*M.data[2];
-  Product.data[4] = data[1]*M.data[3] + data[4]*M.data[4] + data[7]*M.data[5];
-  Product.data[7] = data[1]*M.data[6] + data[4]*M.data[7] + data[7]*M.data[8];
-  Product.data[2] = data[2]*M.data[0] + data[5]*M.data[1] + data[8]*M.data[2];
-  Product.data[5] = data[2]*M.data[3] + data[5]*M.data[4] + data[8]*M.data[5];
-  Product.data[8] = data[2]*M.data[6] + data[5]*M.data[7] + data[8]*M.data[8];
+  MathKernels::MatMul(data, M.data, Product.data);
 
   return Product;
 }
@@ -398,23 +391,7 @@ FGMatrix33 FGMatrix33::operator*(const FGMatrix33& M) const
 
 FGMatrix33& FGMatrix33::operator*=(const FGMatrix33& M)
 {
-  // FIXME: Make compiler friendlier
-  double a,b,c;
-
-  a = data[0]; b=data[3]; c=data[6];
-  data[0] = a*M.data[0] + b*M.data[1] + c*M.data[2];
-  data[3] = a*M.data[3] + b*M.data[4] + c*M.data[5];
-  data[6] = a*M.data[6] + b*M.data[7] + c*M.data[8];
-
-  a = data[1]; b=data[4]; c=data[7];
-  data[1] = a*M.data[0] + b*M.data[1] + c*M.data[2];
-  data[4] = a*M.data[3] + b*M.data[4] + c*M.data[5];
-  data[7] = a*M.data[6] + b*M.data[7] + c*M.data[8];
-
-  a = data[2]; b=data[5]; c=data[8];
-  data[2] = a*M.data[0] + b*M.data[1] + c*M.data[2];
-  data[5] = a*M.data[3] + b*M.data[4] + c*M.data[5];
-  data[8] = a*M.data[6] + b*M.data[7] + c*M.data[8];
+  MathKernels::MatMul(data, M.data, data);
 
   return *this;
 }
@@ -480,23 +457,64 @@ void FGMatrix33::T(void)
 
 FGColumnVector3 FGMatrix33::operator*(const FGColumnVector3& v) const
 {
-  double v1 = v(1);
-  double v2 = v(2);
-  double v3 = v(3);
+  const double vec[3] = { v(1), v(2), v(3) };
+  double result[3];
+
+  MathKernels::MatVec(data, vec, result);
+
+  return FGColumnVector3( result[0], result[1], result[2] );
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGColumnVector3 FGMatrix33::TransposedMultiply(const FGColumnVector3& v) const
+{
+  const double vec[3] = { v(1), v(2), v(3) };
+  double result[3];
 
-  double tmp1 = v1*data[0];  //[(col-1)*eRows+row-1]
-  double tmp2 = v1*data[1];
-  double tmp3 = v1*data[2];
+  MathKernels::TransposedMatVec(data, vec, result);
 
-  tmp1 += v2*data[3];
-  tmp2 += v2*data[4];
-  tmp3 += v2*data[5];
+  return FGColumnVector3( result[0], result[1], result[2] );
+}
 
-  tmp1 += v3*data[6];
-  tmp2 += v3*data[7];
-  tmp3 += v3*data[8];
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMatrix33::Multiply(const FGColumnVector3& v, FGColumnVector3& result) const
+{
+  const double vec[3] = { v(1), v(2), v(3) };
+  double prod[3];
 
-  return FGColumnVector3( tmp1, tmp2, tmp3 );
+  MathKernels::MatVec(data, vec, prod);
+
+  result.InitMatrix( prod[0], prod[1], prod[2] );
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMatrix33::TransposedMultiply(const FGColumnVector3& v,
+                                    FGColumnVector3& result) const
+{
+  const double vec[3] = { v(1), v(2), v(3) };
+  double prod[3];
+
+  MathKernels::TransposedMatVec(data, vec, prod);
+
+  result.InitMatrix( prod[0], prod[1], prod[2] );
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMatrix33::SetTransposed(const FGMatrix33& M)
+{
+  data[0] = M.data[0];
+  data[1] = M.data[3];
+  data[2] = M.data[6];
+  data[3] = M.data[1];
+  data[4] = M.data[4];
+  data[5] = M.data[7];
+  data[6] = M.data[2];
+  data[7] = M.data[5];
+  data[8] = M.data[8];
 }
 
 }
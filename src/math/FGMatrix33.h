@@ -330,6 +330,38 @@ public:
    */
   FGColumnVector3 operator*(const FGColumnVector3& v) const;
 
+  /** Product of the transposed matrix by a vector.
+      @param v vector to multiply with.
+      @return the product of the transposed matrix by the vector v. This is
+      the same as Transposed()*v without building the transposed matrix.
+  */
+  FGColumnVector3 TransposedMultiply(const FGColumnVector3& v) const;
+
+  /** Matrix vector multiplication in place.
+      Stores the product of the current matrix with the vector v in result.
+      This is the same as result = M*v without building an intermediate
+      vector. result and v may be the same vector.
+      @param v vector to multiply with.
+      @param result vector where the product is stored.
+  */
+  void Multiply(const FGColumnVector3& v, FGColumnVector3& result) const;
+
+  /** Product of the transposed matrix by a vector in place.
+      This is the same as result = Transposed()*v without building the
+      transposed matrix nor an intermediate vector. result and v may be the
+      same vector.
+      @param v vector to multiply with.
+      @param result vector where the product is stored.
+  */
+  void TransposedMultiply(const FGColumnVector3& v, FGColumnVector3& result) const;
+
+  /** Set this matrix to the transpose of another matrix.
+      This is the same as *this = M.Transposed() without building an
+      intermediate matrix. M must not be this matrix (use T() instead).
+      @param M matrix whose transpose is copied.
+  */
+  void SetTransposed(const FGMatrix33& M);
+
   /** Matrix subtraction.
 
       @param B matrix to add to.
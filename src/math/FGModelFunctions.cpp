@@ -165,19 +165,26 @@ string FGModelFunctions::GetFunctionStrings(const string& delimeter) const
 
 string FGModelFunctions::GetFunctionValues(const string& delimeter) const
 {
-  ostringstream buf;
+  vector<FGOutputValue> values;
 
+  GetFunctionValueSources(values);
+
+  return FormatValues(values, delimeter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGModelFunctions::GetFunctionValueSources(vector<FGOutputValue>& values) const
+{
   for (auto& prefunc: PreFunctions) {
-    if (buf.tellp() > 0) buf << delimeter;
-    buf << prefunc->GetValue();
+    FGFunction* f = prefunc.get();
+    values.push_back({[f]() { return f->GetValue(); }, 6});
   }
 
   for (auto& postfunc: PostFunctions) {
-    if (buf.tellp() > 0) buf << delimeter;
-    buf << postfunc->GetValue();
+    FGFunction* f = postfunc.get();
+    values.push_back({[f]() { return f->GetValue(); }, 6});
   }
-
-  return buf.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
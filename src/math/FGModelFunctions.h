@@ -38,6 +38,7 @@ INCLUDES
 
 #include "FGJSBBase.h"
 #include "input_output/FGPropertyReader.h"
+#include "input_output/FGOutputValue.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -91,6 +92,11 @@ public:
       functions */
   std::string GetFunctionValues(const std::string& delimeter) const;
 
+  /** Gets the sources of the function values.
+      @param values the list to which the sources are appended, in the same
+                    order as GetFunctionValues() */
+  void GetFunctionValueSources(std::vector<FGOutputValue>& values) const;
+
   /** Get one of the "pre" function
       @param name the name of the requested function.
       @return a pointer to the function (NULL if not found)
@@ -76,15 +76,17 @@ public:
   void SetNode(SGPropertyNode* node) {PropertyNode = node;}
   void SetValue(double value);
   bool IsLateBound(void) const { return PropertyNode == nullptr; }
+  /// Returns -1 if the property value is negated, 1 otherwise.
+  double GetSign(void) const { return Sign; }
+  /** Returns the property node, binding it if needed.
+      An exception is thrown if the property does not exist. */
+  SGPropertyNode* GetNode(void) const;
 
   std::string GetName(void) const override;
   virtual std::string GetNameWithSign(void) const;
   virtual std::string GetFullyQualifiedName(void) const;
   virtual std::string GetPrintableName(void) const;
 
-protected:
-  SGPropertyNode* GetNode(void) const;
-
 private:
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   mutable SGPropertyNode_ptr PropertyNode;
@@ -51,6 +51,7 @@ using std::endl;
 #include "FGColumnVector3.h"
 
 #include "FGQuaternion.h"
+#include "FGMathKernels.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
   DEFINITIONS
@@ -188,32 +189,13 @@ void FGQuaternion::ComputeDerivedUnconditional(void) const
 {
   mCacheValid = true;
 
-  double q0 = data[0]; // use some aliases/shorthand for the quat elements.
-  double q1 = data[1];
-  double q2 = data[2];
-  double q3 = data[3];
-
-  // Now compute the transformation matrix.
-  double q0q0 = q0*q0;
-  double q1q1 = q1*q1;
-  double q2q2 = q2*q2;
-  double q3q3 = q3*q3;
-  double q0q1 = q0*q1;
-  double q0q2 = q0*q2;
-  double q0q3 = q0*q3;
-  double q1q2 = q1*q2;
-  double q1q3 = q1*q3;
-  double q2q3 = q2*q3;
-  
-  mT(1,1) = q0q0 + q1q1 - q2q2 - q3q3; // This is found from Eqn. 1.3-32 in
-  mT(1,2) = 2.0*(q1q2 + q0q3);         // Stevens and Lewis
-  mT(1,3) = 2.0*(q1q3 - q0q2);
-  mT(2,1) = 2.0*(q1q2 - q0q3);
-  mT(2,2) = q0q0 - q1q1 + q2q2 - q3q3;
-  mT(2,3) = 2.0*(q2q3 + q0q1);
-  mT(3,1) = 2.0*(q1q3 + q0q2);
-  mT(3,2) = 2.0*(q2q3 - q0q1);
-  mT(3,3) = q0q0 - q1q1 - q2q2 + q3q3;
+  // Now compute the transformation matrix. This is found from Eqn. 1.3-32 in
+  // Stevens and Lewis
+  double T[9];
+  MathKernels::QuatToMatrix(data, T);
+  mT = FGMatrix33(T[0], T[3], T[6],
+                  T[1], T[4], T[7],
+                  T[2], T[5], T[8]);
 
   // Since this is an orthogonal matrix, the inverse is simply the transpose.
 
@@ -0,0 +1,191 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSharedArray.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Arrays of doubles sharing their storage when their content is
+               identical
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "FGSharedArray.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+namespace {
+  struct Pool {
+    mutex lock;
+    unordered_multimap<size_t, weak_ptr<vector<double>>> arrays;
+    size_t sweepSize = 64;
+  };
+
+  // Counted per thread so that the FDMs loaded concurrently can each report
+  // their own savings.
+  thread_local size_t SavedBytes = 0;
+  thread_local size_t TotalBytes = 0;
+
+  // The pool is never destroyed so that the arrays of static objects can be
+  // shared and released in any order.
+  Pool& GetPool(void)
+  {
+    static Pool* pool = new Pool;
+    return *pool;
+  }
+
+  // The content is hashed and compared bitwise since the tables contain NaNs.
+  size_t Hash(const vector<double>& v)
+  {
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a
+    for (double x: v) {
+      uint64_t bits;
+      memcpy(&bits, &x, sizeof(bits));
+      hash = (hash ^ bits) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash ^ v.size());
+  }
+
+  bool Equal(const vector<double>& a, const vector<double>& b)
+  {
+    return a.size() == b.size()
+      && (a.empty() || memcmp(a.data(), b.data(), a.size()*sizeof(double)) == 0);
+  }
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGSharedArray& FGSharedArray::operator=(vector<double>&& v)
+{
+  storage = make_shared<vector<double>>(std::move(v));
+  shared = false;
+  Update();
+  return *this;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const double& FGSharedArray::at(size_t i) const
+{
+  if (i >= count)
+    throw out_of_range("FGSharedArray: index out of range");
+  return elements[i];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedArray::push_back(double x)
+{
+  if (!storage)
+    storage = make_shared<vector<double>>();
+  else if (shared || storage.use_count() > 1) {
+    // Copy on write
+    storage = make_shared<vector<double>>(*storage);
+    shared = false;
+  }
+
+  storage->push_back(x);
+  Update();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGSharedArray::Share(void)
+{
+  if (shared || !storage || storage->empty()) return 0;
+
+  TotalBytes += storage->size()*sizeof(double);
+  size_t hash = Hash(*storage);
+  Pool& pool = GetPool();
+  lock_guard<mutex> guard(pool.lock);
+
+  auto range = pool.arrays.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    shared_ptr<vector<double>> candidate = it->second.lock();
+    if (candidate && Equal(*candidate, *storage)) {
+      size_t saved = storage->size()*sizeof(double);
+      storage = candidate;
+      shared = true;
+      Update();
+      SavedBytes += saved;
+      return saved;
+    }
+  }
+
+  // The entries of the arrays that have been destroyed since are removed when
+  // the pool has doubled in size. This keeps the cost amortized.
+  if (pool.arrays.size() >= 2*pool.sweepSize) {
+    for (auto it = pool.arrays.begin(); it != pool.arrays.end();) {
+      if (it->second.expired())
+        it = pool.arrays.erase(it);
+      else
+        ++it;
+    }
+    pool.sweepSize = max(pool.arrays.size(), size_t(64));
+  }
+
+  // The vector is shrunk since it will no longer grow.
+  if (storage.use_count() > 1 || storage->capacity() > storage->size())
+    storage = make_shared<vector<double>>(storage->begin(), storage->end());
+  pool.arrays.emplace(hash, storage);
+  shared = true;
+  Update();
+  return 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGSharedArray::GetSavedBytes(void)
+{
+  return SavedBytes;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGSharedArray::GetTotalBytes(void)
+{
+  return TotalBytes;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSharedArray::Update(void)
+{
+  elements = storage->data();
+  count = storage->size();
+}
+}
@@ -0,0 +1,125 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSharedArray.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSHAREDARRAY_H
+#define FGSHAREDARRAY_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Array of doubles whose storage is shared by the arrays with the same
+    content.
+
+    The same tables are loaded many times in a process: by each engine built
+    from the same engine file, by each propeller, by the child FDMs and by the
+    FDMs of the same aircraft. Once an array is complete, Share() looks up a
+    process wide pool of arrays by the hash of their content and, if an
+    identical array is found, releases its own storage to use the pooled one.
+
+    The shared storage is immutable: an array that is modified after being
+    shared gets a copy of its own first (copy on write). The pool only holds
+    weak references so the storage is released with the last array that uses
+    it. The pool is protected by a mutex so that the FDMs can be loaded from
+    several threads.
+
+    Reading an element costs the same as reading an element of std::vector.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGSharedArray
+{
+public:
+  FGSharedArray() = default;
+  FGSharedArray(const FGSharedArray& a) = default;
+  FGSharedArray& operator=(const FGSharedArray& a) = default;
+  /// Takes the ownership of the content of a vector. The array is not shared.
+  FGSharedArray& operator=(std::vector<double>&& v);
+
+  const double& operator[](size_t i) const { return elements[i]; }
+  /// Same as operator[] but throws std::out_of_range if i is not lower than
+  /// size().
+  const double& at(size_t i) const;
+  const double* data(void) const { return elements; }
+  size_t size(void) const { return count; }
+  bool empty(void) const { return count == 0; }
+
+  /// Appends an element. The storage is copied first if it is shared.
+  void push_back(double x);
+
+  /** Shares the storage with the arrays of the pool that have the same content
+      or adds the storage to the pool if there is none.
+      @return the number of bytes that are no longer allocated because an
+              identical array was found in the pool. */
+  size_t Share(void);
+  /// Returns true if the storage is in the pool.
+  bool IsShared(void) const { return shared; }
+  /// Returns true if both arrays use the same storage.
+  bool SharesStorageWith(const FGSharedArray& a) const
+  { return storage && storage == a.storage; }
+
+  /// Returns the total number of bytes saved by the calls to Share() from the
+  /// calling thread.
+  static size_t GetSavedBytes(void);
+  /// Returns the total number of bytes of the arrays passed to Share() from
+  /// the calling thread.
+  static size_t GetTotalBytes(void);
+
+private:
+  std::shared_ptr<std::vector<double>> storage;
+  // Cached from the storage so that reading an element costs one indirection.
+  const double* elements = nullptr;
+  size_t count = 0;
+  bool shared = false;
+
+  void Update(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
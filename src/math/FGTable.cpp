@@ -81,10 +81,16 @@ FGTable::FGTable(const FGTable& t)
   nRows = t.nRows;
   nCols = t.nCols;
   internal = t.internal;
+  ScaleFactor = t.ScaleFactor;
   Name = t.Name;
   lookupProperty[0] = t.lookupProperty[0];
   lookupProperty[1] = t.lookupProperty[1];
   lookupProperty[2] = t.lookupProperty[2];
+  Uniform[0] = t.Uniform[0];
+  Uniform[1] = t.Uniform[1];
+  Uniform[2] = t.Uniform[2];
+  Interpolation = t.Interpolation;
+  Coefficients = t.Coefficients;
 
   // Deep copy of t.Tables
   Tables.reserve(t.Tables.size());
@@ -130,6 +136,18 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     throw BaseException("Unknown table type.");
   }
 
+  string interpolation = el->GetAttributeValue("interpolation");
+  if (interpolation == "pchip")
+    Interpolation = ePchip;
+  else if (interpolation == "cubic")
+    Interpolation = eCubic;
+  else if (!interpolation.empty() && interpolation != "linear") {
+    std::cerr << el->ReadFrom()
+              << "  An unknown table interpolation is listed: "
+              << interpolation << endl;
+    throw BaseException("Unknown table interpolation.");
+  }
+
   // Determine and store the lookup properties for this table unless this table
   // is part of a 3D table, in which case its independentVar property indexes
   // will be set by a call from the owning table during creation
@@ -284,36 +302,39 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     }
   }
 
-  stringstream buf;
-
   for (unsigned int i=0; i<tableData->GetNumDataLines(); i++) {
-    string line = tableData->GetDataLine(i);
+    const string& line = tableData->GetDataLine(i);
     if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos) {
       cerr << " In file " << tableData->GetFileName() << endl
            << "   Illegal character found in line "
            << tableData->GetLineNumber() + i + 1 << ": " << endl << line << endl;
       throw BaseException("Illegal character");
     }
-    buf << line << " ";
   }
 
+  std::vector<double> data;
+
   switch (dimension) {
   case 1:
     nRows = tableData->GetNumDataLines();
     nCols = 1;
     Type = tt1D;
     // Fill unused elements with NaNs to detect illegal access.
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
-    *this << buf;
+    data.reserve(2*nRows+2);
+    data.push_back(std::numeric_limits<double>::quiet_NaN());
+    data.push_back(std::numeric_limits<double>::quiet_NaN());
+    tableData->GetDataAsNumbers(data);
+    Data = std::move(data);
     break;
   case 2:
     nRows = tableData->GetNumDataLines()-1;
     nCols = FindNumColumns(tableData->GetDataLine(0));
     Type = tt2D;
     // Fill unused elements with NaNs to detect illegal access.
-    Data.push_back(std::numeric_limits<double>::quiet_NaN());
-    *this << buf;
+    data.reserve(static_cast<size_t>(nRows+1)*(nCols+1));
+    data.push_back(std::numeric_limits<double>::quiet_NaN());
+    tableData->GetDataAsNumbers(data);
+    Data = std::move(data);
     break;
   case 3:
     nRows = el->GetNumElements("tableData");
@@ -328,6 +349,8 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       Data.push_back(tableData->GetAttributeValueAsNumber("breakPoint"));
       Tables.back()->lookupProperty[eRow] = lookupProperty[eRow];
       Tables.back()->lookupProperty[eColumn] = lookupProperty[eColumn];
+      Tables.back()->Interpolation = Interpolation;
+      Tables.back()->ComputeCoefficients();
       tableData = el->FindNextElement("tableData");
     }
 
@@ -412,6 +435,9 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
     break;
   }
 
+  DetectUniformAxes();
+  ComputeCoefficients();
+  Data.Share();
   bind(el, Prefix);
 
   if (debug_lvl & 1) Print();
@@ -442,6 +468,9 @@ FGTable::~FGTable()
     SGPropertyNode* node = PropertyManager->GetNode(tmp);
     if (node && node->isTied())
       PropertyManager->Untie(node);
+    node = PropertyManager->GetNode(tmp + "/scale-factor");
+    if (node && node->isTied())
+      PropertyManager->Untie(node);
   }
 
   Debug(1);
@@ -469,19 +498,19 @@ double FGTable::GetValue(void) const
   switch (Type) {
   case tt1D:
     assert(lookupProperty[eRow]);
-    return GetValue(lookupProperty[eRow]->getDoubleValue());
+    return ScaleFactor*GetValue(lookupProperty[eRow]->getDoubleValue());
   case tt2D:
     assert(lookupProperty[eRow]);
     assert(lookupProperty[eColumn]);
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue());
+    return ScaleFactor*GetValue(lookupProperty[eRow]->getDoubleValue(),
+                                lookupProperty[eColumn]->getDoubleValue());
   case tt3D:
     assert(lookupProperty[eRow]);
     assert(lookupProperty[eColumn]);
     assert(lookupProperty[eTable]);
-    return GetValue(lookupProperty[eRow]->getDoubleValue(),
-                    lookupProperty[eColumn]->getDoubleValue(),
-                    lookupProperty[eTable]->getDoubleValue());
+    return ScaleFactor*GetValue(lookupProperty[eRow]->getDoubleValue(),
+                                lookupProperty[eColumn]->getDoubleValue(),
+                                lookupProperty[eTable]->getDoubleValue());
   default:
     assert(false); // Should never be called
     return std::numeric_limits<double>::quiet_NaN();
@@ -501,17 +530,33 @@ double FGTable::GetValue(double key) const
   else if (key >= Data[2*nRows])
     return Data[2*nRows+1];
 
-  // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
   unsigned int r = 2;
-  while (Data[2*r] < key) r++;
+  if (Uniform[eRow].uniform)
+    r = UniformBracket(Data.data(), 2, nRows, key, Uniform[eRow]);
+  else {
+    // Search for the right breakpoint.
+    // This is a linear search, the algorithm is O(n).
+    while (Data[2*r] < key) r++;
+  }
 
+  return Interpolate(key, r);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::Interpolate(double key, unsigned int r) const
+{
   double x0 = Data[2*r-2];
   double Span = Data[2*r] - x0;
   assert(Span > 0.0);
   double Factor = (key - x0) / Span;
   assert(Factor >= 0.0 && Factor <= 1.0);
 
+  if (Interpolation != eLinear) {
+    const double* a = &Coefficients[4*(r-2)];
+    return a[0] + Factor*(a[1] + Factor*(a[2] + Factor*a[3]));
+  }
+
   double y0 = Data[2*r-1];
   return Factor*(Data[2*r+1] - y0) + y0;
 }
@@ -526,23 +571,54 @@ double FGTable::GetValue(double rowKey, double colKey) const
   assert(Data.size() == (nCols+1)*(nRows+1));
 
   unsigned int c = 2;
-  while(Data[c] < colKey && c < nCols) c++;
+  if (Uniform[eColumn].uniform)
+    c = UniformBracket(Data.data(), 1, nCols, colKey, Uniform[eColumn]);
+  else
+    while(Data[c] < colKey && c < nCols) c++;
+
+  size_t r = 2;
+  if (Uniform[eRow].uniform)
+    r = UniformBracket(Data.data(), nCols+1, nRows, rowKey, Uniform[eRow]);
+  else if (nRows > 1)
+    while(Data[r*(nCols+1)] < rowKey && r < nRows) r++;
+
+  return Interpolate(rowKey, colKey, r, c);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::Interpolate(double rowKey, double colKey, size_t r,
+                            unsigned int c) const
+{
   double x0 = Data[c-1];
   double Span = Data[c] - x0;
   assert(Span > 0.0);
   double cFactor = Constrain(0.0, (colKey - x0) / Span, 1.0);
 
   if (nRows == 1) {
+    if (Interpolation != eLinear) {
+      const double* a = &Coefficients[4*(c-2)];
+      return a[0] + cFactor*(a[1] + cFactor*(a[2] + cFactor*a[3]));
+    }
+
     double y0 = Data[(nCols+1)+c-1];
     return cFactor*(Data[(nCols+1)+c] - y0) + y0;
   }
 
-  size_t r = 2;
-  while(Data[r*(nCols+1)] < rowKey && r < nRows) r++;
   x0 = Data[(r-1)*(nCols+1)];
   Span = Data[r*(nCols+1)] - x0;
   assert(Span > 0.0);
   double rFactor = Constrain(0.0, (rowKey - x0) / Span, 1.0);
+
+  if (Interpolation != eLinear) {
+    // The coefficient a[4*i+j] multiplies rFactor^i*cFactor^j.
+    const double* a = &Coefficients[16*((r-2)*(nCols-1)+c-2)];
+    double value = 0.0;
+    for (int i=12; i>=0; i-=4)
+      value = value*rFactor
+            + a[i] + cFactor*(a[i+1] + cFactor*(a[i+2] + cFactor*a[i+3]));
+    return value;
+  }
   double col1temp = rFactor*Data[r*(nCols+1)+c-1]+(1.0-rFactor)*Data[(r-1)*(nCols+1)+c-1];
   double col2temp = rFactor*Data[r*(nCols+1)+c]+(1.0-rFactor)*Data[(r-1)*(nCols+1)+c];
 
@@ -562,10 +638,14 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
   else if (tableKey >= Data[nRows])
     return Tables[nRows-1]->GetValue(rowKey, colKey);
 
-  // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
   unsigned int r = 2;
-  while (Data[r] < tableKey) r++;
+  if (Uniform[eTable].uniform)
+    r = UniformBracket(Data.data(), 1, nRows, tableKey, Uniform[eTable]);
+  else {
+    // Search for the right breakpoint.
+    // This is a linear search, the algorithm is O(n).
+    while (Data[r] < tableKey) r++;
+  }
 
   double x0 = Data[r-1];
   double Span = Data[r] - x0;
@@ -577,6 +657,413 @@ double FGTable::GetValue(double rowKey, double colKey, double tableKey) const
   return Factor*(Tables[r-1]->GetValue(rowKey, colKey) - y0) + y0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the first index i in [first, last] such that keys[i*stride] is not
+// lower than key, or last if there is none. This is the index that is found by
+// the linear searches of GetValue(). The index hint is returned when it
+// satisfies that condition, otherwise the index is found by a binary search.
+
+unsigned int FGTable::FindBracket(const double* keys, size_t stride,
+                                  unsigned int first, unsigned int last,
+                                  double key, unsigned int hint)
+{
+  if (hint >= first && hint <= last
+      && (hint == first || keys[(hint-1)*stride] < key)
+      && (hint == last || !(keys[hint*stride] < key)))
+    return hint;
+
+  // The search is written without branches on the comparisons, which are
+  // mispredicted half of the time for scattered keys.
+  unsigned int n = last - first + 1;
+  while (n > 1) {
+    unsigned int half = n / 2;
+    first = keys[(first+half-1)*stride] < key ? first + half : first;
+    n -= half;
+  }
+
+  return first;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::Lookup(double key, unsigned int& r) const
+{
+  if (key <= Data[2])
+    return Data[3];
+  else if (key >= Data[2*nRows])
+    return Data[2*nRows+1];
+
+  if (Uniform[eRow].uniform)
+    r = UniformBracket(Data.data(), 2, nRows, key, Uniform[eRow]);
+  else
+    r = FindBracket(Data.data(), 2, 2, nRows, key, r);
+  return Interpolate(key, r);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::Lookup(double rowKey, double colKey, unsigned int& r,
+                       unsigned int& c) const
+{
+  if (nCols == 1) return Lookup(rowKey, r);
+
+  if (Uniform[eColumn].uniform)
+    c = UniformBracket(Data.data(), 1, nCols, colKey, Uniform[eColumn]);
+  else
+    c = FindBracket(Data.data(), 1, 2, nCols, colKey, c);
+
+  if (Uniform[eRow].uniform)
+    r = UniformBracket(Data.data(), nCols+1, nRows, rowKey, Uniform[eRow]);
+  else if (nRows > 1)
+    r = FindBracket(Data.data(), nCols+1, 2, nRows, rowKey, r);
+
+  return Interpolate(rowKey, colKey, r, c);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Checks if the breakpoints keys[i*stride], i in [1, last], are evenly spaced.
+// The tolerance only needs to keep the index computed by UniformBracket()
+// within one breakpoint of the bracket so that it accepts the breakpoints that
+// are rounded when they are written in decimal in the XML files.
+
+FGTable::UniformAxis FGTable::MakeUniformAxis(const double* keys,
+                                              size_t stride,
+                                              unsigned int last)
+{
+  constexpr double tolerance = 1E-3;
+  UniformAxis axis;
+
+  // The linear search is as fast as the arithmetic for very short axes.
+  if (last < 3) return axis;
+
+  double origin = keys[stride];
+  double step = (keys[last*stride] - origin) / (last - 1);
+
+  for (unsigned int i=2; i<last; ++i) {
+    if (fabs(keys[i*stride] - origin - (i-1)*step) > tolerance*step)
+      return axis;
+  }
+
+  axis.uniform = true;
+  axis.origin = origin;
+  axis.invStep = 1.0 / step;
+  return axis;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the same index as FindBracket() with first=2 for an axis with evenly
+// spaced breakpoints. The index is computed from the key then corrected by
+// comparing the key to the breakpoints so that the rounding errors do not
+// change the results of the interpolation.
+
+unsigned int FGTable::UniformBracket(const double* keys, size_t stride,
+                                     unsigned int last, double key,
+                                     const UniformAxis& axis)
+{
+  // The key is located between the breakpoints r-1 and r for u in (r-2, r-1].
+  double u = (key - axis.origin) * axis.invStep;
+  unsigned int r = 2;
+  if (u >= last - 1) // Also excludes the infinite and huge values.
+    r = last;
+  else if (u > 1.0)
+    r = static_cast<unsigned int>(u) + 2;
+
+  while (r > 2 && !(keys[(r-1)*stride] < key)) --r;
+  while (r < last && keys[r*stride] < key) ++r;
+
+  return r;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::DetectUniformAxes(void)
+{
+  switch (Type) {
+  case tt1D:
+    Uniform[eRow] = MakeUniformAxis(Data.data(), 2, nRows);
+    break;
+  case tt2D:
+    Uniform[eRow] = MakeUniformAxis(Data.data(), nCols+1, nRows);
+    Uniform[eColumn] = MakeUniformAxis(Data.data(), 1, nCols);
+    break;
+  case tt3D:
+    Uniform[eTable] = MakeUniformAxis(Data.data(), 1, nRows);
+    break;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the derivatives at the breakpoints x of the cubic interpolation of
+// the values y. The formulas are those of the PCHIP algorithm of Fritsch and
+// Carlson and of the "not-a-knot" cubic spline as in SciPy and MATLAB.
+
+std::vector<double> FGTable::ComputeSlopes(interpolation method,
+                                           const std::vector<double>& x,
+                                           const std::vector<double>& y)
+{
+  size_t n = x.size();
+  assert(n >= 2 && y.size() == n);
+  std::vector<double> h(n-1), delta(n-1), m(n);
+
+  for (size_t i=0; i<n-1; ++i) {
+    h[i] = x[i+1] - x[i];
+    delta[i] = (y[i+1] - y[i]) / h[i];
+  }
+
+  if (n == 2) {
+    m[0] = m[1] = delta[0];
+    return m;
+  }
+
+  if (method == ePchip) {
+    // The derivative is the weighted harmonic mean of the slopes of the
+    // neighbouring intervals, or zero at the local extrema.
+    for (size_t i=1; i<n-1; ++i) {
+      if (delta[i-1]*delta[i] <= 0.0)
+        m[i] = 0.0;
+      else {
+        double w1 = 2.0*h[i] + h[i-1];
+        double w2 = h[i] + 2.0*h[i-1];
+        m[i] = (w1 + w2) / (w1/delta[i-1] + w2/delta[i]);
+      }
+    }
+
+    // Three points formula at the ends, modified to preserve the shape.
+    auto endSlope = [](double h0, double h1, double d0, double d1) {
+      double d = ((2.0*h0 + h1)*d0 - h0*d1) / (h0 + h1);
+      if (d*d0 <= 0.0)
+        return 0.0;
+      else if (d0*d1 < 0.0 && fabs(d) > 3.0*fabs(d0))
+        return 3.0*d0;
+      return d;
+    };
+    m[0] = endSlope(h[0], h[1], delta[0], delta[1]);
+    m[n-1] = endSlope(h[n-2], h[n-3], delta[n-2], delta[n-3]);
+    return m;
+  }
+
+  assert(method == eCubic);
+
+  if (n == 3) {
+    // The spline is the parabola through the 3 points.
+    double d = h[0] + h[1];
+    m[0] = ((2.0*h[0] + h[1])*delta[0] - h[0]*delta[1]) / d;
+    m[1] = (h[1]*delta[0] + h[0]*delta[1]) / d;
+    m[2] = ((2.0*h[1] + h[0])*delta[1] - h[1]*delta[0]) / d;
+    return m;
+  }
+
+  // Continuity of the second derivative at the breakpoints. The tridiagonal
+  // system is solved by the Thomas algorithm.
+  std::vector<double> lower(n), diag(n), upper(n);
+  for (size_t i=1; i<n-1; ++i) {
+    lower[i] = h[i];
+    diag[i] = 2.0*(h[i-1] + h[i]);
+    upper[i] = h[i-1];
+    m[i] = 3.0*(h[i]*delta[i-1] + h[i-1]*delta[i]);
+  }
+
+  // The third derivative is continuous at the second and penultimate
+  // breakpoints ("not-a-knot" conditions).
+  double d = x[2] - x[0];
+  diag[0] = h[1];
+  upper[0] = d;
+  m[0] = ((h[0] + 2.0*d)*h[1]*delta[0] + h[0]*h[0]*delta[1]) / d;
+  d = x[n-1] - x[n-3];
+  lower[n-1] = d;
+  diag[n-1] = h[n-3];
+  m[n-1] = (h[n-2]*h[n-2]*delta[n-3] + (2.0*d + h[n-2])*h[n-3]*delta[n-2])
+         / d;
+
+  for (size_t i=1; i<n; ++i) {
+    double w = lower[i] / diag[i-1];
+    diag[i] -= w*upper[i-1];
+    m[i] -= w*m[i-1];
+  }
+  m[n-1] /= diag[n-1];
+  for (size_t i=n-1; i-- > 0;)
+    m[i] = (m[i] - upper[i]*m[i+1]) / diag[i];
+
+  return m;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Computes the polynomials of the cubic interpolation in the reduced
+// coordinates of each interval (0 at its first breakpoint and 1 at the next) so
+// that Interpolate() evaluates them from the factors of the linear
+// interpolation.
+
+void FGTable::ComputeCoefficients(void)
+{
+  Coefficients = std::vector<double>();
+  if (Interpolation == eLinear || Type == tt3D) return;
+
+  std::vector<double> coefficients;
+
+  // Coefficients of the cubic polynomial of an interval from its values and
+  // derivatives (scaled by the length of the interval) at its ends.
+  auto hermite = [](double y0, double y1, double m0, double m1, double* a) {
+    a[0] = y0;
+    a[1] = m0;
+    a[2] = 3.0*(y1 - y0) - 2.0*m0 - m1;
+    a[3] = 2.0*(y0 - y1) + m0 + m1;
+  };
+
+  // Tables with a single row or column are interpolated along their only axis.
+  if (nCols == 1 || nRows == 1) {
+    size_t stride = nCols == 1 ? 2 : 1;
+    size_t offset = nCols == 1 ? 1 : nCols+1;
+    unsigned int n = nCols == 1 ? nRows : nCols;
+    if (n < 2) return;
+
+    std::vector<double> x(n), y(n);
+    for (unsigned int i=0; i<n; ++i) {
+      x[i] = Data[(i+1)*stride];
+      y[i] = Data[(i+1)*stride+offset];
+    }
+    std::vector<double> m = ComputeSlopes(Interpolation, x, y);
+
+    coefficients.resize(4*(n-1));
+    for (unsigned int i=0; i<n-1; ++i) {
+      double h = x[i+1] - x[i];
+      hermite(y[i], y[i+1], h*m[i], h*m[i+1], &coefficients[4*i]);
+    }
+    Coefficients = std::move(coefficients);
+    Coefficients.Share();
+    return;
+  }
+
+  // The bicubic patches are defined by the values, the derivatives along the
+  // rows and the columns and the cross derivatives at the corners of the
+  // cells.
+  std::vector<double> x(nRows), y(nCols);
+  std::vector<std::vector<double>> z(nRows, std::vector<double>(nCols));
+  for (unsigned int i=0; i<nRows; ++i)
+    x[i] = Data[(i+1)*(nCols+1)];
+  for (unsigned int j=0; j<nCols; ++j)
+    y[j] = Data[j+1];
+  for (unsigned int i=0; i<nRows; ++i)
+    for (unsigned int j=0; j<nCols; ++j)
+      z[i][j] = Data[(i+1)*(nCols+1)+j+1];
+
+  std::vector<std::vector<double>> zx(nRows, std::vector<double>(nCols));
+  for (unsigned int j=0; j<nCols; ++j) {
+    std::vector<double> column(nRows);
+    for (unsigned int i=0; i<nRows; ++i)
+      column[i] = z[i][j];
+    std::vector<double> m = ComputeSlopes(Interpolation, x, column);
+    for (unsigned int i=0; i<nRows; ++i)
+      zx[i][j] = m[i];
+  }
+
+  std::vector<std::vector<double>> zy(nRows), zxy(nRows);
+  for (unsigned int i=0; i<nRows; ++i) {
+    zy[i] = ComputeSlopes(Interpolation, y, z[i]);
+    zxy[i] = ComputeSlopes(Interpolation, y, zx[i]);
+  }
+
+  coefficients.resize(16*static_cast<size_t>(nRows-1)*(nCols-1));
+  for (unsigned int i=0; i<nRows-1; ++i) {
+    double hx = x[i+1] - x[i];
+    for (unsigned int j=0; j<nCols-1; ++j) {
+      double hy = y[j+1] - y[j];
+      double* a = &coefficients[16*(static_cast<size_t>(i)*(nCols-1)+j)];
+      // Polynomials along the columns of the values (f) and of the
+      // derivatives along the rows (g) at both rows of the cell.
+      double f0[4], f1[4], g0[4], g1[4];
+      hermite(z[i][j], z[i][j+1], hy*zy[i][j], hy*zy[i][j+1], f0);
+      hermite(z[i+1][j], z[i+1][j+1], hy*zy[i+1][j], hy*zy[i+1][j+1], f1);
+      hermite(hx*zx[i][j], hx*zx[i][j+1], hx*hy*zxy[i][j], hx*hy*zxy[i][j+1],
+              g0);
+      hermite(hx*zx[i+1][j], hx*zx[i+1][j+1], hx*hy*zxy[i+1][j],
+              hx*hy*zxy[i+1][j+1], g1);
+      // Hermite interpolation along the rows of each coefficient.
+      for (unsigned int k=0; k<4; ++k) {
+        double c[4];
+        hermite(f0[k], f1[k], g0[k], g1[k], c);
+        for (unsigned int l=0; l<4; ++l)
+          a[4*l+k] = c[l];
+      }
+    }
+  }
+
+  Coefficients = std::move(coefficients);
+  Coefficients.Share();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTable::GetDataSize(void) const
+{
+  size_t size = (Data.size() + Coefficients.size())*sizeof(double);
+  for (const auto& table: Tables)
+    size += table->GetDataSize();
+  return size;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(const double* keys, double* results, size_t n) const
+{
+  assert(nCols == 1);
+  assert(Data.size() == 2*nRows+2);
+
+  unsigned int r = 2;
+  for (size_t i=0; i<n; ++i)
+    results[i] = Lookup(keys[i], r);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(const double* rowKeys, const double* colKeys,
+                        double* results, size_t n) const
+{
+  assert(Type != tt3D);
+  assert(Data.size() == (nCols+1)*(nRows+1));
+
+  unsigned int r = 2, c = 2;
+  for (size_t i=0; i<n; ++i)
+    results[i] = Lookup(rowKeys[i], colKeys[i], r, c);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(const double* rowKeys, const double* colKeys,
+                        const double* tableKeys, double* results,
+                        size_t n) const
+{
+  assert(Type == tt3D);
+  assert(Data.size() == nRows+1);
+
+  // The bracket hints of the rows and columns are shared by the sub-tables
+  // since they often have the same breakpoints.
+  unsigned int t = 2, r = 2, c = 2;
+  for (size_t i=0; i<n; ++i) {
+    double tableKey = tableKeys[i];
+
+    if (tableKey <= Data[1])
+      results[i] = Tables[0]->Lookup(rowKeys[i], colKeys[i], r, c);
+    else if (tableKey >= Data[nRows])
+      results[i] = Tables[nRows-1]->Lookup(rowKeys[i], colKeys[i], r, c);
+    else {
+      if (Uniform[eTable].uniform)
+        t = UniformBracket(Data.data(), 1, nRows, tableKey, Uniform[eTable]);
+      else
+        t = FindBracket(Data.data(), 1, 2, nRows, tableKey, t);
+
+      double x0 = Data[t-1];
+      double Span = Data[t] - x0;
+      assert(Span > 0.0);
+      double Factor = (tableKey - x0) / Span;
+      assert(Factor >= 0.0 && Factor <= 1.0);
+
+      double y0 = Tables[t-2]->Lookup(rowKeys[i], colKeys[i], r, c);
+      results[i] = Factor*(Tables[t-1]->Lookup(rowKeys[i], colKeys[i], r, c)
+                           - y0) + y0;
+    }
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTable::GetMinValue(void) const
@@ -604,6 +1091,11 @@ void FGTable::operator<<(istream& in_stream)
     Data.push_back(x);
     in_stream >> x;
   }
+
+  if (Data.size() == static_cast<size_t>(nRows+1)*(nCols+1)) {
+    DetectUniformAxes();
+    Data.Share();
+  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -627,6 +1119,12 @@ FGTable& FGTable::operator<<(const double x)
       throw BaseException("FGTable: row lookup is not monotonically increasing");
   }
 
+  // The breakpoints are known once the table is fully populated.
+  if (n == static_cast<size_t>(nRows+1)*(nCols+1)) {
+    DetectUniformAxes();
+    Data.Share();
+  }
+
   return *this;
 }
 
@@ -711,6 +1209,7 @@ void FGTable::bind(Element* el, const string& Prefix)
     }
 
     PropertyManager->Tie<FGTable, double>(tmp, this, &FGTable::GetValue);
+    PropertyManager->Tie(tmp + "/scale-factor", &ScaleFactor);
   }
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
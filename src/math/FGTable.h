@@ -39,6 +39,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGParameter.h"
+#include "FGSharedArray.h"
 #include "math/FGPropertyValue.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -223,6 +224,62 @@ referring to combustion efficiency). Later on, the table is used like this:
 combustion_efficiency = Lookup_Combustion_Efficiency->GetValue(equivalence_ratio);
 @endcode
 
+When a table is evaluated at many keys (blade elements, sweeps, post
+processing), the GetValues() methods evaluate it over arrays of keys. The
+breakpoints bracketing a key are tried first for the next key so that sorted
+or slowly varying keys are looked up in constant time; otherwise they are found
+by a binary search. The results are identical to those of GetValue().
+
+Most tables have evenly spaced breakpoints (every 2 degrees of alpha, every
+0.05 Mach, etc.). This is detected when the table is loaded and the bracketing
+breakpoints of these axes are then computed arithmetically rather than
+searched, so the cost of a lookup does not grow with the number of breakpoints.
+Axes with uneven breakpoints are searched as before.
+
+By default, the values between the breakpoints are interpolated linearly. The
+optional attribute <tt>interpolation</tt> of the <tt>table</tt> element selects
+a piecewise cubic interpolation instead:
+
+- <tt>interpolation="pchip"</tt> is the piecewise cubic Hermite interpolation
+  of Fritsch and Carlson. It is smooth (its first derivative is continuous)
+  and preserves the shape of the data: it does not overshoot and is monotonic
+  wherever the data is monotonic.
+- <tt>interpolation="cubic"</tt> is the cubic spline with "not-a-knot" end
+  conditions. Its second derivative is continuous but it may overshoot the
+  data.
+
+A smooth interpolation gives continuous derivatives to the linearization and
+trim algorithms and needs far fewer breakpoints than a linear table of the same
+accuracy. The polynomials of each interval are computed when the table is
+loaded, so a lookup costs the search of the interval and the evaluation of a
+cubic polynomial. The 2D tables use the bicubic patches built from the
+derivatives of the interpolation along each axis, and the 3D tables are
+interpolated linearly between their breakpoints.
+
+@code
+<table interpolation="pchip">
+  <independentVar lookup="row">aero/alpha-deg</independentVar>
+  <tableData>
+    -10.0  -0.80
+      0.0   0.25
+     10.0   1.20
+     15.0   1.45
+     20.0   1.20
+  </tableData>
+</table>
+@endcode
+
+@code
+std::vector<double> keys = {0.95, 1.02, 1.07, 1.12};
+std::vector<double> efficiencies(keys.size());
+Lookup_Combustion_Efficiency->GetValues(keys.data(), efficiencies.data(),
+                                        keys.size());
+@endcode
+
+The value of a named table is multiplied by the property
+<tt>property_name/scale-factor</tt> which defaults to 1.0. It allows to
+disperse a table without editing its data (see FGMonteCarlo).
+
 @author Jon S. Berndt
 */
 
@@ -269,6 +326,27 @@ public:
   /// @return The interpolated value
   double GetValue(double rowKey, double colKey, double TableKey) const;
 
+  /// @brief Get the values of a 1D table at an array of keys
+  /// @param keys Array of the n row coordinates
+  /// @param results Array receiving the n interpolated values
+  /// @param n Number of keys
+  void GetValues(const double* keys, double* results, size_t n) const;
+  /// @brief Get the values of a 2D table at arrays of keys
+  /// @param rowKeys Array of the n row coordinates
+  /// @param colKeys Array of the n column coordinates
+  /// @param results Array receiving the n interpolated values
+  /// @param n Number of keys
+  void GetValues(const double* rowKeys, const double* colKeys,
+                 double* results, size_t n) const;
+  /// @brief Get the values of a 3D table at arrays of keys
+  /// @param rowKeys Array of the n row coordinates
+  /// @param colKeys Array of the n column coordinates
+  /// @param tableKeys Array of the n table coordinates
+  /// @param results Array receiving the n interpolated values
+  /// @param n Number of keys
+  void GetValues(const double* rowKeys, const double* colKeys,
+                 const double* tableKeys, double* results, size_t n) const;
+
   double GetMinValue(void) const;
   double GetMinValue(double colKey) const;
   double GetMinValue(double colKey, double TableKey) const;
@@ -308,6 +386,18 @@ public:
   { lookupProperty[eColumn] = new FGPropertyValue(node); }
 
   unsigned int GetNumRows() const {return nRows;}
+  /// Returns the number of lookup axes of the table (1, 2 or 3).
+  unsigned int GetDimension() const {return Type+1;}
+  /** Checks if the breakpoints of an axis are evenly spaced.
+      @param axis 0 for the rows, 1 for the columns and 2 for the tables.
+      @return true if the breakpoints are found without a search. */
+  bool IsUniform(unsigned int axis) const {return Uniform[axis].uniform;}
+  /// Returns the size in bytes of the breakpoints, data and interpolation
+  /// coefficients of the table.
+  size_t GetDataSize(void) const;
+  /// Returns true if the data of both tables is stored once in memory.
+  bool SharesDataWith(const FGTable& t) const
+  { return Data.SharesStorageWith(t.Data); }
 
   void Print(void);
 
@@ -316,14 +406,45 @@ public:
 private:
   enum type {tt1D, tt2D, tt3D} Type;
   enum axis {eRow=0, eColumn, eTable};
+  enum interpolation {eLinear, ePchip, eCubic} Interpolation = eLinear;
   bool internal = false;
   std::shared_ptr<FGPropertyManager> PropertyManager; // Property root used to do late binding.
   FGPropertyValue_ptr lookupProperty[3];
-  std::vector<double> Data;
+  FGSharedArray Data;
   std::vector<std::unique_ptr<FGTable>> Tables;
+  // Coefficients of the cubic polynomials of each interval (1D) or cell (2D)
+  FGSharedArray Coefficients;
   unsigned int nRows, nCols;
+  double ScaleFactor = 1.0;
   std::string Name;
+
+  struct UniformAxis {
+    bool uniform = false;
+    double origin = 0.0;  // First breakpoint of the axis
+    double invStep = 0.0; // Inverse of the spacing of the breakpoints
+  };
+  UniformAxis Uniform[3];
+
   void bind(Element* el, const std::string& Prefix);
+  static unsigned int FindBracket(const double* keys, size_t stride,
+                                  unsigned int first, unsigned int last,
+                                  double key, unsigned int hint);
+  static UniformAxis MakeUniformAxis(const double* keys, size_t stride,
+                                     unsigned int last);
+  static unsigned int UniformBracket(const double* keys, size_t stride,
+                                     unsigned int last, double key,
+                                     const UniformAxis& axis);
+  void DetectUniformAxes(void);
+  static std::vector<double> ComputeSlopes(interpolation method,
+                                           const std::vector<double>& x,
+                                           const std::vector<double>& y);
+  void ComputeCoefficients(void);
+  double Interpolate(double key, unsigned int r) const;
+  double Interpolate(double rowKey, double colKey, size_t r,
+                     unsigned int c) const;
+  double Lookup(double key, unsigned int& r) const;
+  double Lookup(double rowKey, double colKey, unsigned int& r,
+                unsigned int& c) const;
   void missingData(Element *el, unsigned int expected_size, size_t actual_size);
   void Debug(int from);
 };
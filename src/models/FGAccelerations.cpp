@@ -71,6 +71,8 @@ FGAccelerations::FGAccelerations(FGFDMExec* fdmex)
   Debug(0);
   Name = "FGAccelerations";
   gravTorque = false;
+  FrictionIterations = 0;
+  FrictionResidual = 0.0;
 
   vPQRidot.InitMatrix();
   vUVWidot.InitMatrix();
@@ -238,11 +240,20 @@ void FGAccelerations::CalculateFrictionForces(double dt)
   vFrictionForces.InitMatrix();
   vFrictionMoments.InitMatrix();
 
+  FrictionIterations = 0;
+  FrictionResidual = 0.0;
+
   // If no gears are in contact with the ground then return
   if (!n) return;
 
-  vector<double> a(n*n); // Will contain Jac*M^-1*Jac^T
-  vector<double> rhs(n);
+  // The storage of the linear system is kept from one frame to the next so
+  // that it is only reallocated when the number of contacts increases.
+  FrictionMatrix.resize(n*n);
+  FrictionRHS.resize(n);
+  FrictionLambda.resize(n);
+  double* a = FrictionMatrix.data(); // Will contain Jac*M^-1*Jac^T
+  double* rhs = FrictionRHS.data();
+  double* lambda = FrictionLambda.data();
 
   // Assemble the linear system of equations
   for (unsigned int i=0; i < n; i++) {
@@ -288,19 +299,31 @@ void FGAccelerations::CalculateFrictionForces(double dt)
       a[i*n+j] /= d;
   }
 
-  // Resolve the Lagrange multipliers with the projected Gauss-Seidel method
-  for (int iter=0; iter < 50; iter++) {
-    double norm = 0.;
+  // Resolve the Lagrange multipliers with the projected Gauss-Seidel method.
+  // The iterations are warm started from the multipliers of the previous
+  // frame which FGLGear has kept (and constrained to the new bounds) for the
+  // gears that are still in contact with the ground. The multipliers are
+  // copied in a contiguous array for the duration of the iterations.
+  for (unsigned int i=0; i < n; i++)
+    lambda[i] = multipliers[i]->value;
+
+  const int MaxIterations = 50;
+  double norm = 0.;
+
+  while (FrictionIterations < MaxIterations) {
+    norm = 0.;
+    FrictionIterations++;
 
     for (unsigned int i=0; i < n; i++) {
-      double lambda0 = multipliers[i]->value;
+      const double* ai = a + i*n;
+      double lambda0 = lambda[i];
       double dlambda = rhs[i];
 
       for (unsigned int j=0; j < n; j++)
-        dlambda -= a[i*n+j]*multipliers[j]->value;
+        dlambda -= ai[j]*lambda[j];
 
-      multipliers[i]->value = Constrain(multipliers[i]->Min, lambda0+dlambda, multipliers[i]->Max);
-      dlambda = multipliers[i]->value - lambda0;
+      lambda[i] = Constrain(multipliers[i]->Min, lambda0+dlambda, multipliers[i]->Max);
+      dlambda = lambda[i] - lambda0;
 
       norm += fabs(dlambda);
     }
@@ -308,14 +331,16 @@ void FGAccelerations::CalculateFrictionForces(double dt)
     if (norm < 1E-5) break;
   }
 
+  FrictionResidual = norm;
+
   // Calculate the total friction forces and moments
 
   for (unsigned int i=0; i< n; i++) {
-    double lambda = multipliers[i]->value;
+    multipliers[i]->value = lambda[i];
     FGColumnVector3 U = multipliers[i]->ForceJacobian;
     FGColumnVector3 r = multipliers[i]->LeverArm;
 
-    FGColumnVector3 F = lambda * U;
+    FGColumnVector3 F = lambda[i] * U;
     vFrictionForces += F;
     vFrictionMoments += r * F;
   }
@@ -379,6 +404,9 @@ void FGAccelerations::bind(void)
   PropertyManager->Tie("forces/fbx-gear-lbs", this, eX, &FGAccelerations::GetGroundForces);
   PropertyManager->Tie("forces/fby-gear-lbs", this, eY, &FGAccelerations::GetGroundForces);
   PropertyManager->Tie("forces/fbz-gear-lbs", this, eZ, &FGAccelerations::GetGroundForces);
+
+  PropertyManager->Tie("accelerations/friction-iterations", this, &FGAccelerations::GetFrictionIterations);
+  PropertyManager->Tie("accelerations/friction-residual", this, &FGAccelerations::GetFrictionResidual);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -38,6 +38,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <vector>
+
 #include "models/FGModel.h"
 #include "math/FGColumnVector3.h"
 #include "math/LagrangeMultiplier.h"
@@ -75,6 +77,16 @@ CLASS DOCUMENTATION
               mainly relevant for spacecrafts that are orbiting at low altitudes.
               Gravitational torque calculations are disabled by default.
 
+    The friction forces are computed with an iterative solver whose
+    convergence can be monitored with the following properties :
+    @property accelerations/friction-iterations (read only) Number of
+              iterations used by the friction solver at the last time step.
+              The maximum is 50. The value is 0 when no gear is in contact with
+              the ground.
+    @property accelerations/friction-residual (read only) Sum of the absolute
+              changes of the Lagrange multipliers at the last iteration of the
+              friction solver. The solver stops when it is lower than 1E-5.
+
     Special care is taken in the calculations to obtain maximum fidelity in
     JSBSim results. In FGAccelerations, this is obtained by avoiding as much as
     possible the transformations from one frame to another. As a consequence,
@@ -263,6 +275,15 @@ public:
   double GetForces(int idx) const { return in.Force(idx) + vFrictionForces(idx); }
   FGColumnVector3 GetForces(void) const { return in.Force + vFrictionForces; }
 
+  /** Retrieves the number of iterations of the friction solver at the last
+      time step. */
+  int GetFrictionIterations(void) const { return FrictionIterations; }
+
+  /** Retrieves the residual of the friction solver at the last time step.
+      This is the sum of the absolute changes of the Lagrange multipliers at
+      the last iteration. */
+  double GetFrictionResidual(void) const { return FrictionResidual; }
+
   /** Retrieves the ground moments applied on the body.
       Retrieves the ground moments applied on the body. This does include the
       ground normal reaction and friction moments.
@@ -370,6 +391,13 @@ private:
   FGColumnVector3 vFrictionForces;
   FGColumnVector3 vFrictionMoments;
 
+  // Storage of the friction solver kept from one time step to the next.
+  std::vector<double> FrictionMatrix;
+  std::vector<double> FrictionRHS;
+  std::vector<double> FrictionLambda;
+  int FrictionIterations;
+  double FrictionResidual;
+
   bool gravTorque;
 
   void CalculatePQRdot(void);
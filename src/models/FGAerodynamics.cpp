@@ -178,7 +178,6 @@ bool FGAerodynamics::Run(bool Holding)
     }
   }
 
-  vFw.InitMatrix();
   vFnative.InitMatrix();
   vFnativeAtCG.InitMatrix();
 
@@ -211,10 +210,10 @@ bool FGAerodynamics::Run(bool Holding)
     break;
   case atWind:      // Copy forces into wind axes
     vFnative(eDrag)*=-1; vFnative(eLift)*=-1;
-    vForces = in.Tw2b*vFnative;
+    in.Tw2b.Multiply(vFnative, vForces);
 
     vFnativeAtCG(eDrag)*=-1; vFnativeAtCG(eLift)*=-1;
-    vForcesAtCG = in.Tw2b*vFnativeAtCG;
+    in.Tw2b.Multiply(vFnativeAtCG, vForcesAtCG);
     break;
   case atBodyAxialNormal:   // Convert native forces into Axial|Normal|Side system
     vFnative(eX)*=-1; vFnative(eZ)*=-1;
@@ -225,10 +224,10 @@ bool FGAerodynamics::Run(bool Holding)
     break;
   case atStability:   // Convert from stability axes to both body and wind axes
     vFnative(eDrag) *= -1; vFnative(eLift) *= -1;
-    vForces = Ts2b*vFnative;
+    Ts2b.Multiply(vFnative, vForces);
 
     vFnativeAtCG(eDrag) *= -1; vFnativeAtCG(eLift) *= -1;
-    vForcesAtCG = Ts2b*vFnativeAtCG;
+    Ts2b.Multiply(vFnativeAtCG, vForcesAtCG);
     break;
   default:
     {
@@ -265,16 +264,15 @@ bool FGAerodynamics::Run(bool Holding)
 
   // Transform moments to bodyXYZ if the moments are specified in stability or
   // wind axes
-  vMomentsMRCBodyXYZ.InitMatrix();
   switch (momentAxisType) {
   case atBodyXYZ:
     vMomentsMRCBodyXYZ = vMomentsMRC;
     break;
   case atStability:
-    vMomentsMRCBodyXYZ = Ts2b*vMomentsMRC;
+    Ts2b.Multiply(vMomentsMRC, vMomentsMRCBodyXYZ);
     break;
   case atWind:
-    vMomentsMRCBodyXYZ = in.Tw2b*vMomentsMRC;
+    in.Tw2b.Multiply(vMomentsMRC, vMomentsMRCBodyXYZ);
     break;
   default:
     {
@@ -285,7 +283,8 @@ bool FGAerodynamics::Run(bool Holding)
     }
   }
 
-  vMoments = vMomentsMRCBodyXYZ + vDXYZcg*vForces; // M = r X F
+  vMoments = vMomentsMRCBodyXYZ;
+  vMoments.AddCross(vDXYZcg, vForces); // M = r X F
 
   // Now add the "at CG" values to base forces - after the moments have been
   // transferred.
@@ -303,7 +302,7 @@ bool FGAerodynamics::Run(bool Holding)
   // as positive numbers. However, the wind axes themselves assume that the X
   // and Z forces are positive forward and down. Same applies to the stability
   // axes.
-  vFw = in.Tb2w * vForces;
+  in.Tb2w.Multiply(vForces, vFw);
   vFw(eDrag) *= -1; vFw(eLift) *= -1;
 
   // Calculate Lift over Drag
@@ -566,26 +565,23 @@ string FGAerodynamics::GetAeroFunctionStrings(const string& delimeter) const
 
 string FGAerodynamics::GetAeroFunctionValues(const string& delimeter) const
 {
-  ostringstream buf;
+  vector<FGOutputValue> values;
 
-  for (unsigned int axis = 0; axis < 6; axis++) {
-    for (unsigned int sd = 0; sd < AeroFunctions[axis].size(); sd++) {
-      if (buf.tellp() > 0) buf << delimeter;
-      buf << AeroFunctions[axis][sd]->GetValue();
-    }
-  }
+  GetAeroFunctionValueSources(values);
 
-  string FunctionValues = FGModelFunctions::GetFunctionValues(delimeter);
+  return FormatValues(values, delimeter);
+}
 
-  if (!FunctionValues.empty()) {
-    if (!buf.str().empty()) {
-      buf << delimeter << FunctionValues;
-    } else {
-      buf << FunctionValues;
-    }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::GetAeroFunctionValueSources(vector<FGOutputValue>& values) const
+{
+  for (unsigned int axis = 0; axis < 6; axis++) {
+    for (auto f: AeroFunctions[axis])
+      values.push_back({[f]() { return f->GetValue(); }, 6});
   }
 
-  return buf.str();
+  FGModelFunctions::GetFunctionValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -657,7 +653,7 @@ void FGAerodynamics::BuildStabilityTransformMatrices(void)
   Ts2b(3, 2) = 0.0;
   Ts2b(3, 3) = ca;
 
-  Tb2s = Ts2b.Transposed();
+  Tb2s.SetTransposed(Ts2b);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
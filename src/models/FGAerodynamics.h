@@ -233,6 +233,11 @@ public:
       aero functions */
   std::string GetAeroFunctionValues(const std::string& delimeter) const;
 
+  /** Gets the sources of the aero function values.
+      @param values the list to which the sources are appended, in the same
+                    order as GetAeroFunctionValues() */
+  void GetAeroFunctionValueSources(std::vector<FGOutputValue>& values) const;
+
   std::vector <FGFunction*> * GetAeroFunctions(void) const { return AeroFunctions; }
 
   struct Inputs {
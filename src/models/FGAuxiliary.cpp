@@ -210,16 +210,19 @@ bool FGAuxiliary::Run(bool Holding)
   else
     vcas = veas = 0.0;
 
-  vPilotAccel.InitMatrix();
   vNcg = in.vBodyAccel/in.StandardGravity;
   // Nz is Acceleration in "g's", along normal axis (-Z body axis)
   Nz = -vNcg(eZ);
   Ny =  vNcg(eY);
   Nx =  vNcg(eX);
-  vPilotAccel = in.vBodyAccel + in.vPQRidot * in.ToEyePt;
-  vPilotAccel += in.vPQRi * (in.vPQRi * in.ToEyePt);
-
-  vNwcg = mTb2w * vNcg;
+  // The products below are accumulated in place to avoid the intermediate
+  // vectors of vBodyAccel + vPQRidot*ToEyePt + vPQRi*(vPQRi*ToEyePt).
+  vPilotAccel = in.vBodyAccel;
+  vPilotAccel.AddCross(in.vPQRidot, in.ToEyePt);
+  FGColumnVector3 vEyeVel = in.vPQRi * in.ToEyePt;
+  vPilotAccel.AddCross(in.vPQRi, vEyeVel);
+
+  mTb2w.Multiply(vNcg, vNwcg);
   vNwcg(eZ) = 1.0 - vNwcg(eZ);
 
   vPilotAccelN = vPilotAccel / in.StandardGravity;
@@ -350,7 +353,7 @@ void FGAuxiliary::UpdateWindMatrices(void)
   mTw2b(3,2) = -sa*sb;
   mTw2b(3,3) =  ca;
 
-  mTb2w = mTw2b.Transposed();
+  mTb2w.SetTransposed(mTw2b);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -367,7 +370,8 @@ double FGAuxiliary::GetNlf(void) const
 
 double FGAuxiliary::GetLongitudeRelativePosition(void) const
 {
-  return in.vLocation.GetDistanceTo(FDMExec->GetIC()->GetLongitudeRadIC(),
+  return in.vLocation.GetDistanceTo(FDMExec->GetInertial()->GetGeodesic(),
+                                    FDMExec->GetIC()->GetLongitudeRadIC(),
                                     in.vLocation.GetGeodLatitudeRad())*fttom;
 }
 
@@ -375,7 +379,8 @@ double FGAuxiliary::GetLongitudeRelativePosition(void) const
 
 double FGAuxiliary::GetLatitudeRelativePosition(void) const
 {
-  return in.vLocation.GetDistanceTo(in.vLocation.GetLongitude(),
+  return in.vLocation.GetDistanceTo(FDMExec->GetInertial()->GetGeodesic(),
+                                    in.vLocation.GetLongitude(),
                                     FDMExec->GetIC()->GetGeodLatitudeRadIC())*fttom;
 }
 
@@ -384,7 +389,8 @@ double FGAuxiliary::GetLatitudeRelativePosition(void) const
 double FGAuxiliary::GetDistanceRelativePosition(void) const
 {
   auto ic = FDMExec->GetIC();
-  return in.vLocation.GetDistanceTo(ic->GetLongitudeRadIC(),
+  return in.vLocation.GetDistanceTo(FDMExec->GetInertial()->GetGeodesic(),
+                                    ic->GetLongitudeRadIC(),
                                     ic->GetGeodLatitudeRadIC())*fttom;
 }
 
@@ -60,6 +60,7 @@ INCLUDES
 #include "models/flight_control/FGAngles.h"
 #include "models/flight_control/FGDistributor.h"
 #include "models/flight_control/FGLinearActuator.h"
+#include "models/flight_control/FGFCSPlan.h"
 
 #include "FGFCSChannel.h"
 
@@ -71,7 +72,7 @@ namespace JSBSim {
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-FGFCS::FGFCS(FGFDMExec* fdm) : FGModel(fdm), ChannelRate(1)
+FGFCS::FGFCS(FGFDMExec* fdm) : FGModel(fdm), ChannelRate(1), Plan(pmPlan)
 {
   int i;
   Name = "FGFCS";
@@ -625,9 +626,18 @@ double FGFCS::GetBrake(FGLGear::BrakeGroup bg)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 SGPath FGFCS::FindFullPathName(const SGPath& path) const
+{
+  if (systype != stSystem) return FGModel::FindFullPathName(path);
+
+  return FindSystemFullPathName(path);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPath FGFCS::FindSystemFullPathName(const SGPath& path) const
 {
   SGPath name = FGModel::FindFullPathName(path);
-  if (systype != stSystem || !name.isNull()) return name;
+  if (!name.isNull()) return name;
 
 #ifdef _WIN32
   const array<string, 1> dir_names = {"Systems"};
@@ -671,24 +681,25 @@ string FGFCS::GetComponentStrings(const string& delimiter) const
 
 string FGFCS::GetComponentValues(const string& delimiter) const
 {
-  std::ostringstream buf;
+  vector<FGOutputValue> values;
 
-  bool firstime = true;
-  int total_count=0;
+  GetComponentValueSources(values);
+
+  return FormatValues(values, delimiter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCS::GetComponentValueSources(vector<FGOutputValue>& values) const
+{
   for (unsigned int i=0; i<SystemChannels.size(); i++)
   {
     for (unsigned int c=0; c<SystemChannels[i]->GetNumComponents(); c++)
     {
-      if (firstime) firstime = false;
-      else          buf << delimiter;
-
-      buf << setprecision(9) << SystemChannels[i]->GetComponent(c)->GetOutput();
-      total_count++;
+      FGFCSComponent* component = SystemChannels[i]->GetComponent(c);
+      values.push_back({[component]() { return component->GetOutput(); }, 9});
     }
   }
-
-  return buf.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -717,6 +728,18 @@ double FGFCS::GetDt(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+int FGFCS::GetPlanMismatches(void) const
+{
+  int mismatches = 0;
+
+  for (auto channel: SystemChannels)
+    mismatches += channel->GetPlanMismatches();
+
+  return mismatches;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCS::bind(void)
 {
   PropertyManager->Tie("fcs/aileron-cmd-norm", this, &FGFCS::GetDaCmd, &FGFCS::SetDaCmd);
@@ -772,6 +795,10 @@ void FGFCS::bind(void)
   PropertyManager->Tie("gear/tailhook-pos-norm", this, &FGFCS::GetTailhookPos, &FGFCS::SetTailhookPos);
   PropertyManager->Tie("fcs/wing-fold-pos-norm", this, &FGFCS::GetWingFoldPos, &FGFCS::SetWingFoldPos);
   PropertyManager->Tie("simulation/channel-dt", this, &FGFCS::GetChannelDeltaT);
+  PropertyManager->Tie("simulation/fcs-plan", this, &FGFCS::GetPlanMode,
+                       &FGFCS::SetPlanMode);
+  PropertyManager->Tie("simulation/fcs-plan-mismatches", this,
+                       &FGFCS::GetPlanMismatches);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -161,6 +161,12 @@ CLASS DOCUMENTATION
     @property fcs/wing-fold-pos-norm
     @property gear/gear-pos-norm
     @property gear/tailhook-pos-norm
+    @property simulation/fcs-plan selects the execution of the channels: 0 runs
+              each component, 1 (the default) runs the execution plans (see
+              FGFCSPlan) and 2 runs each component and checks that the
+              execution plans give the same results.
+    @property simulation/fcs-plan-mismatches number of differences found when
+              checking the execution plans (read only)
 
     @author Jon S. Berndt
     @version $Revision: 1.55 $
@@ -375,6 +381,11 @@ public:
       component outputs */
   std::string GetComponentValues(const std::string& delimiter) const;
 
+  /** Gets the sources of the component outputs.
+      @param values the list to which the sources are appended, in the same
+                    order as GetComponentValues() */
+  void GetComponentValueSources(std::vector<FGOutputValue>& values) const;
+
   /// @name Pilot input command setting
   //@{
   /** Sets the aileron command
@@ -551,6 +562,15 @@ public:
   //@}
 
   enum SystemType { stFCS, stSystem, stAutoPilot };
+  enum PlanMode { pmComponents, pmPlan, pmVerify };
+
+  /** Selects how the channels are executed.
+      @param mode one of the PlanMode values */
+  void SetPlanMode(int mode) { Plan = mode; }
+  /// Returns how the channels are executed.
+  int GetPlanMode(void) const { return Plan; }
+  /// Returns the number of differences found when checking the execution plans.
+  int GetPlanMismatches(void) const;
 
   /** Loads the Flight Control System.
       Load() is called from FGFDMExec.
@@ -559,6 +579,10 @@ public:
   bool Load(Element* el) override;
 
   SGPath FindFullPathName(const SGPath& path) const override;
+  /** Finds a system file in the aircraft folder, then in its Systems folder
+      and then in the systems path.
+      @return a null path if the file does not exist. */
+  SGPath FindSystemFullPathName(const SGPath& path) const;
 
   void AddThrottle(void);
   double GetDt(void) const;
@@ -587,6 +611,7 @@ private:
   double TailhookPos, WingFoldPos;
   SystemType systype;
   int ChannelRate;
+  int Plan;
 
   typedef std::vector <FGFCSChannel*> Channels;
   Channels SystemChannels;
@@ -39,6 +39,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iostream>
+#include <memory>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -61,6 +62,10 @@ CLASS DOCUMENTATION
       execrate [optional] is the rate at which the channel should execute.
                A value of 0 or 1 will execute the channel every frame, a value of 2
                every other frame (half rate), a value of 4 is every 4th frame (quarter rate)
+
+      Unless the property simulation/fcs-plan is set to 0, the components are
+      executed by an execution plan built the first time the channel is
+      executed (see FGFCSPlan).
       */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -92,6 +97,7 @@ public:
   /// Adds a component to a channel
   void Add(FGFCSComponent* comp) {
     FCSComponents.push_back(comp);
+    Plan.reset();
   }
   /// Returns the number of components in the channel.
   size_t GetNumComponents() {return FCSComponents.size();}
@@ -132,12 +138,25 @@ public:
     // channel will be run at rate 1 if trimming, or when the next execrate
     // frame is reached
     if (fcs->GetTrimStatus() || ExecFrameCountSinceLastRun >= ExecRate) {
-      for (unsigned int i=0; i<FCSComponents.size(); i++)
-        FCSComponents[i]->Run();
+      int mode = fcs->GetPlanMode();
+
+      if (mode == FGFCS::pmPlan || mode == FGFCS::pmVerify) {
+        if (!Plan) BuildPlan();
+
+        if (mode == FGFCS::pmVerify)
+          PlanMismatches += Plan->Verify();
+        else
+          Plan->Execute();
+      } else {
+        for (unsigned int i=0; i<FCSComponents.size(); i++)
+          FCSComponents[i]->Run();
+      }
     }
   }
   /// Get the channel rate
   int GetRate(void) const { return ExecRate; }
+  /// Returns the number of mismatches found when verifying the execution plan.
+  unsigned int GetPlanMismatches(void) const { return PlanMismatches; }
 
   private:
     FGFCS* fcs;
@@ -147,6 +166,20 @@ public:
 
     int ExecRate;        // rate at which this system executes, 0 or 1 every frame, 2 every second frame etc..
     int ExecFrameCountSinceLastRun;
+    std::unique_ptr<FGFCSPlan> Plan;
+    unsigned int PlanMismatches = 0;
+
+    void BuildPlan(void) {
+      Plan = std::make_unique<FGFCSPlan>(fcs, FCSComponents);
+
+      if (FGJSBBase::debug_lvl & 1) {
+        FGLogging log(fcs->GetExec()->GetLogger(), LogLevel::DEBUG);
+        log << "    Channel " << Name << ": " << Plan->GetNumCompiled()
+            << " of " << FCSComponents.size() << " components in "
+            << Plan->GetNumOperations() << " operations and "
+            << Plan->GetNumSlots() << " slots\n";
+      }
+    }
 };
 
 }
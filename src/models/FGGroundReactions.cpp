@@ -199,41 +199,47 @@ string FGGroundReactions::GetGroundReactionStrings(string delimeter) const
 
 string FGGroundReactions::GetGroundReactionValues(string delimeter) const
 {
-  std::ostringstream buf;
+  vector<FGOutputValue> values;
+
+  GetGroundReactionValueSources(values);
+
+  return FormatValues(values, delimeter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  for (auto& gear: lGear) {
+void FGGroundReactions::GetGroundReactionValueSources(vector<FGOutputValue>& values) const
+{
+  // The totals are output with the precision of the last value of the gears.
+  int precision = 6;
+
+  for (auto& lgear: lGear) {
+    FGLGear* gear = lgear.get();
+    values.push_back({[gear]() { return gear->GetWOW() ? 1.0 : 0.0; }, 1});
+    values.push_back({[gear]() { return gear->GetCompLen(); }, 5});
+    values.push_back({[gear]() { return gear->GetCompVel(); }, 6});
+    values.push_back({[gear]() { return gear->GetCompForce(); }, 10});
+    precision = 10;
     if (gear->IsBogey()) {
-      buf << (gear->GetWOW() ? "1" : "0") << delimeter
-          << setprecision(5) << gear->GetCompLen() << delimeter
-          << setprecision(6) << gear->GetCompVel() << delimeter
-          << setprecision(10) << gear->GetCompForce() << delimeter
-          << gear->GetWheelSideForce() << delimeter
-          << gear->GetWheelRollForce() << delimeter
-          << gear->GetBodyXForce() << delimeter
-          << gear->GetBodyYForce() << delimeter
-          << setprecision(6) << gear->GetWheelVel(eX) << delimeter
-          << gear->GetWheelVel(eY) << delimeter
-          << gear->GetWheelRollVel() << delimeter
-          << gear->GetWheelSideVel() << delimeter
-          << gear->GetWheelSlipAngle() << delimeter;
-    } else {
-      buf << (gear->GetWOW() ? "1" : "0") << delimeter
-          << setprecision(5) << gear->GetCompLen() << delimeter
-          << setprecision(6) << gear->GetCompVel() << delimeter
-          << setprecision(10) << gear->GetCompForce() << delimeter;
+      values.push_back({[gear]() { return gear->GetWheelSideForce(); }, 10});
+      values.push_back({[gear]() { return gear->GetWheelRollForce(); }, 10});
+      values.push_back({[gear]() { return gear->GetBodyXForce(); }, 10});
+      values.push_back({[gear]() { return gear->GetBodyYForce(); }, 10});
+      values.push_back({[gear]() { return gear->GetWheelVel(eX); }, 6});
+      values.push_back({[gear]() { return gear->GetWheelVel(eY); }, 6});
+      values.push_back({[gear]() { return gear->GetWheelRollVel(); }, 6});
+      values.push_back({[gear]() { return gear->GetWheelSideVel(); }, 6});
+      values.push_back({[gear]() { return gear->GetWheelSlipAngle(); }, 6});
+      precision = 6;
     }
   }
 
-  auto Accelerations = FDMExec->GetAccelerations();
+  auto Accelerations = FDMExec->GetAccelerations().get();
 
-  buf << Accelerations->GetGroundForces(eX) << delimeter
-      << Accelerations->GetGroundForces(eY) << delimeter
-      << Accelerations->GetGroundForces(eZ) << delimeter
-      << Accelerations->GetGroundMoments(eX) << delimeter
-      << Accelerations->GetGroundMoments(eY) << delimeter
-      << Accelerations->GetGroundMoments(eZ);
-
-  return buf.str();
+  for (int i=eX; i<=eZ; i++)
+    values.push_back({[Accelerations, i]() { return Accelerations->GetGroundForces(i); }, precision});
+  for (int i=eL; i<=eN; i++)
+    values.push_back({[Accelerations, i]() { return Accelerations->GetGroundMoments(i); }, precision});
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -97,6 +97,9 @@ public:
   double GetMoments(int idx) const {return vMoments(idx);}
   std::string GetGroundReactionStrings(std::string delimeter) const;
   std::string GetGroundReactionValues(std::string delimeter) const;
+  /** Gets the sources of the values returned by GetGroundReactionValues().
+      @param values the list to which the sources are appended */
+  void GetGroundReactionValueSources(std::vector<FGOutputValue>& values) const;
   bool GetWOW(void) const;
 
   /** Gets the number of gears.
@@ -74,6 +74,7 @@ FGInertial::FGInertial(FGFDMExec* fgex)
 
   vOmegaPlanet = { 0.0, 0.0, RotationRate };
   GroundCallback = std::make_unique<FGDefaultGroundCallback>(a, b);
+  Geodesic = std::make_unique<GeographicLib::Geodesic>(a, 1.-b/a);
 
   bind();
 
@@ -106,7 +107,7 @@ bool FGInertial::Load(Element* el)
   // Trigger GeographicLib exceptions if the equatorial or polar radii are
   // ill-defined.
   // This intercepts the exception before being thrown by a destructor.
-  GeographicLib::Geodesic geod(a, 1.-b/a);
+  Geodesic = std::make_unique<GeographicLib::Geodesic>(a, 1.-b/a);
 
   if (el->FindElement("rotation_rate")) {
     double RotationRate = el->FindElementValueAsNumberConvertTo("rotation_rate", "RAD/SEC");
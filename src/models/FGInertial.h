@@ -44,6 +44,10 @@ INCLUDES
 #include "math/FGLocation.h"
 #include "input_output/FGGroundCallback.h"
 
+namespace GeographicLib {
+class Geodesic;
+}
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -86,6 +90,11 @@ public:
   double GetSemimajor(void) const {return a;}
   double GetSemiminor(void) const {return b;}
   double GetGM(void) const {return GM;}
+  /** Returns the solver of the geodesic problems on the planet ellipse. It is
+      shared by all the distance and heading computations (see
+      FGLocation::GetDistanceAndHeadingTo()) and is rebuilt when the planet
+      is loaded. */
+  const GeographicLib::Geodesic& GetGeodesic(void) const {return *Geodesic;}
 
   /** @name Functions that rely on the ground callback
       The following functions allow to set and get the vehicle position above
@@ -215,6 +224,7 @@ private:
   double b;    // WGS84 semiminor axis length in feet
   int gravType;
   std::unique_ptr<FGGroundCallback> GroundCallback;
+  std::unique_ptr<GeographicLib::Geodesic> Geodesic;
 
   double GetGAccel(double r) const;
   FGColumnVector3 GetGravityJ2(const FGLocation& position) const;
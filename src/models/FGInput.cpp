@@ -41,6 +41,9 @@ INCLUDES
 #include "FGInput.h"
 #include "FGFDMExec.h"
 #include "input_output/FGUDPInputSocket.h"
+#include "input_output/FGInputServer.h"
+#include "input_output/FGUDPBinaryInputSocket.h"
+#include "input_output/FGInputSharedMemory.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/FGModelLoader.h"
 #include "input_output/FGLog.h"
@@ -104,6 +107,12 @@ bool FGInput::Load(Element* el)
     Input = new FGInputSocket(FDMExec);
   } else if (type == "QTJSBSIM") {
     Input = new FGUDPInputSocket(FDMExec);
+  } else if (type == "SERVER") {
+    Input = new FGInputServer(FDMExec);
+  } else if (type == "BINARY") {
+    Input = new FGUDPBinaryInputSocket(FDMExec);
+  } else if (type == "SHM") {
+    Input = new FGInputSharedMemory(FDMExec);
   } else if (type != string("NONE")) {
     FGXMLLogging log(FDMExec->GetLogger(), element, LogLevel::ERROR);
     log << "Unknown type of input specified in config file" << endl;
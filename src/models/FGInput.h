@@ -63,6 +63,13 @@ CLASS DOCUMENTATION
       SOCKET      Will eventually send data to a socket input, where NAME
                   would then be the IP address of the machine the data should
                   be sent to. DON'T USE THIS YET!
+      SERVER      Accepts several simultaneous telnet clients without blocking
+                  the simulation (see FGInputServer).
+      BINARY      Reads binary UDP datagrams which layout is described in the
+                  XML directives (see FGUDPBinaryInputSocket).
+      SHM         Reads the properties published in a shared memory segment
+                  by another process on the same host. NAME is the name of
+                  the segment (see FGInputSharedMemory).
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data input without having to mess with anything else.
 
@@ -327,7 +327,7 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
       // transform this height in actual compression of the strut (BOGEY) or in
       // the normal direction to the ground (STRUCTURE)
       double normalZ = (in.Tec2l*normal)(eZ);
-      LGearProj = -(mTGear.Transposed() * vGroundNormal)(eZ);
+      LGearProj = -mTGear.TransposedMultiply(vGroundNormal)(eZ);
 
       // The following equations use the vector to the tire contact patch
       // including the strut compression.
@@ -355,13 +355,13 @@ const FGColumnVector3& FGLGear::GetBodyForces(void)
       vActingXYZn = vXYZn + Tb2s * vWhlDisplVec;
       FGColumnVector3 vBodyWhlVel = in.PQR * vWhlContactVec;
       vBodyWhlVel += in.UVW - in.Tec2b * terrainVel;
-      vWhlVelVec = mTGear.Transposed() * vBodyWhlVel;
+      vWhlVelVec = mTGear.TransposedMultiply(vBodyWhlVel);
 
       InitializeReporting();
       ComputeSteeringAngle();
       ComputeGroundFrame();
 
-      vGroundWhlVel = mT.Transposed() * vBodyWhlVel;
+      vGroundWhlVel = mT.TransposedMultiply(vBodyWhlVel);
 
       if (fdmex->GetTrimStatus() || in.TotalDeltaT == 0.0)
         compressSpeed = 0.0; // Steady state is sought during trimming
@@ -656,7 +656,7 @@ void FGLGear::ComputeVerticalStrutForce()
   switch (eContactType) {
   case ctBOGEY:
     // Project back the strut force in the local coordinate frame of the ground
-    vFn(eZ) = StrutForce / (mTGear.Transposed()*vGroundNormal)(eZ);
+    vFn(eZ) = StrutForce / mTGear.TransposedMultiply(vGroundNormal)(eZ);
     break;
   case ctSTRUCTURE:
     vFn(eZ) = -StrutForce;
@@ -763,7 +763,7 @@ void FGLGear::UpdateForces(void)
     vFn(eY) = LMultiplier[ftSide].value;
   }
   else {
-    FGColumnVector3 forceDir = mT.Transposed() * LMultiplier[ftDynamic].ForceJacobian;
+    FGColumnVector3 forceDir = mT.TransposedMultiply(LMultiplier[ftDynamic].ForceJacobian);
     vFn(eX) = LMultiplier[ftDynamic].value * forceDir(eX);
     vFn(eY) = LMultiplier[ftDynamic].value * forceDir(eY);
   }
@@ -284,11 +284,11 @@ public:
 
   double GetWheelRollForce(void) {
     UpdateForces();
-    FGColumnVector3 vForce = mTGear.Transposed() * FGForce::GetBodyForces();
+    FGColumnVector3 vForce = mTGear.TransposedMultiply(FGForce::GetBodyForces());
     return vForce(eX)*cos(SteerAngle) + vForce(eY)*sin(SteerAngle); }
   double GetWheelSideForce(void) {
     UpdateForces();
-    FGColumnVector3 vForce = mTGear.Transposed() * FGForce::GetBodyForces();
+    FGColumnVector3 vForce = mTGear.TransposedMultiply(FGForce::GetBodyForces());
     return vForce(eY)*cos(SteerAngle) - vForce(eX)*sin(SteerAngle); }
   double GetBodyXForce(void) {
     UpdateForces();
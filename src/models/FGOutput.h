@@ -72,6 +72,10 @@ CLASS DOCUMENTATION
                   an external instance of FlightGear for visuals.  Parameters
                   defining the socket are given on the \<output> line.
       TABULAR     Columnar data.
+      SHM         The properties are published in a shared memory segment
+                  which NAME is given on the \<output> line. Other processes
+                  on the same host can read it without copy nor lock (see
+                  FGOutputSharedMemory).
       TERMINAL    Output to terminal. NOT IMPLEMENTED YET!
       NONE        Specifies to do nothing. This setting makes it easy to turn on
                   and off the data output without having to mess with anything
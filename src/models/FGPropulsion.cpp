@@ -470,6 +470,13 @@ SGPath FGPropulsion::FindFullPathName(const SGPath& path) const
   SGPath name = FGModel::FindFullPathName(path);
   if (!ReadingEngine && !name.isNull()) return name;
 
+  return FindEngineFullPathName(path);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPath FGPropulsion::FindEngineFullPathName(const SGPath& path) const
+{
 #ifdef _WIN32
   // Singular and plural are allowed for the folder names for consistency with
   // the default engine folder name "engine" and for backward compatibility
@@ -481,7 +488,7 @@ SGPath FGPropulsion::FindFullPathName(const SGPath& path) const
 #endif
 
   for(const string& dir_name: dir_names) {
-    name = CheckPathName(FDMExec->GetFullAircraftPath()/dir_name, path);
+    SGPath name = CheckPathName(FDMExec->GetFullAircraftPath()/dir_name, path);
     if (!name.isNull()) return name;
   }
 
@@ -521,28 +528,34 @@ string FGPropulsion::GetPropulsionStrings(const string& delimiter) const
 
 string FGPropulsion::GetPropulsionValues(const string& delimiter) const
 {
-  string PropulsionValues;
-  bool firstime = true;
-  stringstream buf;
+  vector<FGOutputValue> values;
 
-  for (const auto& engine: Engines) {
-    if (firstime)  firstime = false;
-    else           PropulsionValues += delimiter;
+  GetPropulsionValueSources(values);
 
-    PropulsionValues += engine->GetEngineValues(delimiter);
-  }
-  for (const auto& tank: Tanks) {
-    buf << delimiter;
-    buf << tank->GetContents();
-  }
+  string PropulsionValues = FormatValues(values, delimiter);
 
-  PropulsionValues += buf.str();
+  // The tank contents are always preceded by a delimiter.
+  if (Engines.empty() && !Tanks.empty())
+    PropulsionValues.insert(0, delimiter);
 
   return PropulsionValues;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPropulsion::GetPropulsionValueSources(vector<FGOutputValue>& values) const
+{
+  for (const auto& engine: Engines)
+    engine->GetEngineValueSources(values);
+
+  for (const auto& tank: Tanks) {
+    FGTank* t = tank.get();
+    values.push_back({[t]() { return t->GetContents(); }, 6});
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGPropulsion::GetPropulsionTankReport()
 {
   string out;
@@ -155,6 +155,10 @@ public:
 
   std::string GetPropulsionStrings(const std::string& delimiter) const;
   std::string GetPropulsionValues(const std::string& delimiter) const;
+  /** Gets the sources of the values returned by GetPropulsionValues(): the
+      values of each engine followed by the contents of each tank.
+      @param values the list to which the sources are appended */
+  void GetPropulsionValueSources(std::vector<FGOutputValue>& values) const;
   std::string GetPropulsionTankReport();
 
   const FGColumnVector3& GetForces(void) const {return vForces; }
@@ -170,6 +174,10 @@ public:
   double GetTanksWeight(void) const;
 
   SGPath FindFullPathName(const SGPath& path) const override;
+  /** Finds an engine or thruster file in the engine folders of the aircraft
+      and then in the engine path.
+      @return a null path if the file does not exist. */
+  SGPath FindEngineFullPathName(const SGPath& path) const;
   inline int GetActiveEngine(void) const {return ActiveEngine;}
   inline bool GetFuelFreeze(void) const {return FuelFreeze;}
 
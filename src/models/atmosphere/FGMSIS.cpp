@@ -58,8 +58,11 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
+
 #include "FGFDMExec.h"
 #include "FGMSIS.h"
+#include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
 
 using namespace std;
@@ -99,6 +102,9 @@ bool FGMSIS::InitModel(void)
 {
   FGStandardAtmosphere::InitModel();
 
+  // Build the grid now rather than during the first time step.
+  if (useCache) UpdateCache(FDMExec->GetSimTime());
+
   Calculate(0.0);
 
   return true;
@@ -115,6 +121,26 @@ bool FGMSIS::Load(Element* el)
   if (el->FindElement("utc"))
     seconds_in_day = el->FindElementValueAsNumber("utc");
 
+  Element* cache_el = el->FindElement("cache");
+  useCache = cache_el != nullptr;
+  cache.valid = false;
+  if (cache_el) {
+    constexpr double fttokm = fttom / 1000.;
+
+    if (cache_el->HasAttribute("tolerance"))
+      cacheTolerance = cache_el->GetAttributeValueAsNumber("tolerance");
+    if (cache_el->FindElement("min_altitude"))
+      cacheMinAltitude = cache_el->FindElementValueAsNumberConvertTo("min_altitude", "FT")*fttokm;
+    if (cache_el->FindElement("max_altitude"))
+      cacheMaxAltitude = cache_el->FindElementValueAsNumberConvertTo("max_altitude", "FT")*fttokm;
+
+    if (cacheTolerance <= 0.0 || cacheMaxAltitude <= cacheMinAltitude) {
+      FGXMLLogging log(FDMExec->GetLogger(), cache_el, LogLevel::ERROR);
+      log << "The tolerance must be positive and the altitude range not empty.\n";
+      return false;
+    }
+  }
+
   Debug(3);
 
   return true;
@@ -146,34 +172,65 @@ void FGMSIS::Compute(double altitude, double& pressure, double& temperature,
                     double& density, double &Rair) const
 {
   constexpr double fttokm = fttom / 1000.;
-  constexpr double kgm3_to_slugft3 = kgtoslug / m3toft3;
-  constexpr double gtoslug = kgtoslug / 1000.;
-  // Molecular weight (g/mol)
-  // N2 O2 O He H Ar N OA
-  const double species_mmol[8] {28.0134, 31.9988, 31.9988/2.0, 4.0, 1.0, 39.948,
-                                28.0134/2.0, 31.9988/2.0};
 
-  double dn[10] {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
   double h = altitude*fttokm;
   double lat = in.GeodLatitudeDeg;
   double lon = in.LongitudeDeg;
 
-  // Compute epoch
-  double utc_seconds = seconds_in_day + FDMExec->GetSimTime();
+  if (useCache && h >= cacheMinAltitude && h <= cacheMaxAltitude) {
+    double time = FDMExec->GetSimTime();
+    UpdateCache(time);
+
+    double doy, sec;
+    GetEpoch(time, doy, sec);
+    Interpolate(h, lat, sec/3600 + lon/15, temperature, density, Rair);
+  }
+  else {
+    double doy, sec;
+    GetEpoch(FDMExec->GetSimTime(), doy, sec);
+    Evaluate(doy, sec, h, lat, lon, temperature, density, Rair);
+  }
+
+  pressure = density * Rair * temperature;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::GetEpoch(double time, double& doy, double& sec) const
+{
+  double utc_seconds = seconds_in_day + time;
   unsigned int days = utc_seconds / 86400.;
   utc_seconds -= days * 86400.;
   double today = day_of_year + days;
   unsigned int year = today / 365.;
   today -= year * 365.;
 
+  doy = today;
+  sec = utc_seconds;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::Evaluate(double doy, double sec, double h, double lat, double lon,
+                      double& temperature, double& density, double& Rair) const
+{
+  constexpr double kgm3_to_slugft3 = kgtoslug / m3toft3;
+  constexpr double gtoslug = kgtoslug / 1000.;
+  // Molecular weight (g/mol)
+  // N2 O2 O He H Ar N OA
+  const double species_mmol[8] {28.0134, 31.9988, 31.9988/2.0, 4.0, 1.0, 39.948,
+                                28.0134/2.0, 31.9988/2.0};
+
+  double dn[10] {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
   struct nrlmsise_output output;
 
-  input.doy = today;
-  input.sec = utc_seconds;
+  input.doy = doy;
+  input.sec = sec;
   input.alt = h;
   input.g_lat = lat;
   input.g_long = lon;
-  input.lst = utc_seconds/3600 + lon/15;  // Local Solar Time (hours)
+  input.lst = sec/3600 + lon/15;  // Local Solar Time (hours)
   assert(flags.switches[9] != -1);        // Make sure that input.ap is used.
 
   gtd7(&input, &flags, &output);
@@ -201,8 +258,186 @@ void FGMSIS::Compute(double altitude, double& pressure, double& temperature,
   }
   double mair = mmol * gtoslug / qty_mol;
   Rair = Rstar / mair;
+}
 
-  pressure = density * Rair * temperature;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::UpdateCache(double time) const
+{
+  if (!cache.valid || fabs(time - cache.time) > cache.window)
+    BuildCache(time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::BuildCache(double time) const
+{
+  constexpr unsigned int nSamples = 64;
+  constexpr size_t MaxNodes = 1 << 20;
+  // The error budget is shared between the interpolation along each axis and
+  // the drift of the universal time.
+  const double target = 0.25*cacheTolerance;
+
+  double doy, sec;
+  GetEpoch(time, doy, sec);
+
+  // Values interpolated at (altitude, latitude, local solar time)
+  auto value = [&](double h, double lat, double lst, double sec, double* v) {
+    double lon = 15.0*(lst - sec/3600.);
+    Evaluate(doy, sec, h, lat, lon, v[0], v[1], v[2]);
+    v[1] = log(v[1]);
+  };
+  auto error = [](const double* v, const double* ref) {
+    return max({fabs(v[0]/ref[0]-1.0), fabs(v[1]-ref[1]), fabs(v[2]/ref[2]-1.0)});
+  };
+
+  RandomNumberGenerator generator(0, RandomNumberGenerator::StreamId("atmosphere/msis"));
+  auto uniform = [&](double lo, double hi) {
+    return lo + 0.5*(hi-lo)*(generator.GetUniformRandomNumber() + 1.0);
+  };
+
+  // Select the spacing along each axis such that the midpoint error of a
+  // linear interpolation meets the target. The error decreases with the square
+  // of the spacing so the spacing is halved until it does.
+  const double lo[3] {cacheMinAltitude, -90.0, 0.0};
+  const double span[3] {cacheMaxAltitude - cacheMinAltitude, 180.0, 24.0};
+  double step[3] {min(16.0, span[0]), 30.0, 4.0};
+  unsigned int n[3];
+
+  for (unsigned int axis=0; axis<3; ++axis) {
+    for (unsigned int iter=0; iter<12; ++iter) {
+      double max_error = 0.0;
+      for (unsigned int s=0; s<nSamples; ++s) {
+        double x[3], v0[3], v1[3], vm[3];
+        for (unsigned int a=0; a<3; ++a)
+          x[a] = uniform(lo[a], lo[a] + span[a] - (a == axis ? step[a] : 0.0));
+        value(x[0], x[1], x[2], sec, v0);
+        x[axis] += step[axis];
+        value(x[0], x[1], x[2], sec, v1);
+        x[axis] -= 0.5*step[axis];
+        value(x[0], x[1], x[2], sec, vm);
+        double mid[3] {0.5*(v0[0]+v1[0]), 0.5*(v0[1]+v1[1]), 0.5*(v0[2]+v1[2])};
+        max_error = max(max_error, error(mid, vm));
+      }
+      if (max_error <= target) break;
+      step[axis] *= 0.5;
+    }
+    n[axis] = max(1U, static_cast<unsigned int>(ceil(span[axis]/step[axis] - 1E-9)));
+  }
+
+  bool truncated = false;
+  while (size_t(n[0]+1)*(n[1]+1)*(n[2]+1) > MaxNodes) {
+    unsigned int* largest = max_element(n, n+3);
+    *largest = max(1U, *largest/2);
+    truncated = true;
+  }
+
+  cache.nAlt = n[0];
+  cache.nLat = n[1];
+  cache.nLst = n[2];
+  cache.dAlt = span[0]/n[0];
+  cache.dLat = span[1]/n[1];
+  cache.dLst = span[2]/n[2];
+
+  size_t size = size_t(n[0]+1)*(n[1]+1)*(n[2]+1);
+  cache.T.resize(size);
+  cache.logRho.resize(size);
+  cache.R.resize(size);
+
+  size_t idx = 0;
+  for (unsigned int i=0; i<=n[0]; ++i) {
+    double h = cacheMinAltitude + i*cache.dAlt;
+    for (unsigned int j=0; j<=n[1]; ++j) {
+      double lat = -90.0 + j*cache.dLat;
+      for (unsigned int k=0; k<=n[2]; ++k, ++idx) {
+        double v[3];
+        // The local solar time is periodic.
+        if (k == n[2]) {
+          size_t first = idx - n[2];
+          v[0] = cache.T[first]; v[1] = cache.logRho[first]; v[2] = cache.R[first];
+        }
+        else
+          value(h, lat, k*cache.dLst, sec, v);
+        cache.T[idx] = v[0];
+        cache.logRho[idx] = v[1];
+        cache.R[idx] = v[2];
+      }
+    }
+  }
+
+  cache.valid = true;
+  cache.time = time;
+
+  // Measure the interpolation error and the drift of the model with the
+  // universal time at constant local solar time.
+  cache.error = 0.0;
+  double drift = 0.0;
+  for (unsigned int s=0; s<nSamples; ++s) {
+    double h = uniform(lo[0], lo[0]+span[0]);
+    double lat = uniform(-90.0, 90.0);
+    double lst = uniform(0.0, 24.0);
+    double ref[3], v[3], later[3];
+    value(h, lat, lst, sec, ref);
+    Interpolate(h, lat, lst, v[0], v[1], v[2]);
+    v[1] = log(v[1]);
+    cache.error = max(cache.error, error(v, ref));
+    value(h, lat, lst, sec + 3600., later);
+    drift = max(drift, error(later, ref));
+  }
+
+  cache.window = drift > 0.0 ? target*3600./drift : 86400.;
+  cache.window = min(max(cache.window, 60.0), 86400.);
+
+  if (truncated || cache.error > cacheTolerance) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::WARN);
+    log << "The MSIS cache is limited to " << size << " nodes: the interpolation"
+        << " error is " << cache.error << " for a tolerance of "
+        << cacheTolerance << "\n";
+  }
+
+  if (debug_lvl & 1) {
+    FGLogging log(FDMExec->GetLogger(), LogLevel::DEBUG);
+    log << "    NRLMSIS cache: " << n[0]+1 << "x" << n[1]+1 << "x" << n[2]+1
+        << " nodes, error " << cache.error << ", valid for " << cache.window
+        << " s\n";
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::Interpolate(double h, double lat, double lst, double& temperature,
+                         double& density, double& Rair) const
+{
+  double x = (h - cacheMinAltitude)/cache.dAlt;
+  double y = (Constrain(-90.0, lat, 90.0) + 90.0)/cache.dLat;
+  double z = fmod(lst, 24.0);
+  if (z < 0.0) z += 24.0;
+  z /= cache.dLst;
+
+  unsigned int i = min(static_cast<unsigned int>(max(x, 0.0)), cache.nAlt-1);
+  unsigned int j = min(static_cast<unsigned int>(y), cache.nLat-1);
+  unsigned int k = min(static_cast<unsigned int>(z), cache.nLst-1);
+  double fx = x - i, fy = y - j, fz = z - k;
+
+  const size_t sk = 1;
+  const size_t sj = cache.nLst + 1;
+  const size_t si = sj*(cache.nLat + 1);
+  const size_t idx = i*si + j*sj + k;
+
+  auto trilinear = [&](const std::vector<double>& v) {
+    const double* p = v.data() + idx;
+    double c00 = p[0]*(1.0-fz) + p[sk]*fz;
+    double c01 = p[sj]*(1.0-fz) + p[sj+sk]*fz;
+    double c10 = p[si]*(1.0-fz) + p[si+sk]*fz;
+    double c11 = p[si+sj]*(1.0-fz) + p[si+sj+sk]*fz;
+    double c0 = c00*(1.0-fy) + c01*fy;
+    double c1 = c10*(1.0-fy) + c11*fy;
+    return c0*(1.0-fx) + c1*fx;
+  };
+
+  temperature = trilinear(cache.T);
+  density = exp(trilinear(cache.logRho));
+  Rair = trilinear(cache.R);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
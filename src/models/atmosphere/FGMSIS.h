@@ -41,6 +41,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <vector>
+
 #include "models/atmosphere/FGStandardAtmosphere.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -72,6 +74,40 @@ CLASS DOCUMENTATION
     reach him at devel@brodo.de. See the file "DOCUMENTATION" for details,
     and check http://www.brodo.de/english/pub/nrlmsise/index.html for
     updated releases of this package.
+
+    Since the evaluation of NRLMSISE-00 is costly, the model can optionally
+    serve the atmosphere properties from a grid that is interpolated:
+
+    @code
+    <atmosphere model="MSIS">
+      <day> {number} </day>
+      <utc> {number} </utc>
+      <cache tolerance="{number}">
+        <min_altitude unit="{FT | M}"> {number} </min_altitude>
+        <max_altitude unit="{FT | M}"> {number} </max_altitude>
+      </cache>
+    </atmosphere>
+    @endcode
+
+    The grid spans the altitudes between min_altitude (0 ft by default) and
+    max_altitude (100,000 ft by default), all the latitudes and all the local
+    solar times. The temperature, the logarithm of the density and the gas
+    constant are linearly interpolated and the pressure is computed from them.
+    Outside the altitude range, the model is evaluated directly. Note that the
+    variations of the thermosphere with the local solar time require a finer
+    grid so extending the range above 100,000 ft increases significantly the
+    time needed to build the grid.
+
+    The spacing of the grid is chosen so that the relative interpolation error
+    stays below the tolerance (0.01 by default) at sampled points. The grid is
+    computed for the universal time at which it is built: it is built when the
+    model is initialized and rebuilt when the simulation time has drifted by
+    more than the duration over which the universal time dependence of the
+    model is estimated to remain within the tolerance (between 1 minute and 1
+    day). The rebuild takes place during the time step that needs it, which
+    stalls that time step: a fraction of a second for the default range but up
+    to several seconds when the grid extends far above 100,000 ft.
+
     @author David Culp
 */
 
@@ -131,6 +167,9 @@ protected:
   void Calculate(double altitude) override;
   void Compute(double altitude, double& pression, double& temperature,
                 double& density, double &Rair) const;
+  void Evaluate(double doy, double sec, double h, double lat, double lon,
+                double& temperature, double& density, double& Rair) const;
+  void GetEpoch(double time, double& doy, double& sec) const;
 
   double day_of_year = 1.0;
   double seconds_in_day = 0.0;
@@ -138,6 +177,29 @@ protected:
   mutable struct nrlmsise_flags flags;
   mutable struct nrlmsise_input input;
 
+  bool useCache = false;
+  double cacheTolerance = 0.01;
+  double cacheMinAltitude = 0.0;      // km
+  double cacheMaxAltitude = 30.48;    // km
+
+  // Interpolation grid, indexed by altitude (km), latitude (deg) and local
+  // solar time (hours).
+  struct Grid {
+    bool valid = false;
+    double time = 0.0;    // Simulation time at which the grid has been built
+    double window = 0.0;  // Duration of validity of the grid (s)
+    double error = 0.0;   // Interpolation error measured at sampled points
+    unsigned int nAlt = 0, nLat = 0, nLst = 0;
+    double dAlt = 0.0, dLat = 0.0, dLst = 0.0;
+    std::vector<double> T, logRho, R;
+  };
+  mutable Grid cache;
+
+  void UpdateCache(double time) const;
+  void BuildCache(double time) const;
+  void Interpolate(double h, double lat, double lst, double& temperature,
+                   double& density, double& Rair) const;
+
 private:
   // Setting temperature & pressure is not allowed in this model.
   void SetTemperature(double t, double h, eTemperature unit) override {};
@@ -55,6 +55,30 @@ using namespace std;
 
 namespace JSBSim {
 
+namespace {
+  // Returns the index of the layer in which a decreasing quantity (pressure or
+  // density) lies, given its values at the base of the layers. The index of
+  // the previous lookup is checked first.
+  unsigned int FindBreakpoint(const vector<double>& breakpoints, double value,
+                              unsigned int& index)
+  {
+    const unsigned int last = breakpoints.size() - 2;
+    unsigned int b = index;
+
+    if ((b == last || value >= breakpoints[b+1])
+        && (b == 0 || value < breakpoints[b]))
+      return b;
+
+    for (b=0; b < last; b++) {
+      if (value >= breakpoints[b+1])
+        break;
+    }
+
+    index = b;
+    return b;
+  }
+}
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -63,7 +87,8 @@ FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex)
   : FGAtmosphere(fdmex), StdSLpressure(StdDaySLpressure), TemperatureBias(0.0),
     TemperatureDeltaGradient(0.0), VaporMassFraction(0.0),
     SaturatedVaporPressure(StdDaySLpressure), StdAtmosTemperatureTable(9),
-    MaxVaporMassFraction(10)
+    MaxVaporMassFraction(10), LayerIndex(0), PressureAltitudeIndex(0),
+    DensityAltitudeIndex(0)
 {
   Name = "FGStandardAtmosphere";
 
@@ -119,6 +144,13 @@ FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex)
 
   unsigned int numRows = StdAtmosTemperatureTable.GetNumRows();
 
+  for (unsigned int r=1; r <= numRows; ++r) {
+    LayerAltitudes.push_back(StdAtmosTemperatureTable(r, 0));
+    LayerStdTemperatures.push_back(StdAtmosTemperatureTable(r, 1));
+  }
+  BaseTemperatures.resize(numRows-1);
+  PressureExponents.resize(numRows-1);
+
   // Initialize the standard atmosphere lapse rates.
   CalculateLapseRates();
   StdLapseRates = LapseRates;
@@ -139,6 +171,21 @@ FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex)
   CalculateStdDensityBreakpoints();
   StdSLsoundspeed = sqrt(SHRatio*Rdry*StdSLtemperature);
 
+  // The standard profile never changes so the constants used to compute the
+  // standard pressure and to invert the pressure and the density are
+  // computed once for all.
+  for (unsigned int b=0; b < numRows-1; ++b) {
+    double Lmb = StdLapseRates[b];
+    StdBaseTemperatures.push_back(GetStdTemperature(GeometricAltitude(LayerAltitudes[b])));
+    if (Lmb != 0.0) {
+      StdPressureAltitudeExponents.push_back(-Rdry*Lmb / g0);
+      StdDensityAltitudeExponents.push_back(-1.0 / (1.0 + g0/(Rdry*Lmb)));
+    } else {
+      StdPressureAltitudeExponents.push_back(0.0);
+      StdDensityAltitudeExponents.push_back(0.0);
+    }
+  }
+
   bind();
   Debug(0);
 }
@@ -165,6 +212,7 @@ bool FGStandardAtmosphere::InitModel(void)
   LapseRates = StdLapseRates;
 
   PressureBreakpoints = StdPressureBreakpoints;
+  CalculateLayerConstants();
 
   SLpressure    = StdSLpressure;
   SLtemperature = StdSLtemperature;
@@ -195,30 +243,19 @@ double FGStandardAtmosphere::GetPressure(double altitude) const
 {
   double GeoPotAlt = GeopotentialAltitude(altitude);
 
-  // Iterate through the altitudes to find the current Base Altitude
-  // in the table. That is, if the current altitude (the argument passed in)
-  // is 20000 ft, then the base altitude from the table is 0.0. If the
-  // passed-in altitude is 40000 ft, the base altitude is 36089.2388 ft (and
-  // the index "b" is 2 - the second entry in the table).
-  double BaseAlt = StdAtmosTemperatureTable(1,0);
-  unsigned int numRows = StdAtmosTemperatureTable.GetNumRows();
-  unsigned int b;
+  // Find the layer that contains the current altitude. That is, if the current
+  // altitude (the argument passed in) is 20000 ft, then the base altitude from
+  // the table is 0.0. If the passed-in altitude is 40000 ft, the base altitude
+  // is 36089.2388 ft (and the index "b" is 1 - the second entry in the table).
+  unsigned int b = FindLayer(GeoPotAlt);
 
-  for (b=0; b < numRows-2; ++b) {
-    double testAlt = StdAtmosTemperatureTable(b+2,0);
-    if (GeoPotAlt < testAlt)
-      break;
-    BaseAlt = testAlt;
-  }
-
-  double Tmb = GetTemperature(GeometricAltitude(BaseAlt));
-  double deltaH = GeoPotAlt - BaseAlt;
+  double Tmb = BaseTemperatures[b];
+  double deltaH = GeoPotAlt - LayerAltitudes[b];
   double Lmb = LapseRates[b];
 
   if (Lmb != 0.0) {
-    double Exp = g0 / (Rdry*Lmb);
     double factor = Tmb/(Tmb + Lmb*deltaH);
-    return PressureBreakpoints[b]*pow(factor, Exp);
+    return PressureBreakpoints[b]*pow(factor, PressureExponents[b]);
   } else
     return PressureBreakpoints[b]*exp(-g0*deltaH/(Rdry*Tmb));
 }
@@ -252,7 +289,7 @@ double FGStandardAtmosphere::GetTemperature(double altitude) const
   double T;
 
   if (GeoPotAlt >= 0.0) {
-    T = StdAtmosTemperatureTable.GetValue(GeoPotAlt);
+    T = GetTableTemperature(GeoPotAlt);
 
     if (GeoPotAlt <= GradientFadeoutAltitude)
       T -= TemperatureDeltaGradient * GeoPotAlt;
@@ -260,7 +297,7 @@ double FGStandardAtmosphere::GetTemperature(double altitude) const
   else {
     // We don't need to add TemperatureDeltaGradient*GeoPotAlt here because
     // the lapse rate vector already accounts for the temperature gradient.
-    T = StdAtmosTemperatureTable.GetValue(0.0) + GeoPotAlt*LapseRates[0];
+    T = LayerStdTemperatures[0] + GeoPotAlt*LapseRates[0];
   }
 
   T += TemperatureBias;
@@ -279,9 +316,9 @@ double FGStandardAtmosphere::GetStdTemperature(double altitude) const
   double GeoPotAlt = GeopotentialAltitude(altitude);
 
   if (GeoPotAlt >= 0.0)
-    return StdAtmosTemperatureTable.GetValue(GeoPotAlt);
+    return GetTableTemperature(GeoPotAlt);
   else
-    return StdAtmosTemperatureTable.GetValue(0.0) + GeoPotAlt*LapseRates[0];
+    return LayerStdTemperatures[0] + GeoPotAlt*LapseRates[0];
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -289,31 +326,15 @@ double FGStandardAtmosphere::GetStdTemperature(double altitude) const
 double FGStandardAtmosphere::GetStdPressure(double altitude) const
 {
   double GeoPotAlt = GeopotentialAltitude(altitude);
+  unsigned int b = FindLayer(GeoPotAlt);
 
-  // Iterate through the altitudes to find the current Base Altitude
-  // in the table. That is, if the current altitude (the argument passed in)
-  // is 20000 ft, then the base altitude from the table is 0.0. If the
-  // passed-in altitude is 40000 ft, the base altitude is 36089.2388 ft (and
-  // the index "b" is 2 - the second entry in the table).
-  double BaseAlt = StdAtmosTemperatureTable(1,0);
-  unsigned int numRows = StdAtmosTemperatureTable.GetNumRows();
-  unsigned int b;
-
-  for (b=0; b < numRows-2; ++b) {
-    double testAlt = StdAtmosTemperatureTable(b+2,0);
-    if (GeoPotAlt < testAlt)
-      break;
-    BaseAlt = testAlt;
-  }
-
-  double Tmb = GetStdTemperature(GeometricAltitude(BaseAlt));
-  double deltaH = GeoPotAlt - BaseAlt;
+  double Tmb = StdBaseTemperatures[b];
+  double deltaH = GeoPotAlt - LayerAltitudes[b];
   double Lmb = LapseRates[b];
 
   if (Lmb != 0.0) {
-    double Exp = g0 / (Rdry*Lmb);
     double factor = Tmb/(Tmb + Lmb*deltaH);
-    return StdPressureBreakpoints[b]*pow(factor, Exp);
+    return StdPressureBreakpoints[b]*pow(factor, PressureExponents[b]);
   } else
     return StdPressureBreakpoints[b]*exp(-g0*deltaH/(Rdry*Tmb));
 }
@@ -476,6 +497,9 @@ void FGStandardAtmosphere::CalculateLapseRates()
 
 void FGStandardAtmosphere::CalculatePressureBreakpoints(double SLpress)
 {
+  // The layer constants depend on the same parameters as the breakpoints.
+  CalculateLayerConstants();
+
   PressureBreakpoints[0] = SLpress;
 
   for (unsigned int b=0; b<PressureBreakpoints.size()-1; b++) {
@@ -499,6 +523,61 @@ void FGStandardAtmosphere::CalculatePressureBreakpoints(double SLpress)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGStandardAtmosphere::CalculateLayerConstants()
+{
+  for (unsigned int b=0; b < LapseRates.size(); b++) {
+    double Lmb = LapseRates[b];
+    BaseTemperatures[b] = GetTemperature(GeometricAltitude(LayerAltitudes[b]));
+    PressureExponents[b] = Lmb != 0.0 ? g0 / (Rdry*Lmb) : 0.0;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The altitude rarely leaves its layer from one call to the next, so the layer
+// found by the previous call is checked before the table is searched.
+
+unsigned int FGStandardAtmosphere::FindLayer(double GeoPotAlt) const
+{
+  const unsigned int last = LayerAltitudes.size() - 2;
+  unsigned int b = LayerIndex;
+
+  if ((b == last || GeoPotAlt < LayerAltitudes[b+1])
+      && (b == 0 || GeoPotAlt >= LayerAltitudes[b]))
+    return b;
+
+  for (b=0; b < last; ++b) {
+    if (GeoPotAlt < LayerAltitudes[b+1])
+      break;
+  }
+
+  LayerIndex = b;
+  return b;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Same interpolation as FGTable::GetValue() but with the layer lookup above.
+
+double FGStandardAtmosphere::GetTableTemperature(double GeoPotAlt) const
+{
+  const unsigned int last = LayerAltitudes.size() - 1;
+
+  if (GeoPotAlt <= LayerAltitudes[0])
+    return LayerStdTemperatures[0];
+  else if (GeoPotAlt >= LayerAltitudes[last])
+    return LayerStdTemperatures[last];
+
+  unsigned int b = FindLayer(GeoPotAlt);
+  // FGTable interpolates a breakpoint with the layer below it.
+  if (GeoPotAlt == LayerAltitudes[b]) --b;
+
+  double x0 = LayerAltitudes[b];
+  double Factor = (GeoPotAlt - x0) / (LayerAltitudes[b+1] - x0);
+  double y0 = LayerStdTemperatures[b];
+  return Factor*(LayerStdTemperatures[b+1] - y0) + y0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGStandardAtmosphere::ResetSLTemperature()
 {
   TemperatureBias = TemperatureDeltaGradient = 0.0;
@@ -532,15 +611,12 @@ void FGStandardAtmosphere::CalculateStdDensityBreakpoints()
 double FGStandardAtmosphere::CalculateDensityAltitude(double density, double geometricAlt)
 {
   // Work out which layer we're dealing with
-  unsigned int b = 0;
-  for (; b < StdDensityBreakpoints.size() - 2; b++) {
-    if (density >= StdDensityBreakpoints[b + 1])
-      break;
-  }
+  unsigned int b = FindBreakpoint(StdDensityBreakpoints, density,
+                                  DensityAltitudeIndex);
 
   // Get layer properties
-  double Tmb = StdAtmosTemperatureTable(b + 1, 1);
-  double Hb = StdAtmosTemperatureTable(b + 1, 0);
+  double Tmb = LayerStdTemperatures[b];
+  double Hb = LayerAltitudes[b];
   double Lmb = StdLapseRates[b];
   double pb = StdDensityBreakpoints[b];
 
@@ -548,7 +624,7 @@ double FGStandardAtmosphere::CalculateDensityAltitude(double density, double geo
 
   // https://en.wikipedia.org/wiki/Barometric_formula for density solved for H
   if (Lmb != 0.0) {
-    double Exp = -1.0 / (1.0 + g0/(Rdry*Lmb));
+    double Exp = StdDensityAltitudeExponents[b];
     density_altitude = Hb + (Tmb / Lmb) * (pow(density / pb, Exp) - 1);
   } else {
     double Factor = -Rdry*Tmb / g0;
@@ -563,15 +639,12 @@ double FGStandardAtmosphere::CalculateDensityAltitude(double density, double geo
 double FGStandardAtmosphere::CalculatePressureAltitude(double pressure, double geometricAlt)
 {
   // Work out which layer we're dealing with
-  unsigned int b = 0;
-  for (; b < StdPressureBreakpoints.size() - 2; b++) {
-    if (pressure >= StdPressureBreakpoints[b + 1])
-      break;
-  }
+  unsigned int b = FindBreakpoint(StdPressureBreakpoints, pressure,
+                                  PressureAltitudeIndex);
 
   // Get layer properties
-  double Tmb = StdAtmosTemperatureTable(b + 1, 1);
-  double Hb = StdAtmosTemperatureTable(b + 1, 0);
+  double Tmb = LayerStdTemperatures[b];
+  double Hb = LayerAltitudes[b];
   double Lmb = StdLapseRates[b];
   double Pb = StdPressureBreakpoints[b];
 
@@ -579,7 +652,7 @@ double FGStandardAtmosphere::CalculatePressureAltitude(double pressure, double g
 
   if (Lmb != 0.00) {
     // Equation 33(a) from ISA document solved for H
-    double Exp = -Rdry*Lmb / g0;
+    double Exp = StdPressureAltitudeExponents[b];
     pressure_altitude = Hb + (Tmb / Lmb) * (pow(pressure / Pb, Exp) - 1);
   } else {
     // Equation 33(b) from ISA document solved for H
@@ -83,6 +83,13 @@ these access methods allow the user to modify the sea level standard
 temperature, and/or the sea level standard pressure, so that the entire profile
 will be consistently and accurately calculated.
 
+The quantities that only depend on the layers of the temperature table (the
+base temperature of each layer and the exponents of the barometric formulas)
+are computed once, when the temperature profile is modified, rather than at
+each evaluation. The index of the last layer that was looked up is kept so
+that the layer is found immediately when the altitude stays within the same
+layer from one call to the next, which is the case in a simulation.
+
   <h2> Properties </h2>
   @property atmosphere/delta-T
   @property atmosphere/T-sl-dev-F
@@ -299,6 +306,21 @@ protected:
   std::vector<double> StdDensityBreakpoints;
   std::vector<double> StdLapseRates;
 
+  /// Geopotential altitudes and standard temperatures at the base of the layers
+  std::vector<double> LayerAltitudes;
+  std::vector<double> LayerStdTemperatures;
+  /// Modeled and standard temperatures at the base of the layers
+  std::vector<double> BaseTemperatures;
+  std::vector<double> StdBaseTemperatures;
+  /// Exponents of the barometric formulas
+  std::vector<double> PressureExponents;
+  std::vector<double> StdPressureAltitudeExponents;
+  std::vector<double> StdDensityAltitudeExponents;
+  /// Indices of the layers found by the last lookups
+  mutable unsigned int LayerIndex;
+  unsigned int PressureAltitudeIndex;
+  unsigned int DensityAltitudeIndex;
+
   void Calculate(double altitude) override;
 
   /// Recalculate the lapse rate vectors when the temperature profile is altered
@@ -315,6 +337,16 @@ protected:
   /// altitudes in the standard temperature table.
   void CalculateStdDensityBreakpoints();
 
+  /// Calculate the base temperatures and the pressure exponents of the layers
+  /// from the current temperature profile.
+  void CalculateLayerConstants();
+
+  /// Returns the index of the layer that contains a geopotential altitude.
+  unsigned int FindLayer(double GeoPotAlt) const;
+
+  /// Interpolates the standard temperature table at a geopotential altitude.
+  double GetTableTemperature(double GeoPotAlt) const;
+
   /// Convert a geometric altitude to a geopotential altitude
   double GeopotentialAltitude(double geometalt) const { return (geometalt * EarthRadius) / (EarthRadius + geometalt); }
 
@@ -73,7 +73,7 @@ static inline double square_signed (double value)
 constexpr double sqr(double x) { return x*x; }
 
 FGWinds::FGWinds(FGFDMExec* fdmex)
-  : FGModel(fdmex), generator(fdmex->GetRandomGenerator())
+  : FGModel(fdmex), generator(fdmex->GetRandomGenerator("atmosphere/winds"))
 {
   Name = "FGWinds";
 
@@ -492,7 +492,8 @@ void FGWinds::UpDownBurst()
 void FGWinds::SetRandomSeed(int sr)
 {
   RandomSeed = sr;
-  generator = std::make_shared<RandomNumberGenerator>(*RandomSeed);
+  generator = std::make_shared<RandomNumberGenerator>(*RandomSeed,
+                                                      generator->GetStream());
 }
 
 int  FGWinds::GetRandomSeed(void) const {
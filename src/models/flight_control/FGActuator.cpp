@@ -146,6 +146,16 @@ bool FGActuator::Run(void )
 {
   Input = InputNodes[0]->getDoubleValue();
 
+  Process();
+  SetOutput();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGActuator::Process(void)
+{
   if( fcs->GetTrimStatus() ) initialized = 0;
 
   if (fail_zero) Input = 0;
@@ -187,10 +197,6 @@ bool FGActuator::Run(void )
         saturated = true;
     }
   }
-
-  SetOutput();
-
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
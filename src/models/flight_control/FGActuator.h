@@ -173,6 +173,10 @@ private:
   bool initialized;
   bool saturated;
 
+  friend class FGFCSPlan;
+
+  /// Computes the output from Input, also used by the FCS execution plans.
+  void Process(void);
   void Hysteresis(void);
   void Lag(void);
   void RateLimit(void);
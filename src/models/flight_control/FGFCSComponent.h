@@ -114,6 +114,8 @@ protected:
   double dt;
   bool clip, cyclic_clip;
 
+  friend class FGFCSPlan;
+
   void Delay(void);
   void Clip(void);
   void CheckInputNodes(size_t MinNodes, size_t MaxNodes, Element* el);
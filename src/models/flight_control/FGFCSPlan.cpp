@@ -0,0 +1,364 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGFCSPlan.cpp
+ Author:       The JSBSim team
+ Date started: 10/18/26
+ Purpose:      Flattened execution of the components of a channel
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <map>
+
+#include "FGFCSPlan.h"
+#include "FGActuator.h"
+#include "FGFilter.h"
+#include "FGGain.h"
+#include "FGSummer.h"
+#include "models/FGFCS.h"
+#include "input_output/FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static SGPropertyNode* GetTarget(SGPropertyNode* node)
+{
+  while (node->isAlias()) node = node->getAliasTarget();
+  return node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// The property nodes are not modified while a sequence of operations is
+// executed (a segment): the outputs are kept in their slots until the end of
+// the segment, and an input is read from the slot of the operation which last
+// wrote it in the segment or, failing that, from its property node which can
+// be read at any time in the segment. A segment is ended by a component which
+// is executed by its Run() method since it accesses the property tree directly,
+// and by an operation writing to a property whose setting may have side
+// effects.
+
+FGFCSPlan::FGFCSPlan(FGFCS* _fcs, const vector<FGFCSComponent*>& components)
+  : fcs(_fcs), NumCompiled(0)
+{
+  map<SGPropertyNode*, unsigned int> nodeSlots; // Slots reading the nodes
+  map<SGPropertyNode*, unsigned int> written;   // Outputs of the segment
+  map<SGPropertyNode*, bool> loaded;            // Nodes read in the segment
+  vector<Transfer> stores;
+
+  auto EndSegment = [&]() {
+    if (!stores.empty()) {
+      Operations.push_back({eStore, 0, (unsigned int)Transfers.size(),
+                            (unsigned int)stores.size(), nullptr, 0.0,
+                            false});
+      Transfers.insert(Transfers.end(), stores.begin(), stores.end());
+      stores.clear();
+    }
+    written.clear();
+    loaded.clear();
+  };
+
+  for (auto component: components) {
+    OpCode code;
+
+    if (!Compile(component, code)) {
+      EndSegment();
+      Operations.push_back({eComponent, 0, 0, 0, component, 0.0, false});
+      continue;
+    }
+
+    Operation op {code, 0, (unsigned int)Inputs.size(),
+                  (unsigned int)component->InputNodes.size(), component, 0.0,
+                  false};
+    vector<Transfer> loads;
+
+    for (auto& value: component->InputNodes) {
+      SGPropertyNode* node = GetTarget(value->GetNode());
+      auto source = written.find(node);
+
+      if (source != written.end())
+        Inputs.push_back({source->second, value->GetSign()});
+      else {
+        auto slot = nodeSlots.find(node);
+        if (slot == nodeSlots.end()) {
+          slot = nodeSlots.emplace(node, Slots.size()).first;
+          Slots.push_back(0.0);
+        }
+        if (!loaded[node]) {
+          loaded[node] = true;
+          loads.push_back({node, slot->second});
+        }
+        Inputs.push_back({slot->second, value->GetSign()});
+      }
+    }
+
+    if (!loads.empty()) {
+      Operations.push_back({eLoad, 0, (unsigned int)Transfers.size(),
+                            (unsigned int)loads.size(), nullptr, 0.0,
+                            false});
+      Transfers.insert(Transfers.end(), loads.begin(), loads.end());
+    }
+
+    if (code == eGain)
+      op.gain = static_cast<FGGain*>(component)->Gain->GetValue();
+
+    op.result = Slots.size();
+    Slots.push_back(component->GetOutput());
+    Operations.push_back(op);
+    NumCompiled++;
+
+    bool side_effects = false;
+    for (auto& output: component->OutputNodes) {
+      SGPropertyNode* node = GetTarget(output);
+      written[node] = op.result;
+      side_effects |= node->isTied() || node->nListeners() > 0;
+
+      bool stored = false;
+      for (auto& store: stores) {
+        if (store.node == node) {
+          store.slot = op.result;
+          stored = true;
+        }
+      }
+      if (!stored) stores.push_back({node, op.result});
+    }
+
+    if (side_effects) EndSegment();
+  }
+
+  EndSegment();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFCSPlan::IsBound(FGPropertyValue* value) const
+{
+  return !value->IsLateBound()
+    || fcs->GetPropertyManager()->HasNode(value->GetName());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// The components are translated when all the parameters that they read in
+// the middle of their execution are constant: these parameters would otherwise
+// be read from the property tree which is not up to date in a segment.
+
+bool FGFCSPlan::Compile(FGFCSComponent* component, OpCode& code) const
+{
+  for (auto& value: component->InputNodes)
+    if (!IsBound(value)) return false;
+
+  if (component->clip && !(component->ClipMin->IsConstant()
+                           && component->ClipMax->IsConstant()))
+    return false;
+
+  if (auto gain = dynamic_cast<FGGain*>(component)) {
+    if (!gain->Gain->IsConstant()) return false;
+
+    if (gain->Type != "PURE_GAIN" && gain->Type != "AEROSURFACE_SCALE")
+      return false;
+
+    code = eGain;
+    return true;
+  }
+
+  if (dynamic_cast<FGSummer*>(component)) {
+    code = eSummer;
+    return true;
+  }
+
+  if (auto filter = dynamic_cast<FGFilter*>(component)) {
+    if (filter->DynamicFilter || filter->FilterType == FGFilter::eUnknown)
+      return false;
+
+    code = eFilter;
+    return true;
+  }
+
+  if (auto actuator = dynamic_cast<FGActuator*>(component)) {
+    // The clipping limits are also used by the hardover failure.
+    if (!actuator->ClipMin || !actuator->ClipMin->IsConstant()
+        || !actuator->ClipMax || !actuator->ClipMax->IsConstant())
+      return false;
+    if (actuator->lag && !actuator->lag->IsConstant()) return false;
+    if (actuator->rate_limit_incr && !actuator->rate_limit_incr->IsConstant())
+      return false;
+    if (actuator->rate_limit_decr && !actuator->rate_limit_decr->IsConstant())
+      return false;
+
+    code = eActuator;
+    return true;
+  }
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// Reproduces the Run() method of the components, the inputs being read from
+// the slots and the output written to its slot.
+
+void FGFCSPlan::Evaluate(const Operation& op)
+{
+  FGFCSComponent* c = op.component;
+
+  switch (op.code) {
+  case eGain:
+    c->Input = GetInput(op.first);
+    static_cast<FGGain*>(c)->Process(op.gain);
+    break;
+  case eSummer:
+  {
+    double sum = 0.0;
+    for (unsigned int i=op.first; i<op.first+op.count; i++)
+      sum += GetInput(i);
+    static_cast<FGSummer*>(c)->Process(sum);
+  }
+    break;
+  case eFilter:
+  {
+    FGFilter* filter = static_cast<FGFilter*>(c);
+    if (!filter->Initialize) c->Input = GetInput(op.first);
+    filter->Process();
+  }
+    break;
+  case eActuator:
+    c->Input = GetInput(op.first);
+    static_cast<FGActuator*>(c)->Process();
+    break;
+  default:
+    break;
+  }
+
+  Slots[op.result] = c->Output;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPlan::Execute(void)
+{
+  for (const auto& op: Operations) {
+    switch (op.code) {
+    case eLoad:
+      for (unsigned int i=op.first; i<op.first+op.count; i++)
+        Slots[Transfers[i].slot] = Transfers[i].node->getDoubleValue();
+      break;
+    case eStore:
+      for (unsigned int i=op.first; i<op.first+op.count; i++)
+        Transfers[i].node->setDoubleValue(Slots[Transfers[i].slot]);
+      break;
+    case eComponent:
+      op.component->Run();
+      break;
+    default:
+      Evaluate(op);
+      break;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// The components are executed as if there was no plan and write their outputs
+// to the property tree. The stateless operations are evaluated before the
+// component and their result compared with its output. The operations having
+// a state (filters and actuators) share it with their component so only their
+// input is compared: the computation is done by the same code.
+
+unsigned int FGFCSPlan::Verify(void)
+{
+  unsigned int mismatches = 0;
+
+  for (auto& op: Operations) {
+    FGFCSComponent* c = op.component;
+
+    switch (op.code) {
+    case eLoad:
+      for (unsigned int i=op.first; i<op.first+op.count; i++)
+        Slots[Transfers[i].slot] = Transfers[i].node->getDoubleValue();
+      break;
+    case eStore:
+      break;
+    case eComponent:
+      c->Run();
+      break;
+    case eFilter:
+    case eActuator:
+    {
+      double input = GetInput(op.first);
+      bool initialize = op.code == eFilter
+                        && static_cast<FGFilter*>(c)->Initialize;
+      if (!initialize) {
+        double expected = c->InputNodes[0]->GetValue();
+        if (input != expected && !(std::isnan(input) && std::isnan(expected))) {
+          Report(op, input, expected);
+          mismatches++;
+        }
+      }
+      c->Run();
+      Slots[op.result] = c->Output;
+    }
+      break;
+    default:
+    {
+      Evaluate(op);
+      double result = Slots[op.result];
+      c->Run();
+      Slots[op.result] = c->Output;
+      if (result != c->Output && !(std::isnan(result) && std::isnan(c->Output))) {
+        Report(op, result, c->Output);
+        mismatches++;
+      }
+    }
+      break;
+    }
+  }
+
+  return mismatches;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSPlan::Report(Operation& op, double plan, double component)
+{
+  if (op.reported) return;
+
+  op.reported = true;
+  FGLogging log(fcs->GetExec()->GetLogger(), LogLevel::WARN);
+  log << "The FCS plan differs from the component \""
+      << op.component->GetName() << "\" of type " << op.component->GetType()
+      << ": " << setprecision(17) << plan << " instead of " << component
+      << "\n";
+}
+
+}
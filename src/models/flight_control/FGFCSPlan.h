@@ -0,0 +1,157 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGFCSPlan.h
+ Author:       The JSBSim team
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGFCSPLAN_H
+#define FGFCSPLAN_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+
+#include "FGJSBBase.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class SGPropertyNode;
+
+namespace JSBSim {
+
+class FGFCS;
+class FGFCSComponent;
+class FGPropertyValue;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Flattened execution of the components of a channel.
+
+    The components of a channel exchange their values through the property
+    tree: each component reads its inputs from property nodes and writes its
+    output to property nodes. An execution plan translates the components of a
+    channel into a contiguous list of operations which exchange their values
+    through an array of slots, so that the output of a component is passed to
+    the components that follow without a round trip in the property tree.
+
+    The pure gains and aerosurface scales with a constant gain, the summers,
+    the filters with constant coefficients and the actuators with constant
+    lag and rate limits are translated to operations, provided that their
+    clipping limits are constant. The other components are executed by their
+    Run() method. The property nodes are read before the operation that needs
+    them and are written at the end of the channel, before a component that is
+    executed by its Run() method and after an operation which outputs to a
+    tied property or to a property that has listeners.
+
+    The plan can also be executed side by side with the components (see
+    Verify()) to check that both executions give the same results.
+
+    @see FGFCSChannel
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGFCSPlan : public FGJSBBase
+{
+public:
+  /** Constructor. The plan must be built after the properties read by the
+      components have been created.
+      @param fcs a pointer to the parent FGFCS object.
+      @param components the components of the channel in execution order. */
+  FGFCSPlan(FGFCS* fcs, const std::vector<FGFCSComponent*>& components);
+
+  /// Executes the components of the channel.
+  void Execute(void);
+
+  /** Executes the components of the channel by their Run() method and
+      compares their outputs with the results of the plan. The first mismatch
+      of each operation is logged.
+      @return the number of mismatches */
+  unsigned int Verify(void);
+
+  /// Returns the number of components translated to operations.
+  size_t GetNumCompiled(void) const { return NumCompiled; }
+  /// Returns the number of operations, property transfers included.
+  size_t GetNumOperations(void) const { return Operations.size(); }
+  /// Returns the number of slots.
+  size_t GetNumSlots(void) const { return Slots.size(); }
+
+private:
+  enum OpCode {eLoad, eStore, eGain, eSummer, eFilter, eActuator,
+               eComponent};
+
+  struct Operation {
+    OpCode code;
+    /// The slot receiving the output of the component.
+    unsigned int result;
+    /// Range of the inputs, or of the transfers for eLoad and eStore.
+    unsigned int first, count;
+    FGFCSComponent* component;
+    double gain;
+    bool reported;
+  };
+
+  struct Input {
+    unsigned int slot;
+    double sign;
+  };
+
+  struct Transfer {
+    SGPropertyNode* node;
+    unsigned int slot;
+  };
+
+  FGFCS* fcs;
+  std::vector<Operation> Operations;
+  std::vector<Input> Inputs;
+  std::vector<Transfer> Transfers;
+  std::vector<double> Slots;
+  size_t NumCompiled;
+
+  bool Compile(FGFCSComponent* component, OpCode& code) const;
+  bool IsBound(FGPropertyValue* value) const;
+  double GetInput(unsigned int i) const {
+    return Slots[Inputs[i].slot] * Inputs[i].sign;
+  }
+  void Evaluate(const Operation& op);
+  void Report(Operation& op, double plan, double component);
+};
+
+} //namespace JSBSim
+
+#endif
@@ -152,6 +152,18 @@ void FGFilter::CalculateDynamicFilters(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGFilter::Run(void)
+{
+  if (!Initialize) Input = InputNodes[0]->getDoubleValue();
+
+  Process();
+  SetOutput();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFilter::Process(void)
 {
   if (Initialize) {
 
@@ -160,8 +172,6 @@ bool FGFilter::Run(void)
 
   } else {
 
-    Input = InputNodes[0]->getDoubleValue();
-
     if (DynamicFilter) CalculateDynamicFilters();
 
     switch (FilterType) {
@@ -190,9 +200,6 @@ bool FGFilter::Run(void)
   PreviousInput1  = Input;
 
   Clip();
-  SetOutput();
-
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
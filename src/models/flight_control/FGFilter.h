@@ -234,6 +234,10 @@ private:
 
   enum {eLag, eLeadLag, eOrder2, eWashout, eUnknown} FilterType;
 
+  friend class FGFCSPlan;
+
+  /// Computes the output from Input, also used by the FCS execution plans.
+  void Process(void);
   void CalculateDynamicFilters(void);
   void ReadFilterCoefficients(Element* el, int index,
                               std::shared_ptr<FGPropertyManager> pm);
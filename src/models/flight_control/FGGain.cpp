@@ -141,14 +141,24 @@ bool FGGain::Run(void )
 {
   Input = InputNodes[0]->getDoubleValue();
 
+  Process(Gain->GetValue());
+  SetOutput();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGain::Process(double gain)
+{
   if (Type == "PURE_GAIN") {                       // PURE_GAIN
 
-    Output = Gain * Input;
+    Output = gain * Input;
 
   } else if (Type == "SCHEDULED_GAIN") {           // SCHEDULED_GAIN
 
     double SchedGain = Table->GetValue();
-    Output = Gain * SchedGain * Input;
+    Output = gain * SchedGain * Input;
 
   } else if (Type == "AEROSURFACE_SCALE") {        // AEROSURFACE_SCALE
 
@@ -164,13 +174,10 @@ bool FGGain::Run(void )
       Output = OutMin + ((Input - InMin) / (InMax - InMin)) * (OutMax - OutMin);
     }
 
-    Output *= Gain->GetValue();
+    Output *= gain;
   }
 
   Clip();
-  SetOutput();
-
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
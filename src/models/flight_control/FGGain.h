@@ -228,6 +228,10 @@ private:
   double InMin, InMax, OutMin, OutMax;
   bool ZeroCentered;
 
+  friend class FGFCSPlan;
+
+  /// Computes the output from Input, also used by the FCS execution plans.
+  void Process(double gain);
   void Debug(int from) override;
 };
 }
@@ -52,8 +52,12 @@ CLASS IMPLEMENTATION
 
 
 FGSensor::FGSensor(FGFCS* fcs, Element* element)
-  : FGFCSComponent(fcs, element), generator(fcs->GetExec()->GetRandomGenerator())
+  : FGFCSComponent(fcs, element)
 {
+  // Each sensor draws its noise from its own stream so that adding a sensor
+  // does not modify the noise of the others.
+  generator = fcs->GetExec()->GetRandomGenerator("sensor/" + Name);
+
   // inputs are read from the base class constructor
 
   bits = quantized = divisions = 0;
@@ -289,7 +293,8 @@ void FGSensor::bind(Element* el, FGPropertyManager* PropertyManager)
 void FGSensor::SetNoiseRandomSeed(int sr)
 {
   RandomSeed = sr;
-  generator = std::make_shared<RandomNumberGenerator>(*RandomSeed);
+  generator = std::make_shared<RandomNumberGenerator>(*RandomSeed,
+                                                      generator->GetStream());
 }
 
 int FGSensor::GetNoiseRandomSeed(void) const
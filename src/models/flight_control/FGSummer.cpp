@@ -72,19 +72,26 @@ FGSummer::~FGSummer()
 
 bool FGSummer::Run(void)
 {
-  Output = 0.0;
+  double sum = 0.0;
 
   for (auto node: InputNodes)
-    Output += node->getDoubleValue();
+    sum += node->getDoubleValue();
 
-  Output += Bias;
-
-  Clip();
+  Process(sum);
   SetOutput();
 
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSummer::Process(double sum)
+{
+  Output = sum + Bias;
+
+  Clip();
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
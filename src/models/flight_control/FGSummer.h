@@ -114,6 +114,12 @@ public:
 
 private:
   double Bias;
+
+  friend class FGFCSPlan;
+
+  /// Computes the output from the sum of the inputs, also used by the FCS
+  /// execution plans.
+  void Process(double sum);
   void Debug(int from) override;
 };
 }
@@ -66,6 +66,7 @@ FGWaypoint::FGWaypoint(FGFCS* fcs, Element* element)
   source_latitude_unit = 1.0;
   source_longitude_unit = 1.0;
   source = fcs->GetExec()->GetIC()->GetPosition();
+  Inertial = fcs->GetExec()->GetInertial();
 
   auto PropertyManager = fcs->GetPropertyManager();
 
@@ -190,17 +191,21 @@ bool FGWaypoint::Run(void )
     throw err;
   }
 
+  const GeographicLib::Geodesic& geod = Inertial->GetGeodesic();
+
   if (WaypointType == eHeading) {     // Calculate Heading
 
-    double heading_to_waypoint_rad = source.GetHeadingTo(target_longitude_rad,
-                                                         target_latitude_rad);
+    double wp_distance, heading_to_waypoint_rad;
+    source.GetDistanceAndHeadingTo(geod, target_longitude_rad,
+                                   target_latitude_rad, wp_distance,
+                                   heading_to_waypoint_rad);
 
     if (eUnit == eDeg) Output = heading_to_waypoint_rad * radtodeg;
     else               Output = heading_to_waypoint_rad;
 
   } else {                            // Calculate Distance
 
-    double wp_distance = source.GetDistanceTo(target_longitude_rad,
+    double wp_distance = source.GetDistanceTo(geod, target_longitude_rad,
                                               target_latitude_rad);
     if (eUnit == eMeters) Output = FeetToMeters(wp_distance);
     else                  Output = wp_distance;
@@ -49,6 +49,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGFCS;
+class FGInertial;
 class Element;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -104,6 +105,7 @@ public:
 
 private:
   FGLocation source;
+  std::shared_ptr<FGInertial> Inertial;
   std::unique_ptr<FGPropertyValue> target_latitude;
   std::unique_ptr<FGPropertyValue> target_longitude;
   std::unique_ptr<FGPropertyValue> source_latitude;
@@ -170,14 +170,10 @@ string FGBrushLessDCMotor::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGBrushLessDCMotor::GetEngineValues(const string& delimiter)
+void FGBrushLessDCMotor::GetEngineValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  buf << HP << delimiter
-     << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  values.push_back({[this]() { return HP; }, 6});
+  Thruster->GetThrusterValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -90,7 +90,7 @@ public:
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void) { return 0.; }
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValueSources(std::vector<FGOutputValue>& values);
 
 private:
   double ZeroTorqueCurrent; // Zero torque current [A]
@@ -126,14 +126,10 @@ string FGElectric::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGElectric::GetEngineValues(const string& delimiter)
+void FGElectric::GetEngineValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  buf << HP << delimiter
-     << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  values.push_back({[this]() { return HP; }, 6});
+  Thruster->GetThrusterValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
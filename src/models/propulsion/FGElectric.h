@@ -76,7 +76,7 @@ public:
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double getRPM(void) {return RPM;}
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValueSources(std::vector<FGOutputValue>& values);
 
 private:
 
@@ -132,6 +132,17 @@ const FGColumnVector3& FGEngine::GetMoments(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+string FGEngine::GetEngineValues(const string& delimiter)
+{
+  vector<FGOutputValue> values;
+
+  GetEngineValueSources(values);
+
+  return FormatValues(values, delimiter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGEngine::LoadThrusterInputs()
 {
   Thruster->in.TotalDeltaT     = in.TotalDeltaT;
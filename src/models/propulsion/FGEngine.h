@@ -192,7 +192,11 @@ public:
   size_t GetNumSourceTanks() const {return SourceTanks.size();}
 
   virtual std::string GetEngineLabels(const std::string& delimiter) = 0;
-  virtual std::string GetEngineValues(const std::string& delimiter) = 0;
+  virtual std::string GetEngineValues(const std::string& delimiter);
+  /** Gets the sources of the values returned by GetEngineValues().
+      @param values the list to which the sources are appended, the values of
+                    the thruster included */
+  virtual void GetEngineValueSources(std::vector<FGOutputValue>& values) = 0;
 
   struct Inputs& in;
   void LoadThrusterInputs();
@@ -84,7 +84,6 @@ public:
 
   double Calculate(double vacThrust);
   std::string GetThrusterLabels(int id, const std::string& delimeter);
-  std::string GetThrusterValues(int id, const std::string& delimeter);
 
 private:
 //  double PE;
@@ -984,15 +984,13 @@ string FGPiston::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGPiston::GetEngineValues(const string& delimiter)
+void FGPiston::GetEngineValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  buf << (HP * hptoftlbssec) << delimiter << HP << delimiter
-      << equivalence_ratio << delimiter << ManifoldPressure_inHg << delimiter
-      << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  values.push_back({[this]() { return HP * hptoftlbssec; }, 6});
+  values.push_back({[this]() { return HP; }, 6});
+  values.push_back({[this]() { return equivalence_ratio; }, 6});
+  values.push_back({[this]() { return ManifoldPressure_inHg; }, 6});
+  Thruster->GetThrusterValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -229,7 +229,7 @@ public:
   ~FGPiston();
 
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValueSources(std::vector<FGOutputValue>& values);
 
   void Calculate(void);
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
@@ -217,7 +217,7 @@ double FGPropeller::Calculate(double EnginePower)
   // Simualtion (3rd edition)" eqn 8.2-1
   // Variables in.AeroUVW and in.AeroPQR include the wind and turbulence effects
   // as computed by FGAuxiliary.
-  FGColumnVector3 localAeroVel = mT.Transposed() * (in.AeroUVW + in.AeroPQR*vDXYZ);
+  FGColumnVector3 localAeroVel = mT.TransposedMultiply(in.AeroUVW + in.AeroPQR*vDXYZ);
   double omega, PowerAvailable;
 
   double Vel = localAeroVel(eU);
@@ -403,20 +403,15 @@ string FGPropeller::GetThrusterLabels(int id, const string& delimeter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGPropeller::GetThrusterValues(int id, const string& delimeter)
+void FGPropeller::GetThrusterValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  FGColumnVector3 vPFactor = GetPFactor();
-  buf << vTorque(eX) << delimeter
-      << vPFactor(ePitch) << delimeter
-      << vPFactor(eYaw) << delimeter
-      << Thrust << delimeter;
+  values.push_back({[this]() { return vTorque(eX); }, 6});
+  values.push_back({[this]() { return GetPFactor()(ePitch); }, 6});
+  values.push_back({[this]() { return GetPFactor()(eYaw); }, 6});
+  values.push_back({[this]() { return Thrust; }, 6});
   if (IsVPitch())
-    buf << Pitch << delimeter;
-  buf << RPM;
-
-  return buf.str();
+    values.push_back({[this]() { return Pitch; }, 6});
+  values.push_back({[this]() { return RPM; }, 6});
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -281,8 +281,8 @@ public:
   FGColumnVector3 GetPFactor(void) const;
   /// Generate the labels for the thruster standard CSV output
   std::string GetThrusterLabels(int id, const std::string& delimeter);
-  /// Generate the values for the thruster standard CSV output
-  std::string GetThrusterValues(int id, const std::string& delimeter);
+  /// Generate the sources of the values for the thruster standard CSV output
+  void GetThrusterValueSources(std::vector<FGOutputValue>& values);
   /** Set the propeller reverse pitch.
       @param c the reverse pitch command in percent (0.0 - 1.0)
   */
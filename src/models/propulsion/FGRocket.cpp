@@ -264,17 +264,15 @@ string FGRocket::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGRocket::GetEngineValues(const string& delimiter)
+void FGRocket::GetEngineValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  buf << It << delimiter 
-      << ItVac << delimiter 
-      << GetMoments().Dump(delimiter) << delimiter
-      << Thruster->GetBodyForces().Dump(delimiter) << delimiter
-      << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  values.push_back({[this]() { return It; }, 6});
+  values.push_back({[this]() { return ItVac; }, 6});
+  for (int i=eL; i<=eN; i++)
+    values.push_back({[this, i]() { return GetMoments()(i); }, 16});
+  for (int i=eX; i<=eZ; i++)
+    values.push_back({[this, i]() { return Thruster->GetBodyForces()(i); }, 16});
+  Thruster->GetThrusterValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
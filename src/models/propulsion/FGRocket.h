@@ -174,7 +174,7 @@ public:
   void SetIsp(double isp) {Isp = isp;}
 
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValueSources(std::vector<FGOutputValue>& values);
 
   /** Sets the thrust variation for a solid rocket engine. 
       Solid propellant rocket motor thrust characteristics are typically
@@ -52,6 +52,7 @@ INCLUDES
 
 using std::string;
 using std::ostringstream;
+using std::vector;
 
 namespace JSBSim {
 
@@ -804,15 +805,9 @@ string FGRotor::GetThrusterLabels(int id, const string& delimeter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGRotor::GetThrusterValues(int id, const string& delimeter)
+void FGRotor::GetThrusterValueSources(vector<FGOutputValue>& values)
 {
-
-  ostringstream buf;
-
-  buf << RPM;
-
-  return buf.str();
-
+  values.push_back({[this]() { return RPM; }, 6});
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
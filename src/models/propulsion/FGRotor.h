@@ -312,7 +312,7 @@ public:
 
   // Stubs. Only main rotor RPM is returned
   std::string GetThrusterLabels(int id, const std::string& delimeter);
-  std::string GetThrusterValues(int id, const std::string& delimeter);
+  void GetThrusterValueSources(std::vector<FGOutputValue>& values);
 
 private:
 
@@ -162,11 +162,18 @@ string FGThruster::GetThrusterLabels(int id, const string& delimeter)
 
 string FGThruster::GetThrusterValues(int id, const string& delimeter)
 {
-  std::ostringstream buf;
+  vector<FGOutputValue> values;
 
-  buf << Thrust;
+  GetThrusterValueSources(values);
 
-  return buf.str();
+  return FormatValues(values, delimeter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThruster::GetThrusterValueSources(vector<FGOutputValue>& values)
+{
+  values.push_back({[this]() { return Thrust; }, 6});
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
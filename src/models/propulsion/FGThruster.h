@@ -40,6 +40,7 @@ INCLUDES
 
 #include "FGForce.h"
 #include "math/FGColumnVector3.h"
+#include "input_output/FGOutputValue.h"
 #include <string>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -103,6 +104,9 @@ public:
   double GetGearRatio(void) {return GearRatio; }
   virtual std::string GetThrusterLabels(int id, const std::string& delimeter);
   virtual std::string GetThrusterValues(int id, const std::string& delimeter);
+  /** Gets the sources of the values returned by GetThrusterValues().
+      @param values the list to which the sources are appended */
+  virtual void GetThrusterValueSources(std::vector<FGOutputValue>& values);
 
   virtual void ResetToIC(void);
 
@@ -548,15 +548,11 @@ string FGTurbine::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGTurbine::GetEngineValues(const string& delimiter)
+void FGTurbine::GetEngineValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  buf << N1 << delimiter
-      << N2 << delimiter
-      << Thruster->GetThrusterValues(EngineNumber, delimiter);
-
-  return buf.str();
+  values.push_back({[this]() { return N1; }, 6});
+  values.push_back({[this]() { return N2; }, 6});
+  Thruster->GetThrusterValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -238,7 +238,7 @@ public:
   void ResetToIC(void);
 
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValueSources(std::vector<FGOutputValue>& values);
 
 private:
 
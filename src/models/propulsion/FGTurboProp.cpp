@@ -503,15 +503,11 @@ string FGTurboProp::GetEngineLabels(const string& delimiter)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-string FGTurboProp::GetEngineValues(const string& delimiter)
+void FGTurboProp::GetEngineValueSources(vector<FGOutputValue>& values)
 {
-  std::ostringstream buf;
-
-  buf << N1 << delimiter
-      << HP << delimiter
-      << Thruster->GetThrusterValues(EngineNumber,delimiter);
-
-  return buf.str();
+  values.push_back({[this]() { return N1; }, 6});
+  values.push_back({[this]() { return HP; }, 6});
+  Thruster->GetThrusterValueSources(values);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -134,7 +134,7 @@ public:
   inline void SetCondition(bool c) { Condition=c; }
   int InitRunning(void);
   std::string GetEngineLabels(const std::string& delimiter);
-  std::string GetEngineValues(const std::string& delimiter);
+  void GetEngineValueSources(std::vector<FGOutputValue>& values);
 
 private:
 
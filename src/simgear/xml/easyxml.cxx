@@ -251,7 +251,8 @@ static void processing_instruction (void * userData,
 // Implementation of XMLReader.
 ////////////////////////////////////////////////////////////////////////
 
-void readXML (istream &input, XMLVisitor &visitor, const string &path)
+void readXML (istream &input, XMLVisitor &visitor, const string &path,
+              bool verbose)
 {
   XML_Parser parser = XML_ParserCreate(0);
   XML_SetUserData(parser, &visitor);
@@ -271,7 +272,7 @@ void readXML (istream &input, XMLVisitor &visitor, const string &path)
       s << "Problem reading input file " << path << endl;
       visitor.setParser(0);
       XML_ParserFree(parser);
-      cerr << endl << s.str() << endl;
+      if (verbose) cerr << endl << s.str() << endl;
       throw JSBSim::BaseException(s.str());
     }
 
@@ -280,7 +281,7 @@ void readXML (istream &input, XMLVisitor &visitor, const string &path)
       std::stringstream s;
       s << "In file " << path << ": line " << XML_GetCurrentLineNumber(parser) << endl
         << "XML parse error: " << XML_ErrorString(XML_GetErrorCode(parser));
-      cerr << endl << s.str() << endl;
+      if (verbose) cerr << endl << s.str() << endl;
       visitor.setParser(0);
       XML_ParserFree(parser);
       throw JSBSim::BaseException(s.str());
@@ -293,7 +294,7 @@ void readXML (istream &input, XMLVisitor &visitor, const string &path)
     std::stringstream s;
     s << "In file " << path << ": line " << XML_GetCurrentLineNumber(parser) << endl
       << "XML parse error: " << XML_ErrorString(XML_GetErrorCode(parser));
-    cerr << endl << s.str() << endl;
+    if (verbose) cerr << endl << s.str() << endl;
     visitor.setParser(0);
     XML_ParserFree(parser);
     throw JSBSim::BaseException(s.str());
@@ -395,13 +395,15 @@ private:
  * @param visitor An object that contains callbacks for XML parsing
  * events.
  * @param path A string describing the original path of the resource.
+ * @param verbose If false, the errors are not printed before the exception
+ * is thrown.
  * @exception Throws sg_io_exception or sg_xml_exception if there
  * is a problem reading the file.
  * @see XMLVisitor
  */
 
 void JSBSIM_API readXML (std::istream &input, XMLVisitor &visitor,
-                     const std::string &path="");
+                     const std::string &path="", bool verbose=true);
 
 /** @relates XMLVisitor
  * Read an XML document.
@@ -15,112 +15,296 @@
  *                                                                         *
  ***************************************************************************/
 
-#include "datafile.h"
-
-DataFile::DataFile() {
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
+#include "datafile.h"
+#include "input_output/FGCompressedFile.h"
+
+DataFile::DataFile()
+  : data(nullptr), size(0), StartIdx(0), EndIdx(-1), WindowStatsStart(0),
+    WindowStatsEnd(-1)
+{
+#ifdef _WIN32
+  file_handle = mapping_handle = nullptr;
+#endif
 }
 
 
 DataFile::~DataFile() {
-  f.close();
+  Close();
 }
 
 
-/** This overloaded constructor opens the requested file. */
-
-DataFile::DataFile(string fname) {
-  int count=0;
-  unsigned short start, end;
-  string var;
+/** This overloaded constructor maps the requested file in memory and indexes
+    its records. A compressed file (see JSBSim::FGCompressedFileReader) is
+    decompressed in memory instead. */
+
+DataFile::DataFile(string fname)
+  : data(nullptr), size(0), StartIdx(0), EndIdx(-1), WindowStatsStart(0),
+    WindowStatsEnd(-1)
+{
+  void* addr = nullptr;
+
+#ifdef _WIN32
+  file_handle = mapping_handle = nullptr;
+#endif
+
+  if (JSBSim::FGCompressedFile::IsCompressed(fname)) {
+    try {
+      JSBSim::FGCompressedFileReader reader(fname);
+      text = reader.Read();
+      addr = &text[0];
+      size = text.size();
+    } catch (JSBSim::BaseException& e) {
+      cout << e.what() << endl;
+    }
+  }
+#ifdef _WIN32
+  else {
+    HANDLE file = CreateFileA(fname.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    LARGE_INTEGER file_size;
+    if (file != INVALID_HANDLE_VALUE && GetFileSizeEx(file, &file_size)
+        && file_size.QuadPart > 0) {
+      HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+                                          nullptr);
+      if (mapping) addr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      if (addr) {
+        file_handle = file;
+        mapping_handle = mapping;
+        size = static_cast<size_t>(file_size.QuadPart);
+      } else {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+      }
+    } else if (file != INVALID_HANDLE_VALUE) {
+      CloseHandle(file);
+    }
+  }
+#else
+  else {
+    int fd = open(fname.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+      addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED) addr = nullptr;
+      else size = st.st_size;
+    }
+    if (fd >= 0) close(fd);
+  }
+#endif
 
-  f.open(fname.c_str());
-  f.setf(ios::skipws);
-  if ( !f ) {
+  if (!addr) {
     cout << "fileopen failed for file " << fname << endl << endl;
     exit(-1);
   } else {
     cout << "File " << fname << " successfully opened." << endl;
   }
 
-  getline(f, data_str);
-  end = 0;
+  data = static_cast<const char*>(addr);
+  const char* end = data + size;
+
+  // The first line holds the names of the columns.
+  const char* eol = static_cast<const char*>(memchr(data, '\n', size));
+  if (!eol) eol = end;
+  data_str.assign(data, eol);
+  if (!data_str.empty() && data_str.back() == '\r') data_str.pop_back();
 
+  size_t start = 0;
   while (1) {
-    start = end;
-    while (data_str[start] == ' ') start++;
-    end = data_str.find(",", start);
-    count++;
-    if (end >= 65535) {
-      end = data_str.size();
-      var = data_str.substr(start, end-start);
-      names.push_back(var);
+    start = data_str.find_first_not_of(' ', start);
+    if (start == string::npos) start = data_str.size();
+    size_t comma = data_str.find(',', start);
+    if (comma == string::npos) {
+      names.push_back(data_str.substr(start));
       break;
-    } else {
-      var = data_str.substr(start, end-start);
-      names.push_back(var);
-      end++;
     }
+    names.push_back(data_str.substr(start, comma-start));
+    start = comma + 1;
+  }
+
+  cout << "Done parsing names. Indexing data ..." << endl;
+
+  // Only the offsets of the records are stored: the values are parsed when
+  // they are requested.
+  for (const char* p = eol; p < end; p = eol) {
+    p++;
+    eol = static_cast<const char*>(memchr(p, '\n', end - p));
+    if (!eol) eol = end;
+    const char* q = p;
+    while (q < eol && isspace(static_cast<unsigned char>(*q))) q++;
+    if (q < eol) Records.push_back(p - data);
+  }
+
+  StartIdx = 0;
+  EndIdx = GetNumRecords()-1;
+
+  cout << endl << "Done indexing " << GetNumRecords() << " records ..." << endl;
+}
+
+
+void DataFile::Close(void) {
+  if (data && !text.empty()) {
+    text.clear();
+  } else if (data) {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mapping_handle);
+    CloseHandle(file_handle);
+    mapping_handle = file_handle = nullptr;
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
   }
+  data = nullptr;
+  size = 0;
+  Records.clear();
+  FileStats.clear();
+  WindowStats.clear();
+}
 
-  cout << "Done parsing names. Reading data ..." << endl;
 
-  int row=0, column=0;
-  char scratch[10];
+/** Returns a pointer to the first character of a field of a record or nullptr
+    if the record has fewer fields. */
 
-  while (1) {
-    column = 0;
-    Data.push_back(*(new Row()));
-    while (1) {
-      Data[row].push_back(0.0);
-      f >> Data[row][column];
-      if (f.eof()) {
-        Data.pop_back();
-        break;
-      }
-      if (++column == count) break;
-      else f >> scratch;
-    }
-    row++;
-    if (f.eof()) break;
+const char* DataFile::FindField(int record, int field) const {
+  const char* p = data + Records[record];
+  const char* end = data + size;
+
+  for (; field > 0; field--) {
+    while (p < end && *p != ',' && *p != '\n') p++;
+    if (p == end || *p == '\n') return nullptr;
+    p++;
   }
 
-  for (int i=0;i<GetNumFields();i++) {
-    Max.push_back(0.0);
-    Min.push_back(0.0);
+  return p;
+}
+
+
+double DataFile::GetValue(int record, int field) const {
+  const char* p = FindField(record, field);
+  if (!p) return 0.0;
+
+  // The mapped file is not null terminated so the field is copied before it
+  // is converted.
+  const char* end = data + size;
+  char buffer[64];
+  size_t len = 0;
+  while (p < end && *p != ',' && *p != '\n' && len < sizeof(buffer)-1)
+    buffer[len++] = *p++;
+  buffer[len] = '\0';
+
+  return strtod(buffer, nullptr);
+}
+
+
+void DataFile::SetTimeWindow(double start, double end) {
+  int lo = 0, hi = GetNumRecords();
+
+  // First record whose time is not lower than start.
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (GetValue(mid, 0) < start) lo = mid + 1;
+    else hi = mid;
+  }
+  StartIdx = lo;
+
+  // Last record whose time is not greater than end.
+  hi = GetNumRecords();
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (GetValue(mid, 0) <= end) lo = mid + 1;
+    else hi = mid;
   }
+  EndIdx = lo - 1;
+}
+
+
+int DataFile::GetStride(int max_points) const {
+  int num_points = EndIdx - StartIdx + 1;
+  if (max_points <= 0 || num_points <= max_points) return 1;
+  return (num_points + max_points - 1) / max_points;
+}
+
+
+int DataFile::GetColumn(int field, std::vector<double>& values, int stride) const {
+  if (stride < 1) stride = 1;
+  values.clear();
+  if (EndIdx >= StartIdx) values.reserve((EndIdx - StartIdx) / stride + 1);
+
+  for (int rec=StartIdx; rec<=EndIdx; rec+=stride)
+    values.push_back(GetValue(rec, field));
+
+  return values.size();
+}
+
 
-  for (int fld=0; fld<GetNumFields(); fld++) {
-    Max[fld] = Data[0][fld];
-    Min[fld] = Data[0][fld];
-    for (int rec=1;rec<GetNumRecords();rec++) {
-      if (Data[rec][fld] > Max[fld]) Max[fld] = Data[rec][fld];
-      else if (Data[rec][fld] < Min[fld]) Min[fld] = Data[rec][fld];
+DataFile::Statistics DataFile::GetStatistics(int field, int first, int last) const {
+  Statistics stats;
+  stats.count = 0;
+  stats.min = stats.max = stats.mean = 0.0;
+  double sum = 0.0;
+
+  for (int rec=first; rec<=last; rec++) {
+    double value = GetValue(rec, field);
+    if (stats.count == 0) {
+      stats.min = stats.max = value;
+    } else {
+      if (value > stats.max) stats.max = value;
+      if (value < stats.min) stats.min = value;
     }
+    sum += value;
+    stats.count++;
   }
 
-  StartIdx = 0;
-  EndIdx = GetNumRecords()-1;
+  if (stats.count > 0) stats.mean = sum / stats.count;
+  return stats;
+}
+
+
+const DataFile::Statistics& DataFile::GetFileStatistics(int field) const {
+  if (FileStats.empty()) FileStats.resize(GetNumFields(), Statistics{-1});
+  Statistics& stats = FileStats[field];
+  if (stats.count < 0) stats = GetStatistics(field, 0, GetNumRecords()-1);
+  return stats;
+}
 
-  cout << endl << "Done Reading data ..." << endl;
 
+const DataFile::Statistics& DataFile::GetStatistics(int field) const {
+  if (WindowStats.empty() || WindowStatsStart != StartIdx
+      || WindowStatsEnd != EndIdx) {
+    WindowStats.assign(GetNumFields(), Statistics{-1});
+    WindowStatsStart = StartIdx;
+    WindowStatsEnd = EndIdx;
+  }
+  Statistics& stats = WindowStats[field];
+  if (stats.count < 0) stats = GetStatistics(field, StartIdx, EndIdx);
+  return stats;
 }
 
 
-float DataFile::GetAutoAxisMax(int item) {
+float DataFile::GetAutoAxisMax(int item) const {
   double Mx, order, magnitude;
-  float max = Max[item];
-  float min = Min[item];
+  const Statistics& stats = GetStatistics(item);
+  float max = stats.max;
+  float min = stats.min;
 
   if (max == 0.0 && min == 0.0) return(1.0);
 
-  if (StartIdx != 0 || EndIdx != (GetNumRecords()-1)) {
-    Mx = Data[StartIdx][item];
-    for (int rec=StartIdx+1; rec<=EndIdx; rec++) {
-      if (Data[rec][item] > Mx) Mx = Data[rec][item];
-    }
-  }
-
   order = (int)(log10(fabs(max)));
   magnitude = pow((double)10.0, (double)order);
 
@@ -131,20 +315,14 @@ float DataFile::GetAutoAxisMax(int item) {
 }
 
 
-float DataFile::GetAutoAxisMin(int item) {
+float DataFile::GetAutoAxisMin(int item) const {
   float Mn, order, magnitude;
-  float min = Min[item];
-  float max = Max[item];
+  const Statistics& stats = GetStatistics(item);
+  float min = stats.min;
+  float max = stats.max;
 
   if (max == 0.0 && min == 0.0) return(0.0);
 
-  if (StartIdx != 0 || (EndIdx != GetNumRecords()-1)) {
-    min = Data[StartIdx][item];
-    for (int rec=StartIdx+1; rec<=EndIdx; rec++) {
-      if (Data[rec][item] < min) min = Data[rec][item];
-    }
-  }
-
   order = (int)(log10(fabs(min)));
   magnitude = pow((double)10.0, (double)order);
 
@@ -154,4 +332,3 @@ float DataFile::GetAutoAxisMin(int item) {
   return Mn;
 }
 
-
@@ -18,16 +18,22 @@
 #ifndef DATAFILE_H
 #define DATAFILE_H
 
-#include <fstream>
-#include <cstdio>
+#include <cstddef>
 #include <string>
 #include <vector>
-#include <cmath>
-#include <iostream>
 
 using namespace std;
 
 /**This class handles reading a data file and placing user-requested data into arrays for plotting.
+
+  The file is mapped in memory and only the offset of each record is stored
+  when it is opened: the values are parsed on demand, one column at a time,
+  so the memory used does not depend on the number of columns of the file.
+  A time window (see SetTimeWindow) restricts the records that GetColumn and
+  GetStatistics go through, and GetColumn can decimate the records so that
+  only every n-th value is extracted. The statistics of a column are computed
+  in a single pass without storing the values, and are kept until the window
+  changes.
   *@author Jon S. Berndt
   */
 
@@ -37,32 +43,67 @@ public:
   ~DataFile();
   DataFile(string fname);
 
+  // Not copyable: data points to the mapping released by Close() or to text.
+  DataFile(const DataFile&) = delete;
+  DataFile& operator=(const DataFile&) = delete;
+
+  struct Statistics {
+    int count;
+    double min, max, mean;
+  };
+
   std::vector <string> names;
   string data_str;
-  typedef std::vector <float> Row;
-  typedef std::vector <Row> DataType;
-  DataType Data;
-
-  int GetNumFields(void) {if (Data.size() > 0) return(Data[0].size()); else return(0);}
-  int GetNumRecords(void) {return(Data.size());}
-  float GetStartTime(void) {if (Data.size() >= 2) return(Data[0][0]); else return(0);}
-  float GetEndTime(void) {if (Data.size() >= 2) return(Data[Data.size()-1][0]); else return(0);}
-  float GetMax(int column) {return(Max[column]);}
-  float GetMin(int column) {return(Min[column]);}
-  float GetRange(int field) {return (GetMax(field) - GetMin(field));}
-  float GetAutoAxisMax(int item);
-  float GetAutoAxisMin(int item);
+
+  int GetNumFields(void) const {return names.size();}
+  int GetNumRecords(void) const {return Records.size();}
+  double GetValue(int record, int field) const;
+  double GetStartTime(void) const {if (Records.size() >= 2) return(GetValue(0, 0)); else return(0);}
+  double GetEndTime(void) const {if (Records.size() >= 2) return(GetValue(Records.size()-1, 0)); else return(0);}
+  double GetMax(int column) const {return GetFileStatistics(column).max;}
+  double GetMin(int column) const {return GetFileStatistics(column).min;}
+  double GetRange(int field) const {const Statistics& s = GetFileStatistics(field); return (s.max - s.min);}
+  float GetAutoAxisMax(int item) const;
+  float GetAutoAxisMin(int item) const;
   void SetStartIdx(int sidx) {StartIdx = sidx;}
   void SetEndIdx(int eidx)   {EndIdx = eidx;}
-  int GetStartIdx(void)       {return StartIdx;}
-  int GetEndIdx(void)         {return EndIdx;}
+  int GetStartIdx(void) const {return StartIdx;}
+  int GetEndIdx(void) const   {return EndIdx;}
+
+  /** Restricts the window to the records whose time lies in [start, end].
+      The time (first column) is expected to increase monotonically. */
+  void SetTimeWindow(double start, double end);
+
+  /** Returns the smallest decimation stride that keeps the number of records
+      extracted from the window below max_points. */
+  int GetStride(int max_points) const;
+
+  /** Extracts every stride-th value of a column within the window.
+      @return the number of values extracted */
+  int GetColumn(int field, std::vector<double>& values, int stride=1) const;
+
+  /** Returns the statistics of a column within the window. They are computed
+      once per column and window. */
+  const Statistics& GetStatistics(int field) const;
+  Statistics GetStatistics(int field, int first, int last) const;
 
 private: // Private attributes
-  string buff_str;
-  ifstream f;
-  Row Max;
-  Row Min;
+  const char* data;
+  size_t size;
+  string text; // Decompressed content of a compressed file
+#ifdef _WIN32
+  void* file_handle;
+  void* mapping_handle;
+#endif
+  std::vector<size_t> Records;
   int StartIdx, EndIdx;
+  // Statistics of the columns over the whole file and over the window.
+  mutable std::vector<Statistics> FileStats, WindowStats;
+  mutable int WindowStatsStart, WindowStatsEnd;
+
+  const Statistics& GetFileStatistics(int field) const;
+  const char* FindField(int record, int field) const;
+  void Close(void);
 };
 #endif
 
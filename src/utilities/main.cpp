@@ -36,6 +36,7 @@
 void plotdata(DataFile& df, plotXMLVisitor* vis);
 void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vector <int> IDs);
 bool autoscale;
+const int MaxPlotPoints = 10000; // Records beyond that are decimated
 double xmin, ymin, xmax, ymax;
 ofstream outfile;
 
@@ -133,14 +134,7 @@ entertime:
     } else if (ef > endtime) {
       cout << "The end time must not be greater than " << endtime << endl;
     } else {
-      for (int pt=0; pt<df.GetNumRecords(); pt++) {
-        if (df.Data[pt][0] <= sf) df.SetStartIdx(pt);
-        if (df.Data[pt][0] <= ef) {
-          df.SetEndIdx(pt);
-        } else {
-          break;
-        }
-      }
+      df.SetTimeWindow(sf, ef);
       redo = false;
     }
     if (redo) goto entertime;
@@ -215,11 +209,9 @@ savepng:
 
 // Plot data
 
-  double *timarray = new double[df.GetEndIdx()-df.GetStartIdx()+1]; // new jsb 11/9
-
-  for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-    timarray[pti] = df.Data[pt][0];
-  }
+  int stride = df.GetStride(MaxPlotPoints);
+  vector <double> timarray, datarray;
+  int numpts = df.GetColumn(0, timarray, stride);
 
   float axismax = df.GetAutoAxisMax(commands_vec[0]);
   float axismin = df.GetAutoAxisMin(commands_vec[0]);
@@ -243,7 +235,7 @@ savepng:
     labels("float","y");
   }
 
-  spread = df.Data[df.GetEndIdx()][0] - df.Data[df.GetStartIdx()][0];
+  spread = df.GetValue(df.GetEndIdx(), 0) - df.GetValue(df.GetStartIdx(), 0);
 
   if      (spread < 1.0)   labdig(3,"x");
   else if (spread < 10.0)  labdig(2,"x");
@@ -255,9 +247,9 @@ savepng:
   if (spread > 1000.0) labels("fexp","x");
   else                 labels("float","x");
 
-  graf( df.Data[df.GetStartIdx()][0], // starttime
-        df.Data[df.GetEndIdx()][0],   // endtime
-        df.Data[df.GetStartIdx()][0], // starttime
+  graf( df.GetValue(df.GetStartIdx(), 0), // starttime
+        df.GetValue(df.GetEndIdx(), 0),   // endtime
+        df.GetValue(df.GetStartIdx(), 0), // starttime
         fac,
         axismin,
         axismax,
@@ -269,13 +261,9 @@ savepng:
   grid(1,1);
 
   for (thisplot=0; thisplot < numtraces; thisplot++) {
-    double *datarray = new double[df.GetEndIdx()-df.GetStartIdx()+1];
-    for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-      datarray[pti] = df.Data[pt][commands_vec[thisplot]];
-    }
+    df.GetColumn(commands_vec[thisplot], datarray, stride);
     color("red");
-    curve(timarray,datarray,df.GetEndIdx()-df.GetStartIdx()+1);
-    delete[] datarray;
+    curve(timarray.data(),datarray.data(),numpts);
   }
 
   char legendtext[numtraces*(namelen)];
@@ -446,11 +434,9 @@ void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vec
 
 // Plot data
 
-  double *timarray = new double[df.GetEndIdx()-df.GetStartIdx()+1];
-
-  for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-    timarray[pti] = df.Data[pt][XID];
-  }
+  int stride = df.GetStride(MaxPlotPoints);
+  vector <double> timarray, datarray;
+  int numpts = df.GetColumn(XID, timarray, stride);
 
   float axismax = df.GetAutoAxisMax(IDs[0]);
   float axismin = df.GetAutoAxisMin(IDs[0]);
@@ -475,8 +461,8 @@ void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vec
   }
 
   if (autoscale) {
-    xmin = df.Data[df.GetStartIdx()][XID];
-    xmax = df.Data[df.GetEndIdx()][XID];
+    xmin = df.GetValue(df.GetStartIdx(), XID);
+    xmax = df.GetValue(df.GetEndIdx(), XID);
     ymin = axismin;
     ymax = axismax;
   }
@@ -500,13 +486,9 @@ void plot(DataFile& df, string Title, string xTitle, string yTitle, int XID, vec
   grid(1,1);
 
   for (thisplot=0; thisplot < numtraces; thisplot++) {
-    double *datarray = new double[df.GetEndIdx()-df.GetStartIdx()+1];
-    for (int pt=df.GetStartIdx(), pti=0; pt<=df.GetEndIdx(); pt++, pti++) {
-      datarray[pti] = df.Data[pt][IDs[thisplot]];
-    }
+    df.GetColumn(IDs[thisplot], datarray, stride);
     color("red");
-    curve(timarray,datarray,df.GetEndIdx()-df.GetStartIdx()+1);
-    delete[] datarray;
+    curve(timarray.data(),datarray.data(),numpts);
   }
 
   size_t namelen = 0;
@@ -58,7 +58,7 @@ that is part of Ghostscript.
 
 Compiling:
 
-g++ prep_plot.cpp plotXMLVisitor.cpp ../simgear/xml/easyxml.cxx -I ../ -L ../simgear/xml/ -lExpat -o prep_plot.exe
+g++ prep_plot.cpp plotXMLVisitor.cpp datafile.cpp ../input_output/FGCompressedFile.cpp ../simgear/xml/easyxml.cxx -I ../ -L ../simgear/xml/ -lExpat -o prep_plot.exe
 
 These compiler options may produce a faster executable if your machines supports it:
 -O9 -march=nocona 
@@ -67,6 +67,7 @@ Usage:
 (note that an argument with embedded spaces needs to be surrounded by quotes)
 
 prep_plot <filename.csv> [--title="my title"] [--plot=<plotfile.xml>] [--comp[rehensive]] [--start=start_time] [--end=end_time]
+          [--stats]
 
 I have used this utility as follows to produce a PDF file:
 
@@ -86,6 +87,11 @@ parameters.
 The names of data items as output by JSBSim (as part of FGOutput.cpp) will
 likely be modified to work better with this utility.
 
+The --stats option prints the number of records, the minimum, the maximum and
+the mean of each data item between the --start and --end times instead of
+gnuplot commands. The data file is mapped in memory (see DataFile) and only
+the offsets of its records are stored: the values are not copied.
+
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -100,6 +106,7 @@ INCLUDES
 #include <cmath>
 #include "input_output/string_utilities.h"
 #include "plotXMLVisitor.h"
+#include "datafile.h"
 
 using namespace std;
 
@@ -123,6 +130,7 @@ bool MakeArbitraryPlot(
   string Title,
   stringstream& plot);
 void PrintNames(const vector <string>&);
+void PrintStatistics(const string&, const string&, const string&);
 string itostr(int number)
 {
   stringstream ss;  // create a stringstream
@@ -144,6 +152,7 @@ int main(int argc, char **argv)
   bool png=false;
   bool nokey=false;
   bool plotspecs=false;
+  bool stats=false;
   string set_thickness="";
   int font_sz_delta=0;
 
@@ -164,6 +173,7 @@ int main(int argc, char **argv)
          << " [--out=<output file name>]"
          << " [--start=<time>] [--end=<time>] [--title=<title>] [--pdf | --png]"
          << " [--thick | --thicker | --thickest] [--smallest | --small | --large | --largest]"
+         << " [--stats]"
          << endl << endl;
     cout << "If only the input data file name is given, all of the parameters available in that plot file" << endl;
     cout << "are given." << endl << endl;
@@ -217,6 +227,8 @@ int main(int argc, char **argv)
       pdf=true;
     } else if (input_arg.substr(0,5) == "--png") {
       png=true;
+    } else if (input_arg.substr(0,7) == "--stats") {
+      stats=true;
     } else if (input_arg.substr(0,6) == "--comp") {
       comprehensive=true;
     } else if (input_arg.substr(0,7) == "--title") {
@@ -271,6 +283,11 @@ int main(int argc, char **argv)
   TIMESTAMP_FONT = font + itostr(TIMESTAMP_FONT_SZ);
   TICS_FONT = font + itostr(TICS_FONT_SZ);
 
+  if (stats) { // Print summary statistics of the data items and exit.
+    PrintStatistics(files[0], start_time, end_time);
+    exit(0);
+  }
+
   if (!plotspecs && ! comprehensive) { // Just print out names to be plotted and exit.
     cout << "Known variable names in data file:" << endl;
     PrintNames(names);
@@ -759,3 +776,27 @@ void PrintNames(const vector <string>& names)
     cout << "  " << i+1 << ":  " << names[i] << endl;
   }
 }
+
+void PrintStatistics(const string& filename, const string& start_time, const string& end_time)
+{
+  DataFile df(filename);
+
+  if (start_time.size() > 0 || end_time.size() > 0) {
+    double start = start_time.size() > 0 ? atof(start_time.c_str()) : df.GetStartTime();
+    double end = end_time.size() > 0 ? atof(end_time.c_str()) : df.GetEndTime();
+    df.SetTimeWindow(start, end);
+  }
+
+  if (df.GetEndIdx() < df.GetStartIdx()) {
+    cout << "No data between the start and end times." << endl;
+    return;
+  }
+
+  cout << endl << "Statistics from " << df.GetValue(df.GetStartIdx(), 0)
+       << " to " << df.GetValue(df.GetEndIdx(), 0) << " seconds:" << endl;
+  for (int i=1; i<df.GetNumFields(); i++) {
+    DataFile::Statistics s = df.GetStatistics(i);
+    cout << "  " << i+1 << ":  " << df.names[i] << "  count: " << s.count
+         << "  min: " << s.min << "  max: " << s.max << "  mean: " << s.mean << endl;
+  }
+}
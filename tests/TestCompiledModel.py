@@ -0,0 +1,127 @@
+# TestCompiledModel.py
+#
+# Check that an aircraft loaded from a compiled model has the same property
+# tree as the aircraft loaded from its XML files and that a compiled model
+# which is out of date is ignored.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import CopyAircraftDef, JSBSimTestCase, RunTest
+
+
+class TestCompiledModel(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1723.xml')
+        tree, self.aircraft, _ = CopyAircraftDef(script_path, self.sandbox)
+        self.aircraft_file = self.sandbox('aircraft', self.aircraft,
+                                          self.aircraft + '.xml')
+        tree.write(self.aircraft_file)
+        self.compiled_file = self.sandbox('aircraft', self.aircraft,
+                                          self.aircraft + '.jsbbin')
+
+    def load(self):
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        self.assertTrue(fdm.load_model(self.aircraft))
+        fdm.load_ic('reset00', True)
+        fdm.run_ic()
+        for _ in range(10):
+            fdm.run()
+        return fdm
+
+    def get_properties(self, fdm):
+        names = [p.split(' ')[0] for p in fdm.get_property_catalog()]
+        return {name: fdm[name] for name in names}
+
+    def compile(self):
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        self.assertTrue(fdm.compile_model(self.aircraft))
+        self.assertTrue(os.path.exists(self.compiled_file))
+        self.delete_fdm()
+
+    def test_property_tree(self):
+        fdm = self.load()
+        xml_properties = self.get_properties(fdm)
+        self.delete_fdm()
+
+        self.compile()
+
+        # The compiled model is used as long as the sources are unchanged: the
+        # content of the aircraft file is ignored.
+        mtime = os.path.getmtime(self.aircraft_file)
+        with open(self.aircraft_file, 'w') as f:
+            f.write('<fdm_config/>')
+        os.utime(self.aircraft_file, (mtime, mtime))
+        fdm = self.load()
+        self.assertEqual(self.get_properties(fdm), xml_properties)
+
+    def test_out_of_date(self):
+        self.compile()
+
+        # Modify the aircraft after it has been compiled
+        tree = et.parse(self.aircraft_file)
+        et.SubElement(tree.getroot().find('flight_control'),
+                      'property').text = 'test/modified'
+        tree.write(self.aircraft_file)
+        mtime = os.path.getmtime(self.compiled_file) + 10.0
+        os.utime(self.aircraft_file, (mtime, mtime))
+
+        fdm = self.load()
+        self.assertIn('test/modified', self.get_properties(fdm))
+
+    def add_system(self, path):
+        # Copy of a system of the aircraft that overrides the original file.
+        tree = et.parse(self.sandbox.path_to_jsbsim_file('systems',
+                                                         'GNCUtilities.xml'))
+        et.SubElement(tree.getroot(), 'property').text = 'test/local-system'
+        tree.write(path)
+
+    def test_removed_source(self):
+        local_system = self.sandbox('aircraft', self.aircraft,
+                                    'GNCUtilities.xml')
+        self.add_system(local_system)
+        self.compile()
+
+        # The compiled model is out of date once one of its sources is removed.
+        os.remove(local_system)
+        fdm = self.load()
+        self.assertNotIn('test/local-system', self.get_properties(fdm))
+
+    def test_missing_document(self):
+        self.compile()
+
+        # The files that are not in the compiled model are read from the disk.
+        local_system = self.sandbox('aircraft', self.aircraft,
+                                    'GNCUtilities.xml')
+        self.add_system(local_system)
+        fdm = self.load()
+        self.assertIn('test/local-system', self.get_properties(fdm))
+
+    def test_invalid_file(self):
+        with open(self.compiled_file, 'wb') as f:
+            f.write(b'JSBBIN\0\0\xff\xff\xff\xff')
+
+        fdm = self.load()
+        self.assertEqual(fdm.get_model_name(), self.aircraft)
+
+
+RunTest(TestCompiledModel)
@@ -0,0 +1,129 @@
+# TestCompressedOutput.py
+#
+# Check that the compressed output files hold the same data than the text
+# files and that they can be read back partially from the Python module.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+import jsbsim
+
+
+class TestCompressedOutput(JSBSimTestCase):
+    def write_output_directive(self, filename, name, compressed):
+        root = et.Element('output', {'name': name, 'type': 'CSV',
+                                     'rate': '120'})
+        if compressed:
+            root.attrib['compression'] = 'ON'
+        for section in ('simulation', 'atmosphere', 'velocities', 'forces',
+                        'moments', 'position', 'fcs', 'propulsion'):
+            et.SubElement(root, section).text = 'ON'
+        et.ElementTree(root).write(filename)
+
+    def run_script(self):
+        self.write_output_directive('text.xml', 'output.csv', False)
+        self.write_output_directive('compressed.xml', 'output.jlz', True)
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        fdm.set_output_directive('text.xml')
+        fdm.set_output_directive('compressed.xml')
+        fdm.run_ic()
+        while fdm.run() and fdm.get_sim_time() < 30.0:
+            pass
+        del fdm
+
+        with open('output.csv') as f:
+            return f.read()
+
+    def test_read(self):
+        text = self.run_script()
+        reader = jsbsim.FGCompressedFileReader('output.jlz')
+
+        self.assertEqual(reader.header, text.splitlines(True)[0])
+        self.assertGreater(reader.num_blocks, 1)
+        self.assertEqual(reader.read(), text)
+
+        # The blocks are contiguous in time.
+        times = reader.block_times
+        for (_, end), (start, _) in zip(times[:-1], times[1:]):
+            self.assertLess(end, start)
+
+    def test_time_window(self):
+        text = self.run_script()
+        reader = jsbsim.FGCompressedFileReader('output.jlz')
+
+        lines = text.splitlines(True)
+        expected = [line for line in lines[1:]
+                    if 10.0 <= float(line.split(',')[0]) <= 12.5]
+        self.assertEqual(reader.read(10.0, 12.5), lines[0]+''.join(expected))
+
+        expected = [line for line in lines[1:]
+                    if float(line.split(',')[0]) <= 1.0]
+        self.assertEqual(reader.read(end=1.0), lines[0]+''.join(expected))
+
+        expected = [line for line in lines[1:]
+                    if float(line.split(',')[0]) >= 29.0]
+        self.assertEqual(reader.read(start=29.0), lines[0]+''.join(expected))
+
+    def test_time_reset(self):
+        self.write_output_directive('text.xml', 'output.csv', False)
+        self.write_output_directive('compressed.xml', 'output.jlz', True)
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        fdm.set_output_directive('text.xml')
+        fdm.set_output_directive('compressed.xml')
+        fdm.run_ic()
+        while fdm.run() and fdm.get_sim_time() < 20.0:
+            pass
+        # The time goes backwards in the middle of a block.
+        fdm.set_sim_time(3.0)
+        while fdm.run() and fdm.get_sim_time() < 10.0:
+            pass
+        del fdm
+
+        with open('output.csv') as f:
+            lines = f.read().splitlines(True)
+
+        reader = jsbsim.FGCompressedFileReader('output.jlz')
+        expected = [line for line in lines[1:]
+                    if 3.0 <= float(line.split(',')[0]) <= 3.5]
+        self.assertEqual(reader.read(3.0, 3.5), lines[0]+''.join(expected))
+
+    def test_invalid_file(self):
+        self.run_script()
+        with self.assertRaises(jsbsim.BaseError):
+            jsbsim.FGCompressedFileReader('output.csv')
+        with self.assertRaises(jsbsim.BaseError):
+            jsbsim.FGCompressedFileReader('missing.jlz')
+
+        # The version of the format follows the 8 bytes of the magic string.
+        with open('output.jlz', 'rb') as f:
+            data = bytearray(f.read())
+        data[8:12] = (7).to_bytes(4, 'little')
+        with open('version.jlz', 'wb') as f:
+            f.write(data)
+        with self.assertRaisesRegex(jsbsim.BaseError, 'version 7'):
+            jsbsim.FGCompressedFileReader('version.jlz')
+
+
+RunTest(TestCompressedOutput)
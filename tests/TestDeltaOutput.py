@@ -0,0 +1,107 @@
+# TestDeltaOutput.py
+#
+# Check the output of the values that changed only (delta="ON").
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+
+properties = (('position/h-sl-ft', '1.0'), ('velocities/vc-kts', '0.1'),
+              ('gear/gear-pos-norm', None))
+
+
+class TestDeltaOutput(JSBSimTestCase):
+    def write_output_directive(self, filename, name, delta):
+        root = et.Element('output', {'name': name, 'type': 'CSV',
+                                     'rate': '20'})
+        if delta:
+            root.attrib['delta'] = 'ON'
+            root.attrib['keyframe'] = '2.0'
+        for prop, deadband in properties:
+            prop_tag = et.SubElement(root, 'property')
+            prop_tag.text = prop
+            if deadband:
+                prop_tag.attrib['deadband'] = deadband
+        et.ElementTree(root).write(filename)
+
+    def read_records(self, filename):
+        with open(filename) as f:
+            lines = f.read().splitlines()
+        self.assertEqual(lines[0].split(',')[1:],
+                         ['/fdm/jsbsim/'+p for p, _ in properties])
+        return [line.split(',') for line in lines[1:]]
+
+    def test_delta(self):
+        self.write_output_directive('full.xml', 'full.csv', False)
+        self.write_output_directive('delta.xml', 'delta.csv', True)
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'c1722.xml'))
+        fdm.set_output_directive('full.xml')
+        fdm.set_output_directive('delta.xml')
+        fdm.run_ic()
+        while fdm.run() and fdm.get_sim_time() < 40.0:
+            pass
+        del fdm
+
+        full = self.read_records('full.csv')
+        delta = self.read_records('delta.csv')
+
+        # The records in which nothing changed are skipped.
+        self.assertLess(len(delta), len(full))
+
+        # All the values are output in the keyframes: the first record is one
+        # of them, then the first record after every 2 seconds (the output
+        # rate is 20 Hz).
+        keyframes = [float(record[0]) for record in delta if all(record)]
+        self.assertEqual(keyframes[0], float(delta[0][0]))
+        for t0, t1 in zip(keyframes[:-1], keyframes[1:]):
+            self.assertLessEqual(t1 - t0, 2.0 + 0.05 + 1E-6)
+        self.assertGreater(len(keyframes), 10)
+
+        # The other records leave the fields of the unchanged values empty.
+        self.assertTrue(any('' in record for record in delta))
+
+        # The last output value of each property matches the full output
+        # within its deadband.
+        last = [None] * len(properties)
+        delta_by_time = {record[0]: record for record in delta}
+        for record in full:
+            if record[0] in delta_by_time:
+                for i, field in enumerate(delta_by_time[record[0]][1:]):
+                    if field:
+                        self.assertEqual(field, record[i+1])
+                        last[i] = float(field)
+            for i, (_, deadband) in enumerate(properties):
+                tolerance = float(deadband) if deadband else 0.0
+                self.assertLessEqual(abs(float(record[i+1]) - last[i]),
+                                     tolerance + 1E-9)
+
+        # The altitude is only output when it moved by more than 1 ft.
+        self.assertTrue(any(record[1] and not all(record) for record in delta))
+        previous = None
+        for record in delta:
+            if record[1]:
+                if previous is not None and not all(record):
+                    self.assertGreater(abs(float(record[1]) - previous), 1.0)
+                previous = float(record[1])
+
+
+RunTest(TestDeltaOutput)
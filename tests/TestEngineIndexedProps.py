@@ -21,7 +21,7 @@
 
 import shutil
 import xml.etree.ElementTree as et
-from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+from JSBSim_utils import JSBSimTestCase, CreateFDM, CopyAircraftDef, RunTest
 
 class TestEngineIndexedProps(JSBSimTestCase):
     def testEnginePowerVC(self):
@@ -116,4 +116,48 @@ class TestEngineIndexedProps(JSBSimTestCase):
                 self.assertAlmostEqual(fdm['propulsion/engine[%d]/starter-tabular-data' % (i,)],
                                        tabularData)
 
+    def noiseOfFirstEngine(self, num_noisy_engines):
+        # The random function is loaded once per engine from the same file.
+        shutil.copy(self.sandbox.path_to_jsbsim_file('engine', 'eng_PegasusXc.xml'),
+                    '.')
+        tree = et.parse('eng_PegasusXc.xml')
+        func_tag = et.SubElement(tree.getroot(), 'function')
+        func_tag.attrib['name'] = 'propulsion/engine[#]/noise'
+        func_tag.attrib['type'] = 'post'
+        et.SubElement(func_tag, 'random')
+        tree.write('eng_noisy.xml')
+        shutil.copy(self.sandbox.path_to_jsbsim_file('engine', 'prop_deHavilland5000.xml'),
+                    '.')
+
+        script_path = self.sandbox.path_to_jsbsim_file('scripts',
+                                                       'Short_S23_1.xml')
+        tree, aircraft_name, _ = CopyAircraftDef(script_path, self.sandbox)
+        engines = tree.getroot().findall('propulsion/engine')
+        for engine in engines[:num_noisy_engines]:
+            engine.attrib['file'] = 'eng_noisy'
+        tree.write(self.sandbox('aircraft', aircraft_name,
+                                aircraft_name+'.xml'))
+
+        fdm = CreateFDM(self.sandbox)
+        fdm.set_aircraft_path('aircraft')
+        fdm.set_engine_path('.')
+        fdm.load_model(aircraft_name)
+        fdm.load_ic('reset00', True)
+        fdm['simulation/randomseed'] = 7
+        fdm.run_ic()
+
+        noise = []
+        for _ in range(100):
+            fdm.run()
+            noise.append(fdm['propulsion/engine[0]/noise'])
+        return noise
+
+    def testRandomStreamPerEngine(self):
+        # Each engine draws from its own stream so the noise of an engine does
+        # not depend on the number of engines.
+        noise1 = self.noiseOfFirstEngine(1)
+        noise2 = self.noiseOfFirstEngine(2)
+        self.assertEqual(noise1, noise2)
+        self.assertGreater(len(set(noise1)), 1)
+
 RunTest(TestEngineIndexedProps)
@@ -0,0 +1,66 @@
+# TestFCSPlan.py
+#
+# Check that the execution plans of the FCS channels give the same results as
+# the execution of the components.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+from JSBSim_utils import JSBSimTestCase, RunTest, FlightModel
+
+properties = ['test/feedback', 'test/gain-value', 'test/gain-property',
+              'test/lag', 'test/lead-lag', 'test/washout', 'test/output',
+              'test/second-order', 'test/switch', 'test/scale',
+              'test/elevator', 'fcs/elevator-pos-rad', 'test/tied-sum',
+              'test/overwrite', 'test/actuator', 'test/disabled']
+
+
+class TestFCSPlan(JSBSimTestCase):
+    def run_system(self, mode):
+        tripod = FlightModel(self, 'tripod')
+        tripod.include_system_test_file('fcs_plan.xml')
+        fdm = tripod.start()
+        fdm['simulation/fcs-plan'] = mode
+
+        results = []
+        for i in range(2000):
+            fdm['test/input'] = 1.2*math.sin(0.01*i) + (0.5 if i > 1000 else 0.0)
+            # Properties modified between two frames
+            if i == 500:
+                fdm['test/lag'] = 3.0
+            if i == 700:
+                fdm['test/enable'] = 0.0
+            fdm.run()
+            results.append([fdm[name] for name in properties])
+
+        mismatches = fdm['simulation/fcs-plan-mismatches']
+        self.delete_fdm()
+        return results, mismatches
+
+    def test_plan(self):
+        ref, _ = self.run_system(0)
+        results, _ = self.run_system(1)
+        self.assertEqual(ref, results)
+
+    def test_verify(self):
+        ref, _ = self.run_system(0)
+        results, mismatches = self.run_system(2)
+        self.assertEqual(ref, results)
+        self.assertEqual(mismatches, 0)
+
+
+RunTest(TestFCSPlan)
@@ -155,4 +155,32 @@ class TestGndReactions(JSBSimTestCase):
         self.assertAlmostEqual(Mz_total/Mz, 0.0, delta=1E-6)
 
 
+    def test_friction_solver_statistics(self):
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path(self.sandbox.path_to_jsbsim_file('tests'))
+        fdm.load_model('tripod', False)
+
+        fdm['ic/h-sl-ft'] = 0.1
+        fdm['ic/lat-gc-deg'] = 90.0
+        fdm.run_ic()
+        fdm.do_trim(2)
+
+        for i in range(5):
+            fdm.run()
+            iterations = fdm['accelerations/friction-iterations']
+            self.assertGreaterEqual(iterations, 1)
+            self.assertLessEqual(iterations, 50)
+            # The solver stops either when it has converged or when the
+            # maximum number of iterations is reached. It can converge at the
+            # last iteration so the residual is not checked in that case.
+            if iterations < 50:
+                self.assertLess(fdm['accelerations/friction-residual'], 1E-5)
+
+        # No contact with the ground: the friction solver is not run.
+        fdm['ic/h-sl-ft'] = 100.0
+        fdm.run_ic()
+        self.assertEqual(fdm['accelerations/friction-iterations'], 0)
+        self.assertEqual(fdm['accelerations/friction-residual'], 0.0)
+
+
 RunTest(TestGndReactions)
@@ -0,0 +1,128 @@
+# TestInputServer.py
+#
+# A test case that checks that several clients can simultaneously be connected
+# to the JSBSim telnet server and that the batched commands are working.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import CopyAircraftDef, JSBSimTestCase, RunTest
+
+
+class Client:
+    def __init__(self, port):
+        self.sock = socket.create_connection(("localhost", port))
+        self.sock.settimeout(0.05)
+        self.data = ""
+
+    def send(self, command):
+        self.sock.sendall(f"{command}\r\n".encode())
+
+    def receive(self, fdm, until, max_frames=1000):
+        # The server is only served when the FDM is run so the FDM must be
+        # iterated while waiting for the reply.
+        for _ in range(max_frames):
+            if until in self.data:
+                break
+            fdm.run()
+            try:
+                msg = self.sock.recv(4096)
+            except socket.timeout:
+                continue
+            if not msg:
+                break
+            self.data += msg.decode()
+
+        reply, _, self.data = self.data.partition(until)
+        return reply
+
+    def close(self):
+        self.sock.close()
+
+
+class TestInputServer(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        self.script_path = self.sandbox.path_to_jsbsim_file("scripts", "c1722.xml")
+        tree, aircraft_name, _ = CopyAircraftDef(self.script_path, self.sandbox)
+        input_tag = et.SubElement(tree.getroot(), "input")
+        input_tag.attrib["type"] = "server"
+        input_tag.attrib["port"] = "1139"
+        input_tag.attrib["clients"] = "2"
+        tree.write(self.sandbox("aircraft", aircraft_name, aircraft_name + ".xml"))
+
+        self._fdm = self.create_fdm()
+        self._fdm.set_aircraft_path("aircraft")
+        self._fdm.load_script(self.script_path)
+        self._fdm.run_ic()
+
+    def test_multiple_clients(self):
+        fdm = self._fdm
+        clients = [Client(1139) for _ in range(3)]
+
+        for c in clients[:2]:
+            self.assertEqual(c.receive(fdm, "JSBSim> "), "Connected to JSBSim server\r\n")
+
+        # The server accepts 2 clients at most.
+        self.assertEqual(clients[2].receive(fdm, "\r\n"),
+                         "Too many clients connected to JSBSim server")
+        clients[2].close()
+
+        # Both clients are served during the same time step.
+        clients[0].send("get simulation/sim-time-sec")
+        clients[1].send("get simulation/dt")
+        fdm.run()
+        t0 = float(clients[0].receive(fdm, "JSBSim> ").split("=")[1])
+        dt = float(clients[1].receive(fdm, "JSBSim> ").split("=")[1])
+        self.assertAlmostEqual(dt, fdm["simulation/dt"], delta=1E-6)
+        self.assertLessEqual(t0, fdm.get_sim_time())
+
+        # Get several properties at once
+        clients[0].send("get simulation/dt fcs/throttle-cmd-norm dummy")
+        lines = clients[0].receive(fdm, "JSBSim> ").split("\r\n")
+        self.assertEqual(lines[0].split("=")[0].strip(), "simulation/dt")
+        self.assertEqual(lines[1].split("=")[0].strip(), "fcs/throttle-cmd-norm")
+        self.assertEqual(lines[2], "dummy: Unknown property")
+
+        clients[0].close()
+
+        # Subscribe to the simulation time at 10 Hz.
+        clients[1].send("subscribe 10 simulation/sim-time-sec simulation/dt")
+        self.assertEqual(clients[1].receive(fdm, "JSBSim> "), "Subscription 1\r\n")
+        t0 = fdm.get_sim_time()
+        updates = []
+        while fdm.get_sim_time() < t0 + 1.0:
+            line = clients[1].receive(fdm, "\r\n")
+            values = line.split(",")
+            self.assertEqual(values[0], "1")
+            self.assertEqual(len(values), 4)
+            updates.append(float(values[1]))
+
+        self.assertGreaterEqual(len(updates), 10)
+        for t1, t2 in zip(updates[:-1], updates[1:]):
+            self.assertAlmostEqual(t2 - t1, 0.1, delta=fdm["simulation/dt"])
+
+        clients[1].send("unsubscribe 1")
+        self.assertTrue(clients[1].receive(fdm, "JSBSim> ").endswith("Unsubscribed\r\n"))
+        clients[1].send("quit")
+        self.assertTrue(clients[1].receive(fdm, "Closing connection\r\n") is not None)
+        clients[1].close()
+
+
+RunTest(TestInputServer)
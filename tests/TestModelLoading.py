@@ -25,6 +25,7 @@ import pandas as pd
 from JSBSim_utils import (JSBSimTestCase, CreateFDM, ExecuteUntil, append_xml,
                           CopyAircraftDef, isDataMatching, FindDifferences,
                           RunTest)
+from jsbsim import BaseError
 
 
 class TestModelLoading(JSBSimTestCase):
@@ -177,4 +178,27 @@ class TestModelLoading(JSBSimTestCase):
         self.BuildReference('Concorde_runway_test.xml')
         self.ProcessAndCompare('external_reactions')
 
+    def test_preloaded_files_errors(self):
+        # The system files are parsed concurrently before the models are built.
+        # A parse error must nevertheless be reported for the first faulty file
+        # in the order of the aircraft definition.
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1723.xml')
+        tree, aircraft_name, _ = CopyAircraftDef(script_path, self.sandbox)
+        root = tree.getroot()
+        index = list(root).index(root.findall('system')[-1])
+        for i, name in enumerate(('faulty1', 'faulty2')):
+            root.insert(index+i+1, et.Element('system', {'file': name}))
+            with open(self.sandbox('aircraft', aircraft_name, name+'.xml'),
+                      'w') as f:
+                f.write('<system name="{}"><channel></system>'.format(name))
+        tree.write(self.sandbox('aircraft', aircraft_name, aircraft_name+'.xml'))
+
+        for _ in range(5):
+            fdm = self.create_fdm()
+            fdm.set_aircraft_path('aircraft')
+            with self.assertRaises(BaseError) as context:
+                fdm.load_model(aircraft_name)
+            self.assertIn('faulty1.xml', str(context.exception))
+            self.delete_fdm()
+
 RunTest(TestModelLoading)
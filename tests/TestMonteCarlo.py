@@ -0,0 +1,152 @@
+# TestMonteCarlo.py
+#
+# Check that the Monte Carlo driver applies the dispersions declared in a
+# dispersion file, collects the metrics of each run and that its results do not
+# depend on the number of threads.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import xml.etree.ElementTree as et
+
+import numpy as np
+from JSBSim_utils import CopyAircraftDef, JSBSimTestCase, RunTest
+import jsbsim
+
+
+class TestMonteCarlo(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'ball.xml')
+
+        # Add a named table which value is constant to the ball.
+        tree, aircraft_name, _ = CopyAircraftDef(script_path, self.sandbox)
+        channel = tree.getroot().find('flight_control/channel')
+        fcs_function = et.SubElement(channel, 'fcs_function',
+                                     {'name': 'test/table-output'})
+        function = et.SubElement(fcs_function, 'function')
+        table = et.SubElement(function, 'table', {'name': 'test/table'})
+        et.SubElement(table, 'independentVar').text = 'simulation/sim-time-sec'
+        et.SubElement(table, 'tableData').text = '0.0 1.0\n100.0 1.0'
+        tree.write(self.sandbox('aircraft', aircraft_name, aircraft_name+'.xml'))
+
+        # Shorten the script and add a local property.
+        tree = et.parse(script_path)
+        run_tag = tree.getroot().find('run')
+        run_tag.attrib['end'] = '0.5'
+        prop = et.Element('property', {'value': '2.0'})
+        prop.text = 'test/gain'
+        run_tag.insert(0, prop)
+        tree.write('ball.xml')
+
+    def write_spec(self, runs, threads, dispersed='test/gain'):
+        root = et.Element('monte_carlo', {'name': 'ball', 'runs': str(runs),
+                                          'seed': '5',
+                                          'threads': str(threads)})
+        et.SubElement(root, 'script', {'file': 'ball.xml'})
+        et.SubElement(root, 'output', {'file': 'results.csv'})
+        dispersions = et.SubElement(root, 'dispersions')
+        prop = et.SubElement(dispersions, 'property',
+                             {'distribution': 'uniform', 'min': '0.5',
+                              'max': '1.5', 'apply': 'scale'})
+        prop.text = dispersed
+        prop = et.SubElement(dispersions, 'property',
+                             {'distribution': 'normal', 'mean': '0.0',
+                              'sigma': '100.0', 'apply': 'offset'})
+        prop.text = 'ic/h-sl-ft'
+        et.SubElement(dispersions, 'table',
+                      {'name': 'test/table', 'distribution': 'normal',
+                       'sigma': '0.1'})
+        metrics = et.SubElement(root, 'metrics')
+        for name, prop, type in (('gain', 'test/gain', 'final'),
+                                 ('table', 'test/table-output', 'final'),
+                                 ('t_min', 'simulation/sim-time-sec', 'min'),
+                                 ('t_max', 'simulation/sim-time-sec', 'max'),
+                                 ('t_mean', 'simulation/sim-time-sec', 'mean')):
+            metric = et.SubElement(metrics, 'metric', {'name': name,
+                                                       'type': type})
+            metric.text = prop
+        metric = et.SubElement(metrics, 'metric', {'name': 'h0',
+                                                   'type': 'first'})
+        metric.text = 'ic/h-sl-ft'
+        et.SubElement(metric, 'condition').text = 'simulation/sim-time-sec ge 0.0'
+        et.ElementTree(root).write('dispersions.xml')
+
+    def run_batch(self, runs, threads):
+        self.write_spec(runs, threads)
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        mc = jsbsim.FGMonteCarlo(fdm)
+        self.assertTrue(mc.load('dispersions.xml'))
+        self.assertTrue(mc.run())
+        return mc
+
+    def test_dispersions(self):
+        # Nominal run
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        fdm.load_script('ball.xml')
+        fdm.run_ic()
+        h0 = fdm['ic/h-sl-ft']
+        times = []
+        while fdm.run():
+            times.append(fdm.get_sim_time())
+        self.delete_fdm()
+
+        mc = self.run_batch(20, 3)
+        self.assertEqual(mc.column_names,
+                         ('run', 'seed', 'test/gain', 'ic/h-sl-ft',
+                          'test/table/scale-factor', 'gain', 'table', 't_min',
+                          't_max', 't_mean', 'h0'))
+        results = mc.results
+        self.assertEqual(results.shape, (20, 11))
+
+        for row in results:
+            run, seed, gain, dh, scale, gain_out, table_out, t_min, t_max, \
+                t_mean, h = row
+            self.assertEqual(seed, 5 + run)
+            self.assertTrue(0.5 <= gain < 1.5)
+            self.assertAlmostEqual(gain_out, 2.0 * gain)
+            self.assertAlmostEqual(table_out, scale)
+            self.assertAlmostEqual(h, h0 + dh, delta=1E-6)
+            self.assertEqual(t_min, times[0])
+            self.assertEqual(t_max, times[-1])
+            self.assertAlmostEqual(t_mean, np.mean(times))
+
+        # Each dispersion uses its own stream.
+        self.assertFalse(np.array_equal(results[:, 3], results[:, 4]))
+        self.assertEqual(len(np.unique(results[:, 2])), 20)
+
+        # The results file contains the same data.
+        data = np.genfromtxt('results.csv', delimiter=',', names=True)
+        self.assertEqual(len(data), 20)
+        np.testing.assert_allclose(data['h0'], results[:, -1], rtol=1E-11)
+
+    def test_threads(self):
+        results = self.run_batch(6, 1).results
+        self.delete_fdm()
+        np.testing.assert_array_equal(self.run_batch(6, 4).results, results)
+
+    def test_unknown_property(self):
+        self.write_spec(2, 1, 'test/does-not-exist')
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        mc = jsbsim.FGMonteCarlo(fdm)
+        self.assertTrue(mc.load('dispersions.xml'))
+        self.assertFalse(mc.run())
+
+
+RunTest(TestMonteCarlo)
@@ -75,6 +75,74 @@ class TestPlanet(JSBSimTestCase):
         self.assertAlmostEqual(self.fdm['atmosphere/rho-slugs_ft3']/0.001940318, 1.263428, delta=1E-6)
         self.assertAlmostEqual(self.fdm['atmosphere/P-psf'], 2132.294, delta=1E-3)
 
+    def test_output_after_load_planet(self):
+        tripod = FlightModel(self, 'tripod')
+        self.fdm = tripod.start()
+        output = et.Element('output', {'name': 'output.csv', 'type': 'CSV',
+                                       'rate': '120'})
+        et.SubElement(output, 'atmosphere').text = 'ON'
+        et.ElementTree(output).write('output.xml')
+        self.fdm.set_output_directive('output.xml')
+        self.fdm.run_ic()
+
+        # The atmosphere is replaced after the output file has been opened.
+        MSIS_file = self.sandbox.path_to_jsbsim_file('tests/MSIS.xml')
+        self.fdm.load_planet(MSIS_file, False)
+        self.fdm['ic/h-sl-ft'] = 0.0
+        self.fdm['ic/long-gc-deg'] = -70.0
+        self.fdm['ic/lat-geod-deg'] = 60.0
+        self.fdm.run_ic()
+        for _ in range(10):
+            self.fdm.run()
+        rho = self.fdm['atmosphere/rho-slugs_ft3']
+        self.delete_fdm()
+
+        with open('output.csv') as f:
+            lines = f.read().splitlines()
+        column = lines[0].split(',').index('Rho (slugs/ft^3)')
+        self.assertAlmostEqual(float(lines[-1].split(',')[column]), rho)
+
+    def test_MSIS_cache(self):
+        MSIS_file = self.sandbox.path_to_jsbsim_file('tests/MSIS.xml')
+        tree = et.parse(MSIS_file)
+        cache_tag = et.SubElement(tree.getroot().find('atmosphere'), 'cache',
+                                  {'tolerance': '0.01'})
+        et.SubElement(cache_tag, 'max_altitude', {'unit': 'FT'}).text = '100000'
+        cached_file = self.sandbox('MSIS_cache.xml')
+        tree.write(cached_file)
+
+        positions = ((0.0, -70.0, 60.0), (5000.0, 10.0, -35.0),
+                     (35000.0, 150.0, 12.5), (80000.0, -120.0, -80.0),
+                     (150000.0, 45.0, 30.0))
+
+        def run(planet_file):
+            tripod = FlightModel(self, 'tripod')
+            fdm = tripod.start()
+            fdm.load_planet(planet_file, False)
+            results = []
+            for h, lon, lat in positions:
+                fdm['ic/h-sl-ft'] = h
+                fdm['ic/long-gc-deg'] = lon
+                fdm['ic/lat-geod-deg'] = lat
+                fdm.run_ic()
+                results.append((fdm['atmosphere/T-R'],
+                                fdm['atmosphere/rho-slugs_ft3'],
+                                fdm['atmosphere/P-psf']))
+
+            self.delete_fdm()
+            return results
+
+        direct = run(MSIS_file)
+        cached = run(cached_file)
+
+        for (T, rho, P), (Tc, rhoc, Pc) in zip(direct, cached):
+            self.assertAlmostEqual(Tc/T, 1.0, delta=0.01)
+            self.assertAlmostEqual(rhoc/rho, 1.0, delta=0.01)
+            self.assertAlmostEqual(Pc/P, 1.0, delta=0.02)
+
+        # Above the cached altitudes, the model is evaluated directly.
+        self.assertEqual(cached[-1], direct[-1])
+
     def test_planet_geographic_error1(self):
         # Check that a negative equatorial radius raises an exception
         tripod = FlightModel(self, 'tripod')
@@ -19,19 +19,33 @@
 # this program; if not, see <http://www.gnu.org/licenses/>
 #
 
+import os
 import xml.etree.ElementTree as et
 from JSBSim_utils import JSBSimTestCase, FlightModel, CopyAircraftDef, RunTest
 
 
 class TestSensorRandomSeed(JSBSimTestCase):
 
-    def captureSensorData(self, exec_seed):
+    def captureSensorData(self, exec_seed, sensor_seed=5, extra_sensor=False):
         tripod = FlightModel(self, 'tripod')
-        tripod.include_system_test_file('sensorrandomseed.xml')
+        if extra_sensor:
+            # Insert a noisy sensor before the one that is monitored.
+            tree = et.parse(os.path.join(tripod.path, 'sensorrandomseed.xml'))
+            channel = tree.getroot().find('channel')
+            sensor = et.Element('sensor', {'name': 'aero/sensor/vt'})
+            et.SubElement(sensor, 'input').text = 'velocities/vt-fps'
+            et.SubElement(sensor, 'noise', {'variation': 'ABSOLUTE'}).text = '1.0'
+            channel.insert(0, sensor)
+            tree.write('sensorrandomseed.xml')
+            tripod.fdm.set_systems_path('.')
+            et.SubElement(tripod.root, 'system').attrib['file'] = 'sensorrandomseed.xml'
+        else:
+            tripod.include_system_test_file('sensorrandomseed.xml')
         fdm = tripod.start()
 
         fdm['simulation/randomseed'] = exec_seed
-        fdm['aero/sensor/qbar/randomseed'] = 5
+        if sensor_seed is not None:
+            fdm['aero/sensor/qbar/randomseed'] = sensor_seed
 
         sensor_data = []
 
@@ -54,5 +68,46 @@ class TestSensorRandomSeed(JSBSimTestCase):
         for i in range(len(sensor_data1)):
             self.assertAlmostEqual(sensor_data1[i], sensor_data2[i], delta=1E-8)
 
+    def testSensorStreams(self):
+        # Each sensor draws its noise from its own stream so adding a sensor
+        # must not modify the noise of the others.
+        sensor_data1 = self.captureSensorData(3, None)
+        sensor_data2 = self.captureSensorData(3, None, True)
+        self.assertEqual(sensor_data1, sensor_data2)
+
+        # But changing the seed of the FGFDMExec does.
+        sensor_data3 = self.captureSensorData(4, None)
+        self.assertNotEqual(sensor_data1, sensor_data3)
+
+    def captureDuplicateSensors(self, outputs):
+        tripod = FlightModel(self, 'tripod')
+        tree = et.parse(os.path.join(tripod.path, 'sensorrandomseed.xml'))
+        channel = tree.getroot().find('channel')
+        for output in outputs:
+            sensor = et.SubElement(channel, 'sensor', {'name': 'aero/sensor/vt'})
+            et.SubElement(sensor, 'input').text = 'velocities/vt-fps'
+            et.SubElement(sensor, 'noise', {'variation': 'ABSOLUTE'}).text = '1.0'
+            et.SubElement(sensor, 'output').text = output
+        tree.write('sensorrandomseed.xml')
+        tripod.fdm.set_systems_path('.')
+        et.SubElement(tripod.root, 'system').attrib['file'] = 'sensorrandomseed.xml'
+        fdm = tripod.start()
+
+        sensor_data = []
+        for _ in range(100):
+            fdm.run()
+            sensor_data.append([fdm[output] for output in outputs])
+        return sensor_data
+
+    def testDuplicateSensorNames(self):
+        # Sensors with the same name do not share their stream: the noise of
+        # the first one is not modified by the second one.
+        sensor_data1 = self.captureDuplicateSensors(['aero/sensor/vt-a'])
+        sensor_data2 = self.captureDuplicateSensors(['aero/sensor/vt-a',
+                                                     'aero/sensor/vt-b'])
+        self.assertEqual([data[0] for data in sensor_data1],
+                         [data[0] for data in sensor_data2])
+        self.assertNotEqual([data[0] for data in sensor_data2],
+                            [data[1] for data in sensor_data2])
 
 RunTest(TestSensorRandomSeed)
@@ -0,0 +1,131 @@
+# TestSharedMemory.py
+#
+# Check that the properties published in a shared memory segment by an FDM are
+# read by another FDM and that the layout of the segment matches its
+# specification.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+import struct
+import unittest
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import FlightModel, JSBSimTestCase, RunTest
+
+SHM_DIR = "/dev/shm"
+
+
+@unittest.skipUnless(os.path.isdir(SHM_DIR),
+                     "POSIX shared memory is not mapped in the file system")
+class TestSharedMemory(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        self.segment = f"jsbsim_test_{os.getpid()}"
+
+    def start_writer(self):
+        tripod = FlightModel(self, "tripod")
+        output_tag = et.SubElement(tripod.root, "output")
+        output_tag.attrib["type"] = "shm"
+        output_tag.attrib["name"] = "/" + self.segment
+        prop = et.SubElement(output_tag, "property")
+        prop.text = "fcs/aileron-cmd-norm"
+        prop = et.SubElement(output_tag, "property",
+                             {"caption": "fcs/elevator-cmd-norm"})
+        prop.text = "fcs/rudder-cmd-norm"
+        return tripod.start()
+
+    def start_reader(self):
+        tripod = FlightModel(self, "tripod")
+        input_tag = et.SubElement(tripod.root, "input")
+        input_tag.attrib["type"] = "shm"
+        input_tag.attrib["name"] = "/" + self.segment
+        return tripod.start()
+
+    def read_segment(self):
+        with open(os.path.join(SHM_DIR, self.segment), "rb") as f:
+            data = f.read()
+
+        magic, version, count, table_offset, entry_size, block0, block1, \
+            block_size, _, sequence, active = struct.unpack_from("=8s10I", data)
+        self.assertEqual(magic, b"JSBSHM\0\0")
+        self.assertEqual(version, 1)
+        self.assertEqual(block_size, 8 * (count + 1))
+        self.assertEqual(sequence % 2, 0)
+
+        names = []
+        values = {}
+        block = (block0, block1)[active]
+        time = struct.unpack_from("=d", data, block)[0]
+        for i in range(count):
+            offset, _, name = struct.unpack_from("=II120s", data,
+                                                 table_offset + i * entry_size)
+            name = name.split(b"\0")[0].decode()
+            names.append(name)
+            values[name] = struct.unpack_from("=d", data, block + offset)[0]
+
+        return names, time, values
+
+    def test_layout(self):
+        fdm = self.start_writer()
+        fdm["fcs/aileron-cmd-norm"] = 0.25
+        fdm["fcs/rudder-cmd-norm"] = -0.5
+        fdm.run()
+
+        names, time, values = self.read_segment()
+        self.assertEqual(names, ["fcs/aileron-cmd-norm", "fcs/elevator-cmd-norm"])
+        self.assertEqual(time, fdm.get_sim_time())
+        self.assertEqual(values["fcs/aileron-cmd-norm"], 0.25)
+        self.assertEqual(values["fcs/elevator-cmd-norm"], -0.5)
+
+        # The segment is removed when the writer is destroyed.
+        fdm = None
+        self.delete_fdm()
+        self.assertFalse(os.path.exists(os.path.join(SHM_DIR, self.segment)))
+
+    def test_input(self):
+        # The reader is started before the writer: the segment is opened as
+        # soon as it is available.
+        reader = self.start_reader()
+        reader.run()
+        writer = self.start_writer()
+
+        for da, dr in ((0.25, -0.5), (-0.75, 0.125)):
+            writer["fcs/aileron-cmd-norm"] = da
+            writer["fcs/rudder-cmd-norm"] = dr
+            writer.run()
+            reader.run()
+            self.assertEqual(reader["fcs/aileron-cmd-norm"], da)
+            self.assertEqual(reader["fcs/elevator-cmd-norm"], dr)
+            self.assertEqual(reader["fcs/rudder-cmd-norm"], 0.0)
+
+        # The properties are only updated when a new block is published.
+        reader["fcs/aileron-cmd-norm"] = 1.0
+        reader.run()
+        self.assertEqual(reader["fcs/aileron-cmd-norm"], 1.0)
+
+        # A writer that restarts creates a new segment which the reader opens.
+        writer = None
+        self.delete_fdm()
+        writer = self.start_writer()
+        writer["fcs/aileron-cmd-norm"] = 0.5
+        writer.run()
+        reader.run()
+        self.assertEqual(reader["fcs/aileron-cmd-norm"], 0.5)
+
+
+RunTest(TestSharedMemory)
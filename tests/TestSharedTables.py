@@ -0,0 +1,58 @@
+# TestSharedTables.py
+#
+# Check that the tables loaded several times share their data.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestSharedTables(JSBSimTestCase):
+    def test_twin_engines(self):
+        # The c310 loads the same engine and propeller files twice.
+        fdm = self.create_fdm()
+        fdm.load_model('c310')
+        self.assertGreater(fdm.get_shared_table_bytes(), 0)
+
+    def test_same_aircraft(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        first = fdm.get_shared_table_bytes()
+
+        # All the tables of the second instance are shared with the first one.
+        fdm2 = self.create_fdm()
+        fdm2.load_model('c172x')
+        self.assertGreater(fdm2.get_shared_table_bytes(), first)
+
+        fdm2.run_ic()
+        fdm.run_ic()
+        for _ in range(100):
+            fdm.run()
+            fdm2.run()
+        self.assertEqual(fdm['aero/coefficient/CLalpha'],
+                         fdm2['aero/coefficient/CLalpha'])
+
+        del fdm, fdm2
+        self.delete_fdm()
+
+        # The shared data is released with the last FDM that uses it.
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        self.assertEqual(fdm.get_shared_table_bytes(), first)
+
+
+RunTest(TestSharedTables)
@@ -417,5 +417,33 @@ class TestStdAtmosphere(JSBSimTestCase):
         self.assertAlmostEqual(fdm['atmosphere/P-sl-psf']*1E17, 2.08854342)
         self.assertAlmostEqual(fdm['atmosphere/P-psf']*1E17, 2.08854342)
 
+    def test_layer_lookup_order(self):
+        # The layers are looked up starting from the layer of the previous
+        # call, so the results must not depend on the order of the altitudes.
+        # The initial altitude itself is only reproduced within round-off
+        # errors, hence the tolerance.
+        fdm = self.create_fdm()
+        fdm.load_model('ball')
+        fdm['atmosphere/delta-T'] = 10.0
+
+        altitudes = [-3000.0 + 1500.0*i for i in range(200)]
+        values = {}
+        for h in altitudes:
+            fdm['ic/h-sl-ft'] = h
+            fdm.run_ic()
+            values[h] = (fdm['atmosphere/T-R'], fdm['atmosphere/P-psf'],
+                         fdm['atmosphere/pressure-altitude'],
+                         fdm['atmosphere/density-altitude'])
+
+        for h in reversed(altitudes[::7] + altitudes[3::11]):
+            fdm['ic/h-sl-ft'] = h
+            fdm.run_ic()
+            for ref, prop in zip(values[h], ['atmosphere/T-R',
+                                             'atmosphere/P-psf',
+                                             'atmosphere/pressure-altitude',
+                                             'atmosphere/density-altitude']):
+                self.assertAlmostEqual(ref, fdm[prop],
+                                       delta=1E-10*max(1.0, abs(ref)))
+
 
 RunTest(TestStdAtmosphere)
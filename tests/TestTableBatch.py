@@ -0,0 +1,168 @@
+# TestTableBatch.py
+#
+# Check the evaluation of tables over arrays of keys from the Python module.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+import subprocess
+import sys
+
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, RunTest
+import jsbsim
+
+
+class TestTableBatch(JSBSimTestCase):
+    def write_table(self, filename, table):
+        with open(filename, 'w') as f:
+            f.write('<?xml version="1.0"?>\n')
+            f.write(table)
+
+    def test_1D_table(self):
+        x = np.array([-1.0, 0.0, 0.5, 2.0, 3.0])
+        y = np.array([2.0, -1.0, 0.3, 1.5, 0.7])
+        rows = '\n'.join(f'{a} {b}' for a, b in zip(x, y))
+        self.write_table('table1D.xml', f"""
+<system>
+  <table name="test/table">
+    <independentVar>test/x</independentVar>
+    <tableData>
+{rows}
+    </tableData>
+  </table>
+</system>""")
+
+        table = jsbsim.FGTable('table1D.xml', 'test/table')
+        self.assertEqual(table.dimension, 1)
+        self.assertEqual(table.num_rows, 5)
+
+        keys = np.linspace(-2.0, 4.0, 1001)
+        values = table.get_values(keys)
+        self.assertEqual(values.shape, keys.shape)
+        self.assertTrue(np.allclose(values, np.interp(keys, x, y),
+                                    rtol=0.0, atol=1E-12))
+
+        # Scattered keys give the same results as sorted keys.
+        order = np.random.default_rng(0).permutation(keys.size)
+        self.assertTrue(np.array_equal(table.get_values(keys[order]),
+                                       values[order]))
+
+        # Scalars and multi-dimensional arrays
+        self.assertIsInstance(table.get_values(1.0), float)
+        self.assertAlmostEqual(table.get_values(1.0), 0.7)
+        self.assertEqual(table.get_values(keys.reshape(7, 143)).shape, (7, 143))
+        self.assertEqual(table.get_values([]).shape, (0,))
+
+        with self.assertRaises(ValueError):
+            table.get_values(keys, keys)
+
+    def test_2D_table(self):
+        self.write_table('table2D.xml', """
+<table type="internal">
+  <tableData>
+          -1.0   0.0   2.0
+    1.0    1.0   2.0  -0.5
+    2.0    0.5   3.0   1.5
+    3.5   -2.0   0.0   4.0
+  </tableData>
+</table>""")
+
+        table = jsbsim.FGTable('table2D.xml')
+        self.assertEqual(table.dimension, 2)
+
+        # The keys are broadcast together.
+        rows = np.linspace(0.0, 4.0, 41)[:, np.newaxis]
+        columns = np.linspace(-2.0, 3.0, 26)
+        values = table.get_values(rows, columns)
+        self.assertEqual(values.shape, (41, 26))
+
+        col_keys = np.array([-1.0, 0.0, 2.0])
+        data = np.array([[1.0, 2.0, -0.5], [0.5, 3.0, 1.5], [-2.0, 0.0, 4.0]])
+        row_keys = np.array([1.0, 2.0, 3.5])
+        # Bilinear interpolation with the keys constrained to the table range.
+        by_rows = np.array([[np.interp(r, row_keys, data[:, c])
+                             for c in range(3)] for r in rows[:, 0]])
+        expected = np.array([[np.interp(c, col_keys, by_rows[r])
+                              for c in columns] for r in range(41)])
+        self.assertTrue(np.allclose(values, expected, rtol=0.0, atol=1E-12))
+
+        self.assertTrue(np.array_equal(table.get_values(rows[:, 0],
+                                                        columns[15]),
+                                       values[:, 15]))
+
+    def test_aircraft_table(self):
+        # The table of a function in the aerodynamics of an aircraft.
+        table = jsbsim.FGTable(self.sandbox.path_to_jsbsim_file('aircraft',
+                                                                 'c172x',
+                                                                 'c172x.xml'),
+                               'aero/coefficient/CLalpha')
+        self.assertEqual(table.dimension, 3)
+
+        # Breakpoints of the table
+        self.assertAlmostEqual(table.get_values(-10.0, -10.0, -5.0), 4.579224)
+        self.assertAlmostEqual(table.get_values(-9.0, -5.0, -5.0), 4.692626)
+
+        alpha = np.linspace(-15.0, 25.0, 81)
+        beta = np.linspace(-12.0, 12.0, 25)
+        flaps = np.linspace(-10.0, 50.0, 13)
+        values = table.get_values(alpha[:, np.newaxis, np.newaxis],
+                                  beta[np.newaxis, :, np.newaxis],
+                                  flaps)
+        self.assertEqual(values.shape, (81, 25, 13))
+        self.assertTrue(np.all(np.isfinite(values)))
+
+        # Points evaluated one at a time give the same results.
+        for i, j, k in [(0, 0, 0), (40, 12, 6), (80, 24, 12), (33, 7, 3)]:
+            self.assertEqual(table.get_values(alpha[i], beta[j], flaps[k]),
+                             values[i, j, k])
+
+        with self.assertRaises(jsbsim.BaseError):
+            jsbsim.FGTable(self.sandbox.path_to_jsbsim_file('aircraft',
+                                                            'c172x',
+                                                            'c172x.xml'),
+                           'no/such/function')
+
+    def test_malformed_file(self):
+        self.write_table('malformed.xml', '<system><table></system>')
+        with self.assertRaises(jsbsim.BaseError):
+            jsbsim.FGTable('malformed.xml')
+
+    def test_silent_loading(self):
+        # The table is not printed when it is loaded.
+        self.write_table('table.xml', """
+<table>
+  <independentVar>test/x</independentVar>
+  <tableData>
+    0.0 1.0
+    1.0 2.0
+  </tableData>
+</table>""")
+        env = dict(os.environ)
+        env.pop('JSBSIM_DEBUG', None)
+        # The child process must import the same module as this test.
+        module_dir = os.path.dirname(os.path.dirname(jsbsim.__file__))
+        env['PYTHONPATH'] = os.pathsep.join(
+            [module_dir] + [p for p in [env.get('PYTHONPATH')] if p])
+        result = subprocess.run([sys.executable, '-c',
+                                 'import jsbsim; jsbsim.FGTable("table.xml")'],
+                                capture_output=True, text=True, env=env)
+        self.assertEqual(result.returncode, 0, result.stderr)
+        self.assertEqual(result.stdout, '')
+
+
+RunTest(TestTableBatch)
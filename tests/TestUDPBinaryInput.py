@@ -0,0 +1,96 @@
+# TestUDPBinaryInput.py
+#
+# Check that the binary UDP input decodes the datagrams according to the layout
+# declared in the XML input directives and that it rejects the stale datagrams.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import struct
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import FlightModel, JSBSimTestCase, RunTest
+
+
+class TestUDPBinaryInput(JSBSimTestCase):
+    def start_fdm(self, port, endian):
+        tripod = FlightModel(self, "tripod")
+        input_tag = et.SubElement(tripod.root, "input")
+        input_tag.attrib["type"] = "binary"
+        input_tag.attrib["port"] = str(port)
+        input_tag.attrib["endian"] = endian
+        et.SubElement(input_tag, "sequence", {"type": "uint16"})
+        et.SubElement(input_tag, "timestamp", {"type": "double"})
+        prop = et.SubElement(input_tag, "property", {"type": "float"})
+        prop.text = "fcs/aileron-cmd-norm"
+        prop = et.SubElement(input_tag, "property", {"type": "int16",
+                                                     "factor": "0.001"})
+        prop.text = "fcs/elevator-cmd-norm"
+        et.SubElement(input_tag, "skip", {"bytes": "3"})
+        prop = et.SubElement(input_tag, "property", {"type": "double"})
+        prop.text = "fcs/rudder-cmd-norm"
+        return tripod.start()
+
+    def check_layout(self, port, endian, fmt):
+        fdm = self.start_fdm(port, endian)
+        sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+        def send(seq, t, da, de, dr):
+            sock.sendto(struct.pack(fmt, seq, t, da, int(de * 1000), b"\0" * 3, dr),
+                        ("localhost", port))
+
+        def check(da, de, dr):
+            fdm.run()
+            self.assertAlmostEqual(fdm["fcs/aileron-cmd-norm"], da, delta=1E-6)
+            self.assertAlmostEqual(fdm["fcs/elevator-cmd-norm"], de, delta=1E-6)
+            self.assertAlmostEqual(fdm["fcs/rudder-cmd-norm"], dr, delta=1E-12)
+
+        send(65534, 0.1, 0.25, -0.5, 0.125)
+        check(0.25, -0.5, 0.125)
+
+        # Only the most recent datagram is used. The sequence number wraps
+        # around.
+        send(65535, 0.2, 0.5, 0.25, -0.25)
+        send(0, 0.3, -0.75, 0.125, 0.0625)
+        check(-0.75, 0.125, 0.0625)
+
+        # Out of order datagrams are rejected.
+        send(65535, 0.4, 1.0, 1.0, 1.0)
+        check(-0.75, 0.125, 0.0625)
+
+        # Stale time stamps are rejected.
+        send(1, 0.3, 1.0, 1.0, 1.0)
+        check(-0.75, 0.125, 0.0625)
+
+        # Datagrams which size does not match the layout are rejected.
+        sock.sendto(struct.pack(fmt, 2, 0.5, 1.0, 1, b"\0" * 3, 1.0) + b"\0",
+                    ("localhost", port))
+        check(-0.75, 0.125, 0.0625)
+
+        send(2, 0.5, 0.0, -0.25, 0.5)
+        check(0.0, -0.25, 0.5)
+
+        sock.close()
+
+    def test_little_endian(self):
+        self.check_layout(5141, "little", "<Hdfh3sd")
+
+    def test_big_endian(self):
+        self.check_layout(5142, "big", ">Hdfh3sd")
+
+
+RunTest(TestUDPBinaryInput)
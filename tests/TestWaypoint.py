@@ -19,7 +19,9 @@
 #
 
 import math
-from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, FlightModel, RunTest
 
 
 class TestWaypoint(JSBSimTestCase):
@@ -85,4 +87,44 @@ class TestWaypoint(JSBSimTestCase):
                 self.assertAlmostEqual(fdm['guidance/wp-distance'], 0.5 * p,
                                        delta=1.)
 
+    def test_many_waypoints(self):
+        # A system with many waypoints which share the geodesic solver of the
+        # planet.
+        N = 100
+        tripod = FlightModel(self, 'tripod')
+        system = et.SubElement(tripod.root, 'system', {'name': 'waypoints'})
+        et.SubElement(system, 'property').text = 'test/wp-lon'
+        for i in range(N):
+            et.SubElement(system, 'property').text = f'test/wp-lat-{i}'
+        channel = et.SubElement(system, 'channel', {'name': 'waypoints'})
+        for i in range(N):
+            for tag, unit in (('heading', 'RAD'), ('distance', 'FT')):
+                wp = et.SubElement(channel, 'waypoint_'+tag,
+                                   {'name': f'test/wp-{tag}-{i}',
+                                    'unit': unit})
+                for name, prop in (('target_latitude', f'test/wp-lat-{i}'),
+                                   ('target_longitude', 'test/wp-lon'),
+                                   ('source_latitude', 'position/lat-geod-rad'),
+                                   ('source_longitude', 'position/long-gc-rad')):
+                    et.SubElement(wp, name, {'unit': 'RAD'}).text = prop
+
+        fdm = tripod.start()
+        fdm['test/wp-lon'] = fdm['position/long-gc-rad']
+        lat0 = fdm['position/lat-geod-rad']
+        for i in range(N):
+            fdm[f'test/wp-lat-{i}'] = lat0 + (i - N // 2) * 0.01
+
+        for _ in range(100):
+            fdm.run()
+
+        # The waypoints are on the meridian of the vehicle.
+        distance = 0.0
+        for i in range(N // 2 + 1, N):
+            self.assertAlmostEqual(fdm[f'test/wp-heading-{i}'], 0.0, delta=1E-6)
+            self.assertGreater(fdm[f'test/wp-distance-{i}'], distance)
+            distance = fdm[f'test/wp-distance-{i}']
+        for i in range(N // 2):
+            self.assertAlmostEqual(fdm[f'test/wp-heading-{i}'], math.pi,
+                                   delta=1E-6)
+
 RunTest(TestWaypoint)
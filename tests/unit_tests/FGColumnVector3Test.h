@@ -575,6 +575,19 @@ public:
     TS_ASSERT_EQUALS(Z(1), 0.0);
     TS_ASSERT_EQUALS(Z(2), 0.0);
     TS_ASSERT_EQUALS(Z(3), 1.0);
+
+    // Fused accumulation of a cross product
+    JSBSim::FGColumnVector3 A(1.5, -2.0, 0.25), B(-0.5, 3.0, 4.0);
+    JSBSim::FGColumnVector3 C(10.0, 20.0, -30.0);
+    JSBSim::FGColumnVector3 D = C;
+    D.AddCross(A, B);
+    TS_ASSERT_EQUALS(D, C + A * B);
+    D = A;
+    D.AddCross(D, B);
+    TS_ASSERT_EQUALS(D, A + A * B);
+    D = B;
+    D.AddCross(A, D);
+    TS_ASSERT_EQUALS(D, B + A * B);
   }
 
   void testMagnitude(void) {
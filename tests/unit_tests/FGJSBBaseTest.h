@@ -81,4 +81,57 @@ public:
     TS_ASSERT_EQUALS(x1, y1);
     TS_ASSERT_EQUALS(x2, y2);
   }
+
+  void testRandomNumberGeneratorKnownAnswer() {
+    // Philox4x32-10 known answer test: counter {0,0,0,0}, key {0,0} gives
+    // {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}
+    JSBSim::RandomNumberGenerator generator(0);
+    uint64_t bits0 = (uint64_t(0x6627e8d5) << 32) | 0xe169c58d;
+    uint64_t bits1 = (uint64_t(0xbc57ac4c) << 32) | 0x9b00dbd8;
+
+    TS_ASSERT_EQUALS(generator.GetUniformRandomNumber(),
+                     2.0*(bits0 >> 11)*0x1.0p-53 - 1.0);
+    TS_ASSERT_EQUALS(generator.GetUniformRandomNumber(),
+                     2.0*(bits1 >> 11)*0x1.0p-53 - 1.0);
+  }
+
+  void testRandomNumberGeneratorStreams() {
+    uint64_t id = JSBSim::RandomNumberGenerator::StreamId("sensor/qbar");
+    JSBSim::RandomNumberGenerator generator(17);
+    JSBSim::RandomNumberGenerator stream = generator.Split(id);
+    JSBSim::RandomNumberGenerator same_stream(17, id);
+
+    TS_ASSERT_EQUALS(stream.GetSeed(), 17U);
+    TS_ASSERT_EQUALS(stream.GetStream(), id);
+
+    // Drawing numbers from a stream does not modify the other streams.
+    double x0 = stream.GetNormalRandomNumber();
+    for (int i=0; i<10; ++i) generator.GetUniformRandomNumber();
+    double x1 = stream.GetNormalRandomNumber();
+
+    TS_ASSERT_EQUALS(x0, same_stream.GetNormalRandomNumber());
+    TS_ASSERT_EQUALS(x1, same_stream.GetNormalRandomNumber());
+
+    JSBSim::RandomNumberGenerator main_stream(17);
+    TS_ASSERT_DIFFERS(main_stream.GetNormalRandomNumber(), x0);
+  }
+
+  void testRandomNumberGeneratorFill() {
+    JSBSim::RandomNumberGenerator g1(5, 3), g2(5, 3);
+    double u[7], x[5];
+
+    // Start from an odd position in the block.
+    g1.GetUniformRandomNumber();
+    g2.GetUniformRandomNumber();
+
+    g1.FillUniform(u, 7);
+    g1.FillNormal(x, 5);
+
+    for (double v: u) {
+      TS_ASSERT_EQUALS(v, g2.GetUniformRandomNumber());
+      TS_ASSERT(v >= -1.0 && v < 1.0);
+    }
+    for (double v: x)
+      TS_ASSERT_EQUALS(v, g2.GetNormalRandomNumber());
+  }
 };
@@ -1,5 +1,6 @@
 #include <limits>
 #include <cxxtest/TestSuite.h>
+#include <GeographicLib/Geodesic.hpp>
 #include <math/FGLocation.h>
 #include <math/FGQuaternion.h>
 #include "TestAssertions.h"
@@ -700,4 +701,76 @@ public:
       }
     }
   }
+
+  void testNavigationWithSharedGeodesic()
+  {
+    const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+    const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+    const GeographicLib::Geodesic geod(a, 1.-b/a);
+    JSBSim::FGLocation l;
+    l.SetEllipse(a, b);
+    l.SetPositionGeodetic(0.3, -0.7, 0.);
+
+    for (int ilat = -5; ilat <= 5; ++ilat) {
+      double lat = ilat * M_PI / 12.0;
+      for (int ilon = -5; ilon <= 6; ++ilon) {
+        double lon = NormalizedAngle(ilon * M_PI / 6.0);
+        double distance, heading;
+        l.GetDistanceAndHeadingTo(geod, lon, lat, distance, heading);
+        TS_ASSERT_EQUALS(distance, l.GetDistanceTo(lon, lat));
+        TS_ASSERT_EQUALS(heading, l.GetHeadingTo(lon, lat));
+        TS_ASSERT_EQUALS(distance, l.GetDistanceTo(geod, lon, lat));
+      }
+    }
+  }
+
+  void testSelectiveCache()
+  {
+    const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+    const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+    JSBSim::FGLocation ref;
+    ref.SetEllipse(a, b);
+    ref.SetPositionGeodetic(0.3, -0.7, 1000.);
+    // Compute all the derived values at once as a reference.
+    JSBSim::FGMatrix33 Tec2l = ref.GetTec2l();
+    double lon = ref.GetLongitude();
+    double lat = ref.GetLatitude();
+    double radius = ref.GetRadius();
+    double glat = ref.GetGeodLatitudeRad();
+    double h = ref.GetGeodAltitude();
+
+    // The derived values do not depend on the order in which they are
+    // requested.
+    JSBSim::FGLocation l1(ref);
+    l1 = JSBSim::FGColumnVector3(ref(1), ref(2), ref(3));
+    TS_ASSERT_EQUALS(l1.GetRadius(), radius);
+    TS_ASSERT_EQUALS(l1.GetLongitude(), lon);
+    TS_ASSERT_EQUALS(l1.GetLatitude(), lat);
+    TS_ASSERT_MATRIX_EQUALS(l1.GetTec2l(), Tec2l);
+    TS_ASSERT_EQUALS(l1.GetGeodLatitudeRad(), glat);
+    TS_ASSERT_EQUALS(l1.GetGeodAltitude(), h);
+
+    // Partially computed caches are copied.
+    JSBSim::FGLocation l2;
+    l2.SetEllipse(a, b);
+    l2 = JSBSim::FGColumnVector3(ref(1), ref(2), ref(3));
+    TS_ASSERT_EQUALS(l2.GetGeodAltitude(), h);
+    JSBSim::FGLocation l3(l2);
+    JSBSim::FGLocation l4;
+    l4 = l2;
+    TS_ASSERT_EQUALS(l3.GetGeodLatitudeRad(), glat);
+    TS_ASSERT_MATRIX_EQUALS(l3.GetTec2l(), Tec2l);
+    TS_ASSERT_EQUALS(l3.GetRadius(), radius);
+    TS_ASSERT_EQUALS(l4.GetLongitude(), lon);
+    TS_ASSERT_MATRIX_EQUALS(l4.GetTl2ec(), Tec2l.Transposed());
+
+    // Each group is invalidated when the location is modified.
+    JSBSim::FGLocation l5(ref);
+    l5.SetPositionGeodetic(-0.3, 0.7, 1000.);
+    TS_ASSERT_DELTA(l5.GetLongitude(), -0.3, epsilon);
+    TS_ASSERT_DELTA(l5.GetGeodLatitudeRad(), 0.7, epsilon);
+    TS_ASSERT_DELTA(l5.GetGeodAltitude(), 1000., 1E-8);
+    TS_ASSERT_DELTA(l5.GetSinLongitude(), sin(-0.3), epsilon);
+    TS_ASSERT_DELTA(l5.GetTec2l()(1,3), cos(0.7), epsilon);
+  }
 };
@@ -1,7 +1,9 @@
 #include <iomanip>
+#include <random>
 #include <cxxtest/TestSuite.h>
 #include <math/FGMatrix33.h>
 #include <math/FGQuaternion.h>
+#include <math/FGMathKernels.h>
 
 class FGMatrix33Test : public CxxTest::TestSuite
 {
@@ -673,4 +675,88 @@ public:
     TS_ASSERT_DELTA(angles(2), theta, 1E-8);
     TS_ASSERT_DELTA(angles(3), 0.0, 1E-8);
   }
+
+  // The kernels selected at compile time must return the results of the
+  // scalar reference kernels. They are the same bit for bit unless the
+  // compiler contracts the scalar operations into fused multiply-adds, hence
+  // the tolerance which is relative to the magnitude of the terms.
+  void testKernels() {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+    const double tol = 1E-14*3.0*1000.0*1000.0;
+    const double qtol = 1E-14;
+
+    for (int n=0; n<1000; ++n) {
+      double A[9], B[9], v[4], q[4];
+      for (double& x: A) x = dist(gen);
+      for (double& x: B) x = dist(gen);
+      for (double& x: v) x = dist(gen);
+      double norm = 0.0;
+      for (double& x: q) { x = dist(gen); norm += x*x; }
+      for (double& x: q) x /= sqrt(norm);
+
+      double r1[9], r2[9];
+      JSBSim::MathKernels::MatVec(A, v, r1);
+      JSBSim::MathKernels::Scalar::MatVec(A, v, r2);
+      for (int i=0; i<3; ++i) TS_ASSERT_DELTA(r1[i], r2[i], tol);
+
+      JSBSim::MathKernels::TransposedMatVec(A, v, r1);
+      JSBSim::MathKernels::Scalar::TransposedMatVec(A, v, r2);
+      for (int i=0; i<3; ++i) TS_ASSERT_DELTA(r1[i], r2[i], tol);
+
+      JSBSim::MathKernels::MatMul(A, B, r1);
+      JSBSim::MathKernels::Scalar::MatMul(A, B, r2);
+      for (int i=0; i<9; ++i) TS_ASSERT_DELTA(r1[i], r2[i], tol);
+
+      JSBSim::MathKernels::QuatToMatrix(q, r1);
+      JSBSim::MathKernels::Scalar::QuatToMatrix(q, r2);
+      for (int i=0; i<9; ++i) TS_ASSERT_DELTA(r1[i], r2[i], qtol);
+
+      // The output may alias the inputs.
+      double C[9];
+      std::copy(A, A+9, C);
+      JSBSim::MathKernels::MatMul(C, B, C);
+      JSBSim::MathKernels::Scalar::MatMul(A, B, r2);
+      for (int i=0; i<9; ++i) TS_ASSERT_DELTA(C[i], r2[i], tol);
+      std::copy(B, B+9, C);
+      JSBSim::MathKernels::MatMul(A, C, C);
+      for (int i=0; i<9; ++i) TS_ASSERT_DELTA(C[i], r2[i], tol);
+      std::copy(v, v+3, C);
+      C[3] = 7.0;
+      JSBSim::MathKernels::MatVec(A, C, C);
+      JSBSim::MathKernels::Scalar::MatVec(A, v, r2);
+      for (int i=0; i<3; ++i) TS_ASSERT_DELTA(C[i], r2[i], tol);
+      // Nothing is written past the 3 elements of the vector.
+      TS_ASSERT_EQUALS(C[3], 7.0);
+    }
+
+    JSBSim::FGMatrix33 M(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0);
+    JSBSim::FGColumnVector3 v(-1.0, 2.0, 0.5);
+    TS_ASSERT_EQUALS(M.TransposedMultiply(v), M.Transposed()*v);
+  }
+
+  void testFusedOperations() {
+    JSBSim::FGMatrix33 M(1.5, -2.0, 3.25, 4.0, -5.5, 6.0, 0.125, 8.0, -9.0);
+    JSBSim::FGColumnVector3 v(-1.0, 2.5, 0.5);
+    JSBSim::FGColumnVector3 r;
+
+    M.Multiply(v, r);
+    TS_ASSERT_EQUALS(r, M*v);
+    M.TransposedMultiply(v, r);
+    TS_ASSERT_EQUALS(r, M.Transposed()*v);
+
+    // The result may be the operand.
+    r = v;
+    M.Multiply(r, r);
+    TS_ASSERT_EQUALS(r, M*v);
+    r = v;
+    M.TransposedMultiply(r, r);
+    TS_ASSERT_EQUALS(r, M.Transposed()*v);
+
+    JSBSim::FGMatrix33 T;
+    T.SetTransposed(M);
+    for (unsigned int i=1; i<=3; ++i)
+      for (unsigned int j=1; j<=3; ++j)
+        TS_ASSERT_EQUALS(T(i,j), M(j,i));
+  }
 };
@@ -0,0 +1,131 @@
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+#include <input_output/FGOutputValue.h>
+
+using namespace JSBSim;
+
+class FGOutputValueTest : public CxxTest::TestSuite
+{
+public:
+  // The values must be formatted exactly as the C++ streams do.
+  void testAppendValue() {
+    const double values[] = {0.0, -0.0, 1.0, -1.0, 0.1, 1.0/3.0, -2.0/3.0,
+                             100.0, 123456.789, 1E-5, 1.5E-7, 6.02214076E23,
+                             -1.7976931348623157E308, 4.9E-324, M_PI*1E10,
+                             1E15, 999999.5, 0.000123456789012345678};
+    const int precisions[] = {1, 5, 6, 9, 10, 12, 14, 16, 18};
+
+    for (double value: values) {
+      for (int precision: precisions) {
+        for (int width: {0, 12}) {
+          std::ostringstream ref;
+          ref << std::setw(width) << std::setprecision(precision) << value;
+          std::string buffer("x");
+          AppendValue(buffer, value, precision, width);
+          TS_ASSERT_EQUALS(buffer, "x" + ref.str());
+        }
+      }
+    }
+  }
+
+  // The values which do not fit in 32 characters are formatted as well.
+  void testAppendLargePrecision() {
+    const double values[] = {1.0/3.0, -1.7976931348623157E308, 4.9E-324};
+
+    for (double value: values) {
+      for (int precision: {25, 40, 800}) {
+        std::ostringstream ref;
+        ref << std::setw(12) << std::setprecision(precision) << value;
+        std::string buffer("x");
+        AppendValue(buffer, value, precision, 12);
+        TS_ASSERT_EQUALS(buffer, "x" + ref.str());
+      }
+    }
+  }
+
+  void testAppendSpecialValues() {
+    const double values[] = {std::numeric_limits<double>::infinity(),
+                             -std::numeric_limits<double>::infinity(),
+                             std::numeric_limits<double>::quiet_NaN()};
+
+    for (double value: values) {
+      std::ostringstream ref;
+      ref << std::setprecision(10) << value;
+      std::string buffer;
+      AppendValue(buffer, value, 10);
+      TS_ASSERT_EQUALS(buffer, ref.str());
+    }
+  }
+
+  void testFormatValues() {
+    double x = 1.0;
+    std::vector<FGOutputValue> values;
+
+    TS_ASSERT_EQUALS(FormatValues(values, ","), "");
+
+    values.push_back({[&x]() { return x; }, 6});
+    TS_ASSERT_EQUALS(FormatValues(values, ","), "1");
+
+    values.push_back({[&x]() { return 2.0*x/3.0; }, 3});
+    values.push_back({[&x]() { return -x; }, 6, 4});
+    TS_ASSERT_EQUALS(FormatValues(values, ","), "1,0.667,  -1");
+    TS_ASSERT_EQUALS(FormatValues(values, "\t"), "1\t0.667\t  -1");
+
+    // The values are read each time the list is formatted.
+    x = 0.5;
+    TS_ASSERT_EQUALS(FormatValues(values, ","), "0.5,0.333,-0.5");
+  }
+
+  void testDeltaSelection() {
+    double x = 1.0, y = 10.0;
+    std::vector<FGOutputValue> values;
+    values.push_back({[&x]() { return x; }, 6});
+    values.push_back({[&y]() { return y; }, 6, 0, 0.5});
+    FGOutputDelta delta;
+    delta.SetKeyframePeriod(1.0);
+
+    // The first record is a keyframe.
+    TS_ASSERT(delta.Update(values, 0.0));
+    TS_ASSERT(delta.IsKeyframe());
+    TS_ASSERT(delta.IsSelected(0));
+    TS_ASSERT(delta.IsSelected(1));
+
+    // Nothing changed: the record can be skipped.
+    TS_ASSERT(!delta.Update(values, 0.1));
+    TS_ASSERT(!delta.IsKeyframe());
+
+    // Changes within the deadband are ignored.
+    x = 2.0;
+    y = 10.4;
+    TS_ASSERT(delta.Update(values, 0.2));
+    TS_ASSERT(delta.IsSelected(0));
+    TS_ASSERT(!delta.IsSelected(1));
+    TS_ASSERT_EQUALS(delta.GetValue(0), 2.0);
+
+    // The deadband is measured from the last value output.
+    y = 10.6;
+    TS_ASSERT(delta.Update(values, 0.3));
+    TS_ASSERT(!delta.IsSelected(0));
+    TS_ASSERT(delta.IsSelected(1));
+    TS_ASSERT_EQUALS(delta.GetValue(1), 10.6);
+
+    // Keyframes are periodic.
+    TS_ASSERT(delta.Update(values, 1.0));
+    TS_ASSERT(delta.IsKeyframe());
+    TS_ASSERT(delta.IsSelected(0));
+    TS_ASSERT(!delta.Update(values, 1.5));
+
+    // The time going backward triggers a keyframe.
+    TS_ASSERT(delta.Update(values, 0.0));
+    TS_ASSERT(delta.IsKeyframe());
+
+    delta.Reset();
+    TS_ASSERT(delta.Update(values, 0.1));
+    TS_ASSERT(delta.IsKeyframe());
+  }
+};
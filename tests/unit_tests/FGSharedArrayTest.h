@@ -0,0 +1,103 @@
+#include <limits>
+#include <stdexcept>
+
+#include <cxxtest/TestSuite.h>
+#include <math/FGSharedArray.h>
+
+using namespace JSBSim;
+
+
+class FGSharedArrayTest : public CxxTest::TestSuite
+{
+public:
+  void testConstructor() {
+    FGSharedArray a;
+
+    TS_ASSERT(a.empty());
+    TS_ASSERT_EQUALS(a.size(), 0);
+    TS_ASSERT(!a.IsShared());
+    TS_ASSERT(!a.SharesStorageWith(a));
+    TS_ASSERT_EQUALS(a.Share(), 0);
+    TS_ASSERT(!a.IsShared());
+  }
+
+  void testElements() {
+    FGSharedArray a;
+    a = std::vector<double>{1.0, -2.0, 3.5};
+    a.push_back(4.0);
+
+    TS_ASSERT_EQUALS(a.size(), 4);
+    TS_ASSERT_EQUALS(a[0], 1.0);
+    TS_ASSERT_EQUALS(a[1], -2.0);
+    TS_ASSERT_EQUALS(a.at(2), 3.5);
+    TS_ASSERT_EQUALS(a.data()[3], 4.0);
+    TS_ASSERT_THROWS(a.at(4), std::out_of_range&);
+  }
+
+  void testShare() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    FGSharedArray a, b, c;
+    a = std::vector<double>{nan, 0.0, 1.0, 2.0};
+    b = std::vector<double>{nan, 0.0, 1.0, 2.0};
+    c = std::vector<double>{nan, -0.0, 1.0, 2.0};
+
+    size_t saved = FGSharedArray::GetSavedBytes();
+    size_t total = FGSharedArray::GetTotalBytes();
+    TS_ASSERT_EQUALS(a.Share(), 0);
+    TS_ASSERT(a.IsShared());
+    TS_ASSERT_EQUALS(a.Share(), 0); // Already shared
+
+    // The content is compared bitwise: NaNs are equal, 0.0 and -0.0 are not.
+    TS_ASSERT_EQUALS(b.Share(), 4*sizeof(double));
+    TS_ASSERT(b.SharesStorageWith(a));
+    TS_ASSERT_EQUALS(c.Share(), 0);
+    TS_ASSERT(!c.SharesStorageWith(a));
+
+    TS_ASSERT_EQUALS(FGSharedArray::GetSavedBytes() - saved, 4*sizeof(double));
+    TS_ASSERT_EQUALS(FGSharedArray::GetTotalBytes() - total,
+                     12*sizeof(double));
+
+    // The copies use the same storage.
+    FGSharedArray d(b);
+    TS_ASSERT(d.IsShared());
+    TS_ASSERT(d.SharesStorageWith(a));
+  }
+
+  void testCopyOnWrite() {
+    FGSharedArray a, b;
+    a = std::vector<double>{5.0, 6.0};
+    b = std::vector<double>{5.0, 6.0};
+    a.Share();
+    b.Share();
+    TS_ASSERT(b.SharesStorageWith(a));
+
+    b.push_back(7.0);
+    TS_ASSERT(!b.IsShared());
+    TS_ASSERT(!b.SharesStorageWith(a));
+    TS_ASSERT_EQUALS(a.size(), 2);
+    TS_ASSERT_EQUALS(b.size(), 3);
+    TS_ASSERT_EQUALS(b[0], 5.0);
+    TS_ASSERT_EQUALS(b[2], 7.0);
+
+    // The copy of an array that is not shared is not modified either.
+    FGSharedArray c(b);
+    c.push_back(8.0);
+    TS_ASSERT_EQUALS(b.size(), 3);
+    TS_ASSERT_EQUALS(c.size(), 4);
+  }
+
+  void testRelease() {
+    size_t saved = FGSharedArray::GetSavedBytes();
+    {
+      FGSharedArray a;
+      a = std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+      a.Share();
+    }
+
+    // The storage has been released with the array: there is nothing to share.
+    FGSharedArray b;
+    b = std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+    TS_ASSERT_EQUALS(b.Share(), 0);
+    TS_ASSERT_EQUALS(FGSharedArray::GetSavedBytes(), saved);
+  }
+};
@@ -1,5 +1,8 @@
 #include <sstream>
 #include <limits>
+#include <cmath>
+#include <functional>
+#include <vector>
 
 #include <cxxtest/TestSuite.h>
 #include <math/FGTable.h>
@@ -101,6 +104,270 @@ public:
     TS_ASSERT_EQUALS(t2.GetValue(2.47), 1.5);  // Saturated value
   }
 
+  void testGetValues() {
+    FGTable t(5);
+    t << -1.0 << 2.0
+      << 0.0 << -1.0
+      << 0.5 << 0.3
+      << 2.0 << 1.5
+      << 3.0 << 0.7;
+
+    // Saturated, breakpoints, sorted, unsorted and repeated keys.
+    std::vector<double> keys = {-2.0, -1.0, -0.7, -0.2, 0.0, 0.1, 0.5, 1.2,
+                                2.0, 2.9, 3.0, 3.5, 0.3, 2.5, -0.5, 2.5, 0.2,
+                                0.2, 1.7, -1.5, 0.4};
+    std::vector<double> results(keys.size());
+    t.GetValues(keys.data(), results.data(), keys.size());
+    for (size_t i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t.GetValue(keys[i]));
+
+    // The 2D overload of a 1D table ignores the column keys.
+    std::vector<double> columns(keys.size(), 1.0);
+    std::vector<double> results2(keys.size());
+    t.GetValues(keys.data(), columns.data(), results2.data(), keys.size());
+    TS_ASSERT_EQUALS(results, results2);
+
+    FGTable t1(1);
+    t1 << 0.0 << 1.0;
+    t1.GetValues(keys.data(), results.data(), keys.size());
+    for (double value: results)
+      TS_ASSERT_EQUALS(value, 1.0);
+  }
+
+  void testUniformBreakpoints() {
+    // Piecewise linear interpolation of the breakpoints x and the values y.
+    auto interpolate = [](const std::vector<double>& x,
+                          const std::vector<double>& y, double key) {
+      if (key <= x.front()) return y.front();
+      if (key >= x.back()) return y.back();
+      size_t i = 1;
+      while (x[i] < key) ++i;
+      return y[i-1] + (key-x[i-1])*(y[i]-y[i-1])/(x[i]-x[i-1]);
+    };
+
+    // The breakpoints are rounded when accumulated.
+    std::vector<double> x, y;
+    double alpha = -0.3;
+    for (int i=0; i<21; ++i) {
+      x.push_back(alpha);
+      y.push_back(sin(3.0*alpha));
+      alpha += 0.1;
+    }
+    FGTable t(x.size());
+    for (size_t i=0; i<x.size(); ++i)
+      t << x[i] << y[i];
+    TS_ASSERT(t.IsUniform(0));
+
+    // Breakpoints, their neighbours, midpoints and saturated values.
+    std::vector<double> keys = {-HUGE_VAL, -1.0, 1.8, 5.0, HUGE_VAL};
+    for (size_t i=0; i<x.size(); ++i) {
+      keys.push_back(x[i]);
+      keys.push_back(std::nextafter(x[i], -HUGE_VAL));
+      keys.push_back(std::nextafter(x[i], HUGE_VAL));
+      if (i > 0) keys.push_back(0.5*(x[i-1]+x[i]));
+    }
+    for (double key: keys)
+      TS_ASSERT_DELTA(t.GetValue(key), interpolate(x, y, key), epsilon);
+
+    std::vector<double> results(keys.size());
+    t.GetValues(keys.data(), results.data(), keys.size());
+    for (size_t i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t.GetValue(keys[i]));
+
+    // The breakpoints of this table are not evenly spaced.
+    x[7] += 0.02;
+    FGTable t2(x.size());
+    for (size_t i=0; i<x.size(); ++i)
+      t2 << x[i] << y[i];
+    TS_ASSERT(!t2.IsUniform(0));
+    for (double key: keys)
+      TS_ASSERT_DELTA(t2.GetValue(key), interpolate(x, y, key), epsilon);
+
+    // Too few breakpoints to benefit from the arithmetic.
+    FGTable t3(2);
+    t3 << 0.0 << 1.0
+       << 1.0 << 2.0;
+    TS_ASSERT(!t3.IsUniform(0));
+  }
+
+  void testInterpolation() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto load = [&](const std::string& method) {
+      Element_ptr elm = readFromXML("<dummy>"
+                                    "  <table type=\"internal\" interpolation=\""
+                                    + method + "\">"
+                                    "    <tableData>"
+                                    "      -10.0  -0.80\n"
+                                    "        0.0   0.25\n"
+                                    "        5.0   0.70\n"
+                                    "       10.0   1.20\n"
+                                    "       15.0   1.45\n"
+                                    "       20.0   1.20\n"
+                                    "    </tableData>"
+                                    "  </table>"
+                                    "</dummy>");
+      return std::make_unique<FGTable>(pm, elm->FindElement("table"));
+    };
+    auto linear = load("linear");
+    auto pchip = load("pchip");
+    auto cubic = load("cubic");
+
+    // Reference values from SciPy PchipInterpolator and CubicSpline
+    std::vector<double> keys = {-7.5, -2.0, 2.5, 7.0, 12.5, 14.0, 17.5, 19.0};
+    std::vector<double> pchipValues = {-0.5192664194915254, 0.05458983050847464,
+                                       0.47585303300624443, 0.9122105263157895,
+                                       1.3666666666666667, 1.4346666666666668,
+                                       1.3875, 1.29};
+    std::vector<double> cubicValues = {-0.47260742187499966, 0.0780500000000002,
+                                       0.46586914062499996, 0.9066562499999999,
+                                       1.374169921875, 1.4331749999999999,
+                                       1.400830078125, 1.3002375};
+    for (size_t i=0; i<keys.size(); ++i) {
+      TS_ASSERT_DELTA(pchip->GetValue(keys[i]), pchipValues[i], 1E-12);
+      TS_ASSERT_DELTA(cubic->GetValue(keys[i]), cubicValues[i], 1E-12);
+    }
+
+    // Breakpoints and saturated values
+    for (unsigned int r=1; r<=6; ++r) {
+      double key = linear->GetElement(r, 0);
+      TS_ASSERT_DELTA(pchip->GetValue(key), linear->GetValue(key), epsilon);
+      TS_ASSERT_DELTA(cubic->GetValue(key), linear->GetValue(key), epsilon);
+    }
+    TS_ASSERT_EQUALS(pchip->GetValue(-12.0), -0.8);
+    TS_ASSERT_EQUALS(cubic->GetValue(25.0), 1.2);
+
+    // PCHIP does not overshoot the maximum of the data.
+    for (double key=10.0; key<=20.0; key+=0.125)
+      TS_ASSERT_LESS_THAN_EQUALS(pchip->GetValue(key), 1.45);
+
+    std::vector<double> results(keys.size());
+    cubic->GetValues(keys.data(), results.data(), keys.size());
+    for (size_t i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], cubic->GetValue(keys[i]));
+
+    FGTable copy(*pchip);
+    for (double key: keys)
+      TS_ASSERT_EQUALS(copy.GetValue(key), pchip->GetValue(key));
+
+    // The polynomials of the 5 intervals are stored with the data.
+    TS_ASSERT_EQUALS(linear->GetDataSize(), 14*sizeof(double));
+    TS_ASSERT_EQUALS(pchip->GetDataSize(), (14+20)*sizeof(double));
+  }
+
+  void testInterpolationAccuracy() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto load = [&](const std::string& method, const std::vector<double>& x,
+                    const std::vector<double>& y) {
+      std::ostringstream xml;
+      xml.precision(17);
+      xml << "<dummy><table type=\"internal\" interpolation=\"" << method
+          << "\"><tableData>\n";
+      for (size_t i=0; i<x.size(); ++i)
+        xml << x[i] << " " << y[i] << "\n";
+      xml << "</tableData></table></dummy>";
+      Element_ptr elm = readFromXML(xml.str());
+      return std::make_unique<FGTable>(pm, elm->FindElement("table"));
+    };
+
+    // Lift coefficient like curve
+    auto f = [](double x) { return sin(x) + 0.2*sin(3.0*x); };
+    const double xmin = -0.5, xmax = 3.5;
+    auto sample = [&](const std::string& method, unsigned int n) {
+      std::vector<double> x(n), y(n);
+      for (unsigned int i=0; i<n; ++i) {
+        x[i] = xmin + (xmax-xmin)*i/(n-1);
+        y[i] = f(x[i]);
+      }
+      return load(method, x, y);
+    };
+
+    std::vector<double> keys(2001);
+    for (size_t i=0; i<keys.size(); ++i)
+      keys[i] = xmin + (xmax-xmin)*i/(keys.size()-1);
+
+    auto maxError = [&](const FGTable& t) {
+      double error = 0.0;
+      for (double key: keys)
+        error = std::max(error, fabs(t.GetValue(key) - f(key)));
+      return error;
+    };
+
+    // The splines go through the data.
+    for (const std::string method: {"pchip", "cubic"}) {
+      auto t = sample(method, 17);
+      for (unsigned int r=1; r<=t->GetNumRows(); ++r) {
+        double key = t->GetElement(r, 0);
+        TS_ASSERT_DELTA(t->GetValue(key), t->GetElement(r, 1), epsilon);
+      }
+    }
+
+    // PCHIP preserves the monotonicity of the data, to the rounding errors,
+    // where the cubic spline overshoots the step.
+    std::vector<double> x = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    std::vector<double> y = {0.0, 0.0, 0.1, 1.0, 1.0, 1.0, 1.0};
+    auto pchip = load("pchip", x, y);
+    auto cubic = load("cubic", x, y);
+    double previous = pchip->GetValue(0.0), cubicMax = 0.0;
+    for (double key=0.0; key<=6.0; key+=1.0/64.0) {
+      double value = pchip->GetValue(key);
+      TS_ASSERT_LESS_THAN_EQUALS(previous, value + epsilon);
+      TS_ASSERT_LESS_THAN_EQUALS(value, 1.0 + epsilon);
+      previous = value;
+      cubicMax = std::max(cubicMax, cubic->GetValue(key));
+    }
+    TS_ASSERT_LESS_THAN(1.0, cubicMax);
+
+    // Smallest table of each interpolation method that meets the accuracy.
+    auto smallest = [&](const std::string& method, double accuracy) {
+      unsigned int n = 3;
+      while (maxError(*sample(method, 2*n-1)) > accuracy) n = 2*n - 1;
+      unsigned int high = 2*n - 1;
+      while (high - n > 1) {
+        unsigned int middle = (n + high) / 2;
+        if (maxError(*sample(method, middle)) > accuracy)
+          n = middle;
+        else
+          high = middle;
+      }
+      return sample(method, high);
+    };
+
+    // The cubic spline needs fewer breakpoints than the linear interpolation.
+    for (double accuracy: {1E-3, 1E-5}) {
+      auto linear = smallest("linear", accuracy);
+      auto cubic = smallest("cubic", accuracy);
+      TS_ASSERT_LESS_THAN_EQUALS(maxError(*cubic), accuracy);
+      TS_ASSERT_LESS_THAN(cubic->GetNumRows(), linear->GetNumRows());
+    }
+  }
+
+  void testUniformLookup() {
+    // A 200 breakpoints table with evenly spaced breakpoints and the same
+    // table with a breakpoint moved.
+    const size_t nRows = 200, nKeys = 1000;
+    FGTable uniform(nRows), nonUniform(nRows);
+    for (size_t r=0; r<nRows; ++r) {
+      double x = -20.0 + 0.2*r;
+      uniform << x << cos(0.1*x);
+      nonUniform << (r == 1 ? x - 0.1 : x) << cos(0.1*x);
+    }
+    TS_ASSERT(uniform.IsUniform(0));
+    TS_ASSERT(!nonUniform.IsUniform(0));
+
+    std::vector<double> keys(nKeys), results(nKeys);
+    for (size_t i=0; i<nKeys; ++i)
+      keys[i] = -20.0 + 40.0*((i*7919)%nKeys)/nKeys;
+    uniform.GetValues(keys.data(), results.data(), nKeys);
+
+    // The tables only differ below their third breakpoint.
+    for (size_t i=0; i<nKeys; ++i) {
+      TS_ASSERT_EQUALS(results[i], uniform.GetValue(keys[i]));
+      if (keys[i] > -19.6)
+        TS_ASSERT_EQUALS(uniform.GetValue(keys[i]),
+                         nonUniform.GetValue(keys[i]));
+    }
+  }
+
   void testLookupProperty() {
     auto pm = std::make_shared<FGPropertyManager>();
     auto node = pm->GetNode("x", true);
@@ -384,6 +651,66 @@ public:
 
     TS_ASSERT_THROWS(FGTable t_3x1(pm, el_table), BaseException&);
   }
+
+  void testSharedData() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    // FGTable expects <table> to be the child of another XML element, hence the
+    // <dummy> element.
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar>x</independentVar>"
+                                  "    <tableData>"
+                                  "      0.0  1.0\n"
+                                  "      1.0  3.0\n"
+                                  "      2.5  -0.5\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "  <table>"
+                                  "    <independentVar>y</independentVar>"
+                                  "    <tableData>"
+                                  "      0.0  1.0\n"
+                                  "      1.0  3.0\n"
+                                  "      2.5  -0.5\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "  <table>"
+                                  "    <independentVar>x</independentVar>"
+                                  "    <tableData>"
+                                  "      0.0  1.0\n"
+                                  "      1.0  3.0\n"
+                                  "      2.5  0.5\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* el_table = elm->FindElement("table");
+    FGTable t1(pm, el_table);
+    el_table = elm->FindNextElement("table");
+    FGTable t2(pm, el_table);
+    el_table = elm->FindNextElement("table");
+    FGTable t3(pm, el_table);
+
+    // The tables with the same data share it whatever their lookup properties.
+    TS_ASSERT(t2.SharesDataWith(t1));
+    TS_ASSERT(!t3.SharesDataWith(t1));
+
+    FGTable t4(t1);
+    TS_ASSERT(t4.SharesDataWith(t1));
+    TS_ASSERT_EQUALS(t4.GetValue(0.5), 2.0);
+
+    // Tables built with operator<< share their data once they are complete.
+    FGTable t5(3);
+    t5 << 0.0 << 1.0
+       << 1.0 << 3.0;
+    TS_ASSERT(!t5.SharesDataWith(t1));
+    t5 << 2.5 << -0.5;
+    TS_ASSERT(t5.SharesDataWith(t1));
+
+    // Modifying a table does not modify the tables that share its data.
+    t1 << 3.0;
+    TS_ASSERT(!t1.SharesDataWith(t2));
+    TS_ASSERT_EQUALS(t2.GetElement(3,1), -0.5);
+    TS_ASSERT_EQUALS(t2.GetValue(2.5), -0.5);
+  }
 };
 
 
@@ -614,6 +941,186 @@ public:
     TS_ASSERT_EQUALS(t_2x2.GetValue(5.0, 2.0), 0.5);
   }
 
+  void testGetValues() {
+    FGTable t_4x3(4,3);
+    t_4x3 <<        -1.0 << 0.0 << 2.0
+          << 1.0 <<  1.0 << 2.0 << -0.5
+          << 2.0 <<  0.5 << 3.0 << 1.5
+          << 3.5 << -2.0 << 0.0 << 4.0
+          << 4.0 <<  1.0 << 1.0 << -1.0;
+
+    std::vector<double> rowKeys, colKeys;
+    for (double row: {0.0, 1.0, 1.5, 2.0, 3.0, 3.5, 3.9, 4.0, 5.0}) {
+      for (double col: {-2.0, -1.0, -0.3, 0.0, 1.2, 2.0, 3.0}) {
+        rowKeys.push_back(row);
+        colKeys.push_back(col);
+      }
+    }
+    // Unsorted keys
+    for (size_t i=0; i<63; ++i) {
+      rowKeys.push_back(rowKeys[(i*17)%63]);
+      colKeys.push_back(colKeys[(i*29)%63]);
+    }
+
+    std::vector<double> results(rowKeys.size());
+    t_4x3.GetValues(rowKeys.data(), colKeys.data(), results.data(),
+                    rowKeys.size());
+    for (size_t i=0; i<rowKeys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t_4x3.GetValue(rowKeys[i], colKeys[i]));
+
+    // Table with a single row
+    FGTable t_1x2(1,2);
+    t_1x2 << 0.0 << 1.0
+          << 1.0 << 2.0 << -1.0;
+    t_1x2.GetValues(rowKeys.data(), colKeys.data(), results.data(),
+                    rowKeys.size());
+    for (size_t i=0; i<rowKeys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], t_1x2.GetValue(rowKeys[i], colKeys[i]));
+  }
+
+  void testUniformBreakpoints() {
+    // Bilinear interpolation with the keys constrained to the table range.
+    auto interpolate = [](const std::vector<double>& x,
+                          const std::vector<double>& y,
+                          const std::vector<std::vector<double>>& z,
+                          double row, double col) {
+      row = FGJSBBase::Constrain(x.front(), row, x.back());
+      col = FGJSBBase::Constrain(y.front(), col, y.back());
+      size_t r = 1, c = 1;
+      while (x[r] < row) ++r;
+      while (y[c] < col) ++c;
+      double u = (row-x[r-1])/(x[r]-x[r-1]);
+      double v = (col-y[c-1])/(y[c]-y[c-1]);
+      return (1.0-u)*((1.0-v)*z[r-1][c-1] + v*z[r-1][c])
+             + u*((1.0-v)*z[r][c-1] + v*z[r][c]);
+    };
+
+    // Evenly spaced columns and unevenly spaced rows.
+    std::vector<double> rows = {0.0, 0.1, 0.3, 0.35, 0.5, 0.8, 0.9};
+    std::vector<double> cols = {-10.0, -8.0, -6.0, -4.0, -2.0, 0.0, 2.0};
+    std::vector<std::vector<double>> data(rows.size());
+    FGTable t(rows.size(), cols.size());
+    for (double col: cols)
+      t << col;
+    for (size_t r=0; r<rows.size(); ++r) {
+      t << rows[r];
+      for (double col: cols) {
+        data[r].push_back(rows[r]*rows[r] - 0.02*col*col + 0.1*rows[r]*col);
+        t << data[r].back();
+      }
+    }
+    TS_ASSERT(!t.IsUniform(0));
+    TS_ASSERT(t.IsUniform(1));
+
+    // The same table transposed.
+    FGTable tt(cols.size(), rows.size());
+    for (double row: rows)
+      tt << row;
+    for (size_t c=0; c<cols.size(); ++c) {
+      tt << cols[c];
+      for (size_t r=0; r<rows.size(); ++r)
+        tt << data[r][c];
+    }
+    TS_ASSERT(tt.IsUniform(0));
+    TS_ASSERT(!tt.IsUniform(1));
+
+    std::vector<double> rowKeys = {-1.0, 0.05, 0.3, 0.32, 0.6, 0.9, 2.0};
+    std::vector<double> colKeys = {-HUGE_VAL, -11.0, -8.0, -7.0,
+                                   std::nextafter(-6.0, -HUGE_VAL),
+                                   std::nextafter(-6.0, HUGE_VAL), -0.5, 2.0,
+                                   3.0, HUGE_VAL};
+    for (double row: rowKeys) {
+      for (double col: colKeys) {
+        double value = interpolate(rows, cols, data, row, col);
+        TS_ASSERT_DELTA(t.GetValue(row, col), value, epsilon);
+        TS_ASSERT_DELTA(tt.GetValue(col, row), value, epsilon);
+      }
+    }
+  }
+
+  void testInterpolation() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto load = [&](const std::string& method, const std::vector<double>& x,
+                    const std::vector<double>& y,
+                    std::function<double(double, double)> f) {
+      std::ostringstream xml;
+      xml.precision(17);
+      xml << "<dummy><table type=\"internal\" interpolation=\"" << method
+          << "\"><tableData>\n";
+      for (double col: y)
+        xml << " " << col;
+      for (double row: x) {
+        xml << "\n" << row;
+        for (double col: y)
+          xml << " " << f(row, col);
+      }
+      xml << "\n</tableData></table></dummy>";
+      Element_ptr elm = readFromXML(xml.str());
+      return std::make_unique<FGTable>(pm, elm->FindElement("table"));
+    };
+
+    std::vector<double> x = {-1.0, -0.2, 0.5, 0.9, 2.0, 2.5};
+    std::vector<double> y = {0.0, 1.0, 1.5, 3.0, 4.2};
+
+    // PCHIP reproduces the bilinear functions and the cubic splines reproduce
+    // the bicubic functions.
+    auto bilinear = [](double a, double b) { return 1.0 + 2.0*a - b + 0.5*a*b; };
+    auto bicubic = [](double a, double b) {
+      return a*a*a - 2.0*a*b*b + b + 0.3*a*a*b*b*b;
+    };
+    auto pchip = load("pchip", x, y, bilinear);
+    auto cubic = load("cubic", x, y, bicubic);
+    for (double row=-1.0; row<=2.5; row+=0.0625) {
+      for (double col=0.0; col<=4.2; col+=0.125) {
+        TS_ASSERT_DELTA(pchip->GetValue(row, col), bilinear(row, col), 1E-12);
+        TS_ASSERT_DELTA(cubic->GetValue(row, col), bicubic(row, col), 1E-12);
+      }
+    }
+
+    // The keys are constrained to the table range.
+    TS_ASSERT_DELTA(cubic->GetValue(3.0, -1.0), bicubic(2.5, 0.0), 1E-12);
+    TS_ASSERT_DELTA(cubic->GetValue(-2.0, 5.0), bicubic(-1.0, 4.2), 1E-12);
+
+    // Along a row of breakpoints, the interpolation is that of the 1D table.
+    auto wave = [](double a, double b) { return sin(a + b) + 0.2*a*b; };
+    auto table = load("pchip", x, y, wave);
+    std::ostringstream xml;
+    xml.precision(17);
+    xml << "<dummy><table type=\"internal\" interpolation=\"pchip\"><tableData>\n";
+    for (double col: y)
+      xml << col << " " << wave(0.5, col) << "\n";
+    xml << "</tableData></table></dummy>";
+    Element_ptr elm = readFromXML(xml.str());
+    FGTable t1D(pm, elm->FindElement("table"));
+    for (double col=0.0; col<=4.2; col+=0.125)
+      TS_ASSERT_DELTA(table->GetValue(0.5, col), t1D.GetValue(col), 1E-12);
+
+    // Tables with a single row or column
+    auto t1xN = load("cubic", {0.5}, y, wave);
+    auto tNx1 = load("cubic", x, {1.5}, wave);
+    for (double key=-1.0; key<=4.2; key+=0.125) {
+      double value = t1xN->GetValue(0.0, key);
+      TS_ASSERT_EQUALS(t1xN->GetValue(2.0, key), value);
+      value = tNx1->GetValue(key, 0.0);
+      TS_ASSERT_EQUALS(tNx1->GetValue(key, 3.0), value);
+    }
+    TS_ASSERT_DELTA(t1xN->GetValue(0.0, 1.0), wave(0.5, 1.0), epsilon);
+    TS_ASSERT_DELTA(tNx1->GetValue(0.9, 0.0), wave(0.9, 1.5), epsilon);
+
+    std::vector<double> rowKeys, colKeys;
+    for (double row=-1.5; row<=3.0; row+=0.25) {
+      for (double col=-0.5; col<=5.0; col+=0.25) {
+        rowKeys.push_back(row);
+        colKeys.push_back(col);
+      }
+    }
+    std::vector<double> results(rowKeys.size());
+    table->GetValues(rowKeys.data(), colKeys.data(), results.data(),
+                     rowKeys.size());
+    for (size_t i=0; i<rowKeys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], table->GetValue(rowKeys[i], colKeys[i]));
+  }
+
   void testLookupProperty() {
     auto pm = std::make_shared<FGPropertyManager>();
     auto row = pm->GetNode("x", true);
@@ -1404,6 +1911,101 @@ public:
     // `ref` was destroyed.
     TS_ASSERT_EQUALS(output->getDoubleValue(), 0.3125);
   }
+
+  void testGetValues() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table type=\"internal\">"
+                                  "    <tableData breakPoint=\"-1.0\">"
+                                  "            0.0  1.0\n"
+                                  "      2.0   3.0 -2.0\n"
+                                  "      4.0  -1.0  0.5\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"0.5\">"
+                                  "            0.5  1.5  2.0\n"
+                                  "      2.5   3.5 -2.5  1.0\n"
+                                  "      4.5  -1.5  1.0  0.0\n"
+                                  "      5.0   2.0  0.5 -3.0\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"2.0\">"
+                                  "            0.0  1.0\n"
+                                  "      2.0   1.0  2.0\n"
+                                  "      4.0   3.0  4.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    FGTable t(pm, elm->FindElement("table"));
+
+    std::vector<double> rowKeys, colKeys, tableKeys;
+    for (double table: {-1.5, -1.0, 0.0, 0.5, 1.2, 2.0, 3.0}) {
+      for (double row: {1.0, 2.0, 3.0, 4.5, 6.0}) {
+        for (double col: {-1.0, 0.0, 0.7, 1.5, 2.5}) {
+          rowKeys.push_back(row);
+          colKeys.push_back(col);
+          tableKeys.push_back(table);
+        }
+      }
+    }
+    size_t n = rowKeys.size();
+    // Unsorted keys
+    for (size_t i=0; i<n; ++i) {
+      rowKeys.push_back(rowKeys[(i*13)%n]);
+      colKeys.push_back(colKeys[(i*31)%n]);
+      tableKeys.push_back(tableKeys[(i*47)%n]);
+    }
+
+    std::vector<double> results(rowKeys.size());
+    t.GetValues(rowKeys.data(), colKeys.data(), tableKeys.data(),
+                results.data(), rowKeys.size());
+    for (size_t i=0; i<rowKeys.size(); ++i)
+      TS_ASSERT_EQUALS(results[i],
+                       t.GetValue(rowKeys[i], colKeys[i], tableKeys[i]));
+
+    // The breakpoints -1.0, 0.5 and 2.0 are evenly spaced.
+    TS_ASSERT(t.IsUniform(2));
+  }
+
+  void testInterpolation() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    std::string data = "            0.0  1.0  2.0\n"
+                       "      2.0   3.0 -2.0  1.0\n"
+                       "      4.0  -1.0  0.5  0.0\n"
+                       "      5.0   2.0  0.5 -3.0\n";
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table type=\"internal\" interpolation=\"pchip\">"
+                                  "    <tableData breakPoint=\"-1.0\">\n"
+                                  + data +
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"1.0\">"
+                                  "            0.0  1.0\n"
+                                  "      2.0   1.0  2.0\n"
+                                  "      4.0   3.0  4.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    FGTable t(pm, elm->FindElement("table"));
+    elm = readFromXML("<dummy>"
+                      "  <table type=\"internal\" interpolation=\"pchip\">"
+                      "    <tableData>\n"
+                      + data +
+                      "    </tableData>"
+                      "  </table>"
+                      "</dummy>");
+    FGTable t2D(pm, elm->FindElement("table"));
+
+    // The sub-tables are interpolated with PCHIP and blended linearly.
+    for (double row=1.5; row<=5.5; row+=0.25) {
+      for (double col=-0.5; col<=2.5; col+=0.25) {
+        double value = t2D.GetValue(row, col);
+        TS_ASSERT_EQUALS(t.GetValue(row, col, -1.0), value);
+        double blend = 0.25*t.GetValue(row, col, 1.0) + 0.75*value;
+        TS_ASSERT_DELTA(t.GetValue(row, col, -0.5), blend, epsilon);
+      }
+    }
+
+    FGTable copy(t);
+    TS_ASSERT_EQUALS(copy.GetValue(3.3, 0.7, 0.2), t.GetValue(3.3, 0.7, 0.2));
+  }
 };
 
 
@@ -1427,6 +2029,21 @@ public:
     TS_ASSERT_THROWS(FGTable t_2x1(pm, el_table), BaseException&);
   }
 
+  void testInterpolationError() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table type=\"internal\" interpolation=\"quadratic\">"
+                                  "    <tableData>"
+                                  "      1.0 -1.0\n"
+                                  "      2.0  1.5\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    Element* el_table = elm->FindElement("table");
+
+    TS_ASSERT_THROWS(FGTable t_2x1(pm, el_table), BaseException&);
+  }
+
   void testLookupNameError() {
     auto pm = std::make_shared<FGPropertyManager>();
     // FGTable expects <table> to be the child of another XML element, hence the
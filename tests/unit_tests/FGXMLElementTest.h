@@ -0,0 +1,169 @@
+#include <filesystem>
+
+#include <cxxtest/TestSuite.h>
+#include "FGJSBBase.h"
+#include <input_output/FGXMLElement.h>
+#include <input_output/FGXMLFileRead.h>
+#include "TestUtilities.h"
+
+using namespace JSBSim;
+
+// Checks that two documents parsed from the same file are identical and that
+// their names are interned. Returns the number of elements.
+static size_t CompareElements(Element* el1, Element* el2)
+{
+  TS_ASSERT_EQUALS(&el1->GetName(), &el2->GetName());
+  TS_ASSERT_EQUALS(&el1->GetFileName(), &el2->GetFileName());
+  TS_ASSERT_EQUALS(el1->GetLineNumber(), el2->GetLineNumber());
+  TS_ASSERT_EQUALS(el1->GetNumDataLines(), el2->GetNumDataLines());
+  TS_ASSERT_EQUALS(el1->GetAttributes().size(), el2->GetAttributes().size());
+  TS_ASSERT_EQUALS(el1->GetNumElements(), el2->GetNumElements());
+
+  size_t count = 1;
+  for (unsigned int i=0; i<el1->GetNumElements(); ++i)
+    count += CompareElements(el1->GetElement(i), el2->GetElement(i));
+  return count;
+}
+
+class FGXMLElementTest : public CxxTest::TestSuite
+{
+public:
+  void testInternedNames() {
+    Element_ptr el1 = new Element("table");
+    Element_ptr el2 = new Element(std::string("tab") + "le");
+    TS_ASSERT_EQUALS(el1->GetName(), "table");
+    TS_ASSERT_EQUALS(&el1->GetName(), &el2->GetName());
+
+    el2->ChangeName("tableData");
+    TS_ASSERT_EQUALS(el2->GetName(), "tableData");
+    TS_ASSERT_DIFFERS(&el1->GetName(), &el2->GetName());
+
+    el1->SetFileName("file.xml");
+    el2->SetFileName("file.xml");
+    TS_ASSERT_EQUALS(el1->GetFileName(), "file.xml");
+    TS_ASSERT_EQUALS(&el1->GetFileName(), &el2->GetFileName());
+
+    Element_ptr el3 = new Element("function");
+    TS_ASSERT(el3->GetFileName().empty());
+  }
+
+  void testAttributes() {
+    Element_ptr el = new Element("element");
+    TS_ASSERT(el->GetAttributes().empty());
+    TS_ASSERT(!el->HasAttribute("name"));
+    TS_ASSERT_EQUALS(el->GetAttributeValue("name"), "");
+    TS_ASSERT(!el->SetAttributeValue("name", "x"));
+    TS_ASSERT(!el->HasAttribute("name"));
+
+    el->AddAttribute("name", "aileron");
+    el->AddAttribute("unit", "DEG");
+    TS_ASSERT(el->HasAttribute("name"));
+    TS_ASSERT_EQUALS(el->GetAttributeValue("name"), "aileron");
+    TS_ASSERT_EQUALS(el->GetAttributeValue("unit"), "DEG");
+
+    // Attributes are kept in the order in which they have been added and
+    // adding an existing attribute overwrites its value.
+    el->AddAttribute("name", "elevator");
+    const Element::AttributeList& attributes = el->GetAttributes();
+    TS_ASSERT_EQUALS(attributes.size(), 2);
+    TS_ASSERT_EQUALS(*attributes[0].first, "name");
+    TS_ASSERT_EQUALS(attributes[0].second, "elevator");
+    TS_ASSERT_EQUALS(*attributes[1].first, "unit");
+    TS_ASSERT_EQUALS(attributes[1].second, "DEG");
+
+    TS_ASSERT(el->SetAttributeValue("unit", "RAD"));
+    TS_ASSERT_EQUALS(el->GetAttributeValue("unit"), "RAD");
+
+    el->AddAttribute("value", "1.5");
+    TS_ASSERT_EQUALS(el->GetAttributeValueAsNumber("value"), 1.5);
+
+    // Attribute names are interned as well.
+    Element_ptr el2 = new Element("element");
+    el2->AddAttribute("name", "rudder");
+    TS_ASSERT_EQUALS(attributes[0].first, el2->GetAttributes()[0].first);
+  }
+
+  void testMergeAttributes() {
+    Element_ptr el1 = new Element("element");
+    el1->AddAttribute("name", "aileron");
+    Element_ptr el2 = new Element("element");
+    el2->AddAttribute("name", "elevator");
+    el2->AddAttribute("type", "internal");
+
+    el1->MergeAttributes(el2);
+    TS_ASSERT_EQUALS(el1->GetAttributes().size(), 2);
+    TS_ASSERT_EQUALS(el1->GetAttributeValue("name"), "aileron");
+    TS_ASSERT_EQUALS(el1->GetAttributeValue("type"), "internal");
+  }
+
+  void testFindElement() {
+    Element_ptr el = readFromXML("<function>"
+                                 "  <product/>"
+                                 "  <sum/>"
+                                 "  <product/>"
+                                 "</function>");
+    Element* product1 = el->GetElement(0);
+    Element* sum = el->GetElement(1);
+    Element* product2 = el->GetElement(2);
+    TS_ASSERT_EQUALS(el->FindElement("product"), product1);
+    TS_ASSERT_EQUALS(el->FindNextElement("product"), product2);
+    TS_ASSERT(!el->FindNextElement("product"));
+    TS_ASSERT_EQUALS(el->GetNumElements("product"), 2);
+    TS_ASSERT_EQUALS(el->FindElement(), product1);
+    TS_ASSERT_EQUALS(el->FindNextElement(), sum);
+
+    // A name that no element has ever used.
+    TS_ASSERT(!el->FindElement("no_element_has_this_name"));
+    TS_ASSERT(!el->FindNextElement("no_element_has_this_name"));
+    TS_ASSERT_EQUALS(el->GetNumElements("no_element_has_this_name"), 0);
+  }
+
+  void testDataLines() {
+    Element_ptr el = readFromXML("<tableData>\n"
+                                 "    \t\n"
+                                 "   0.0  1.0\n"
+                                 "\t -1.0e1\t2.5  \n"
+                                 "</tableData>");
+    TS_ASSERT_EQUALS(el->GetNumDataLines(), 2);
+    TS_ASSERT_EQUALS(el->GetDataLine(0), "0.0  1.0");
+    TS_ASSERT_EQUALS(el->GetDataLine(1), "-1.0e1\t2.5");
+
+    std::vector<double> values {3.0};
+    el->GetDataAsNumbers(values);
+    TS_ASSERT_EQUALS(values.size(), 5);
+    TS_ASSERT_EQUALS(values[0], 3.0);
+    TS_ASSERT_EQUALS(values[1], 0.0);
+    TS_ASSERT_EQUALS(values[2], 1.0);
+    TS_ASSERT_EQUALS(values[3], -10.0);
+    TS_ASSERT_EQUALS(values[4], 2.5);
+
+    Element_ptr empty = new Element("tableData");
+    TS_ASSERT_EQUALS(empty->GetDataLine(), "");
+    values.clear();
+    empty->GetDataAsNumbers(values);
+    TS_ASSERT(values.empty());
+
+    Element_ptr invalid = readFromXML("<tableData>0.0 1.0e</tableData>");
+    TS_ASSERT_THROWS(invalid->GetDataAsNumbers(values), BaseException&);
+  }
+
+  // Parses all the aircraft files of the repository twice.
+  void testLoadAircraft() {
+    namespace fs = std::filesystem;
+    std::vector<fs::path> files;
+    for (const auto& entry: fs::directory_iterator(JSBSIM_ROOT_DIR "/aircraft")) {
+      fs::path file = entry.path() / (entry.path().filename().string() + ".xml");
+      if (entry.is_directory() && fs::exists(file)) files.push_back(file);
+    }
+    TS_ASSERT(!files.empty());
+
+    for (const auto& file: files) {
+      FGXMLFileRead XMLFileRead1, XMLFileRead2;
+      Element* document1 = XMLFileRead1.LoadXMLDocument(SGPath(file.string()));
+      Element* document2 = XMLFileRead2.LoadXMLDocument(SGPath(file.string()));
+      TS_ASSERT(document1);
+      TS_ASSERT(document2);
+      TS_ASSERT_LESS_THAN(1, CompareElements(document1, document2));
+    }
+  }
+};
@@ -158,6 +158,47 @@ public:
     TS_ASSERT_THROWS(atof_locale_c(" "), InvalidNumber&);
   }
 
+  void testReadNumbersLocaleC() {
+    std::vector<double> values;
+    read_numbers_locale_c(empty, values);
+    TS_ASSERT(values.empty());
+    read_numbers_locale_c(" \t ", values);
+    TS_ASSERT(values.empty());
+    read_numbers_locale_c("0.0 +1\t-3.14e-2  .25 1.e1\n1E-999", values);
+    TS_ASSERT_EQUALS(values.size(), 6);
+    TS_ASSERT_EQUALS(values[0], 0.0);
+    TS_ASSERT_EQUALS(values[1], 1.0);
+    TS_ASSERT_EQUALS(values[2], -0.0314);
+    TS_ASSERT_EQUALS(values[3], 0.25);
+    TS_ASSERT_EQUALS(values[4], 10.);
+    TS_ASSERT_EQUALS(values[5], 0.0);
+    // Numbers are appended
+    read_numbers_locale_c("-314", values);
+    TS_ASSERT_EQUALS(values.size(), 7);
+    TS_ASSERT_EQUALS(values[6], -314.);
+    // Numbers that are not separated by white spaces
+    values.clear();
+    read_numbers_locale_c("1-2 1.0.5 -1e2+3 0.5-.25", values);
+    TS_ASSERT_EQUALS(values.size(), 8);
+    TS_ASSERT_EQUALS(values[0], 1.0);
+    TS_ASSERT_EQUALS(values[1], -2.0);
+    TS_ASSERT_EQUALS(values[2], 1.0);
+    TS_ASSERT_EQUALS(values[3], 0.5);
+    TS_ASSERT_EQUALS(values[4], -100.0);
+    TS_ASSERT_EQUALS(values[5], 3.0);
+    TS_ASSERT_EQUALS(values[6], 0.5);
+    TS_ASSERT_EQUALS(values[7], -0.25);
+    // Test invalid numbers
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.0 1E+999", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.2E 3.0", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1--2", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c(". 1", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("inf", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("nan", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("0x10", values), InvalidNumber&);
+    TS_ASSERT_THROWS(read_numbers_locale_c("1.0,2.0", values), InvalidNumber&);
+  }
+
 private:
   std::string empty;
 };
@@ -0,0 +1,53 @@
+// Reports the time taken by the typical sequences of queries made on the
+// aircraft location at each time step.
+//
+// Build with -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release and run
+// utils/benchmarks/LocationBenchmark from the build directory.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include "math/FGLocation.h"
+
+using namespace JSBSim;
+
+int main()
+{
+  const double a = 20925646.32546; // WGS84 semimajor axis length in feet
+  const double b = 20855486.5951;  // WGS84 semiminor axis length in feet
+  const int nSteps = 200000;
+  FGLocation l;
+  l.SetEllipse(a, b);
+  l.SetPositionGeodetic(0.3, 0.7, 10000.);
+  const FGLocation dp(FGColumnVector3(100., 50., -20.));
+  const FGLocation dm(FGColumnVector3(-100., -50., 20.));
+  double sum = 0.0;
+
+  auto run = [&](const char* name, auto queries) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i=0; i<nSteps; ++i) {
+      l += i%2 ? dm : dp;
+      sum += queries();
+    }
+    std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << duration.count()/nSteps << " ns per step"
+              << std::endl;
+  };
+
+  // Queries from the FGPropagate/FGAuxiliary updates
+  run("Radius", [&]() { return l.GetRadius(); });
+  run("Radius and longitude", [&]() {
+    return l.GetRadius() + l.GetLongitude(); });
+  run("Altitude above sea level", [&]() {
+    return l.GetRadius() - l.GetSeaLevelRadius(); });
+  run("Local frame", [&]() {
+    return l.GetTl2ec()(1,1) + l.GetTec2l()(2,2); });
+  run("All derived values", [&]() {
+    return l.GetRadius() - l.GetSeaLevelRadius() + l.GetTl2ec()(1,1)
+      + l.GetLongitude() + l.GetLatitude() + l.GetGeodLatitudeRad()
+      + l.GetGeodAltitude(); });
+
+  // Keeps the queries from being optimized away.
+  return std::isfinite(sum) ? 0 : 1;
+}
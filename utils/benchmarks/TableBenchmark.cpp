@@ -0,0 +1,199 @@
+// Reports the time taken to evaluate the tables.
+//
+// Build with -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release and run
+// utils/benchmarks/TableBenchmark from the build directory.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "input_output/FGXMLParse.h"
+#include "math/FGTable.h"
+
+using namespace JSBSim;
+
+// Evaluates a 2D table at sorted (sweeps, blade elements) and scattered keys,
+// one key at a time and in a batch.
+bool GetValuesBenchmark()
+{
+  const size_t nRows = 40, nCols = 12, nKeys = 100000;
+  FGTable t(nRows, nCols);
+  for (size_t c=1; c<=nCols; ++c)
+    t << -10.0 + 3.0*c;
+  for (size_t r=1; r<=nRows; ++r) {
+    t << 0.05*r*r;
+    for (size_t c=1; c<=nCols; ++c)
+      t << sin(0.3*r + 0.7*c);
+  }
+
+  std::vector<double> rowKeys(nKeys), colKeys(nKeys), results(nKeys);
+  double sum = 0.0;
+  auto run = [&](const char* name) {
+    const int nRuns = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int k=0; k<nRuns; ++k)
+      for (size_t i=0; i<nKeys; ++i)
+        sum += t.GetValue(rowKeys[i], colKeys[i]);
+    std::chrono::duration<double, std::nano> scalar = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+    for (int k=0; k<nRuns; ++k)
+      t.GetValues(rowKeys.data(), colKeys.data(), results.data(), nKeys);
+    std::chrono::duration<double, std::nano> batch = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": "
+              << scalar.count()/(nRuns*nKeys) << " ns per key (GetValue), "
+              << batch.count()/(nRuns*nKeys) << " ns per key (GetValues)"
+              << std::endl;
+    sum += results[nKeys/2];
+  };
+
+  for (size_t i=0; i<nKeys; ++i) {
+    rowKeys[i] = 80.0*i/nKeys;
+    colKeys[i] = 1.0 + 0.1*sin(1E-3*i);
+  }
+  run("Sorted keys");
+
+  for (size_t i=0; i<nKeys; ++i) {
+    rowKeys[i] = 80.0*((i*7919)%nKeys)/nKeys;
+    colKeys[i] = -7.0 + 34.0*((i*104729)%nKeys)/nKeys;
+  }
+  run("Scattered keys");
+
+  return std::isfinite(sum);
+}
+
+// Compares the lookup of a 1D table with evenly spaced breakpoints to the same
+// table with a breakpoint moved.
+bool UniformBenchmark()
+{
+  const size_t nRows = 200, nKeys = 100000;
+  FGTable uniform(nRows), nonUniform(nRows);
+  for (size_t r=0; r<nRows; ++r) {
+    double x = -20.0 + 0.2*r;
+    uniform << x << cos(0.1*x);
+    nonUniform << (r == 1 ? x - 0.1 : x) << cos(0.1*x);
+  }
+
+  std::vector<double> keys(nKeys), results(nKeys);
+  for (size_t i=0; i<nKeys; ++i)
+    keys[i] = -20.0 + 40.0*((i*7919)%nKeys)/nKeys;
+
+  double sum = 0.0;
+  auto run = [&](const FGTable& t, const char* name) {
+    const int nRuns = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int k=0; k<nRuns; ++k)
+      for (size_t i=0; i<nKeys; ++i)
+        sum += t.GetValue(keys[i]);
+    std::chrono::duration<double, std::nano> scalar = std::chrono::steady_clock::now() - start;
+    start = std::chrono::steady_clock::now();
+    for (int k=0; k<nRuns; ++k)
+      t.GetValues(keys.data(), results.data(), nKeys);
+    std::chrono::duration<double, std::nano> batch = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": "
+              << scalar.count()/(nRuns*nKeys) << " ns per key (GetValue), "
+              << batch.count()/(nRuns*nKeys) << " ns per key (GetValues)"
+              << std::endl;
+    sum += results[nKeys/2];
+  };
+
+  run(nonUniform, "200 uneven breakpoints");
+  run(uniform, "200 even breakpoints");
+
+  return uniform.IsUniform(0) && !nonUniform.IsUniform(0) && std::isfinite(sum);
+}
+
+// Reports the size, the accuracy and the lookup time of the smallest linear,
+// PCHIP and cubic spline tables that meet a given accuracy on a lift
+// coefficient like curve.
+bool InterpolationBenchmark()
+{
+  auto f = [](double x) { return sin(x) + 0.2*sin(3.0*x); };
+  const double xmin = -0.5, xmax = 3.5;
+  const size_t nKeys = 100000;
+  auto pm = std::make_shared<FGPropertyManager>();
+
+  auto load = [&](const std::string& method, unsigned int n) {
+    std::ostringstream xml;
+    xml.precision(17);
+    xml << "<dummy><table type=\"internal\" interpolation=\"" << method
+        << "\"><tableData>\n";
+    for (unsigned int i=0; i<n; ++i) {
+      double x = xmin + (xmax-xmin)*i/(n-1);
+      xml << x << " " << f(x) << "\n";
+    }
+    xml << "</tableData></table></dummy>";
+    std::istringstream data(xml.str());
+    FGXMLParse parser;
+    readXML(data, parser);
+    Element_ptr elm = parser.GetDocument();
+    return std::make_unique<FGTable>(pm, elm->FindElement("table"));
+  };
+
+  std::vector<double> keys(nKeys);
+  for (size_t i=0; i<nKeys; ++i)
+    keys[i] = xmin + (xmax-xmin)*((i*7919)%nKeys)/nKeys;
+
+  auto maxError = [&](const FGTable& t) {
+    double error = 0.0;
+    for (double key: keys)
+      error = std::max(error, fabs(t.GetValue(key) - f(key)));
+    return error;
+  };
+
+  double sum = 0.0;
+  auto report = [&](const FGTable& t, const std::string& name) {
+    const int nRuns = 20;
+    double error = maxError(t); // Also warms up the cache
+    auto start = std::chrono::steady_clock::now();
+    for (int k=0; k<nRuns; ++k)
+      for (double key: keys)
+        sum += t.GetValue(key);
+    std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    std::cout << "  " << name << ": " << t.GetNumRows() << " breakpoints, "
+              << t.GetDataSize() << " bytes, error " << std::scientific
+              << error << std::defaultfloat << ", "
+              << duration.count()/(nRuns*nKeys) << " ns per key" << std::endl;
+  };
+
+  // Smallest table of each interpolation method that meets the accuracy.
+  auto smallest = [&](const std::string& method, double accuracy) {
+    unsigned int n = 3;
+    while (maxError(*load(method, 2*n-1)) > accuracy) n = 2*n - 1;
+    unsigned int high = 2*n - 1;
+    while (high - n > 1) {
+      unsigned int middle = (n + high) / 2;
+      if (maxError(*load(method, middle)) > accuracy)
+        n = middle;
+      else
+        high = middle;
+    }
+    return load(method, high);
+  };
+
+  for (double accuracy: {1E-3, 1E-5}) {
+    std::cout << "Accuracy " << std::scientific << accuracy
+              << std::defaultfloat << std::endl;
+    report(*smallest("linear", accuracy), "linear");
+    report(*smallest("pchip", accuracy), "pchip");
+    report(*smallest("cubic", accuracy), "cubic");
+  }
+
+  return std::isfinite(sum);
+}
+
+int main()
+{
+  // The tables are not printed when they are loaded.
+  FGJSBBase::debug_lvl = 0;
+
+  bool ok = GetValuesBenchmark();
+  ok &= UniformBenchmark();
+  ok &= InterpolationBenchmark();
+
+  // The sums keep the evaluations from being optimized away.
+  return ok ? 0 : 1;
+}